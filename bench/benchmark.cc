@@ -0,0 +1,200 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "bench/benchmark.h"
+#include "framework/mesh/mesh_generator/orthogonal_mesh_generator.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/parameters/parameter_block.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
+using namespace opensn;
+
+namespace opensnbench
+{
+
+namespace
+{
+
+volatile double optimization_sink = 0.0;
+
+/// Returns the string with JSON special characters escaped.
+std::string
+JSONString(const std::string& value)
+{
+  std::string escaped = "\"";
+  for (const char c : value)
+  {
+    if (c == '"' or c == '\\')
+      escaped += '\\';
+    escaped += c;
+  }
+  return escaped + "\"";
+}
+
+} // namespace
+
+const MeshContinuum&
+BenchmarkContext::OrthogonalMesh(unsigned int dimension)
+{
+  auto it = mesh_stack_indices_.find(dimension);
+  if (it == mesh_stack_indices_.end())
+  {
+    const size_t n = options_.mesh_size;
+    std::vector<double> nodes(n + 1);
+    for (size_t i = 0; i <= n; ++i)
+      nodes[i] = static_cast<double>(i) / static_cast<double>(n);
+
+    ParameterBlock node_sets("node_sets");
+    node_sets.ChangeToArray();
+    for (unsigned int d = 0; d < dimension; ++d)
+      node_sets.AddParameter(ParameterBlock(std::to_string(d), nodes));
+    ParameterBlock block;
+    block.AddParameter(node_sets);
+
+    auto params = OrthogonalMeshGenerator::GetInputParameters();
+    params.AssignParameters(block);
+    OrthogonalMeshGenerator generator(params);
+    generator.Execute();
+    mesh_stack.back()->SetUniformMaterialID(0);
+
+    it = mesh_stack_indices_.emplace(dimension, mesh_stack.size() - 1).first;
+  }
+
+  // Solvers are built on the current mesh, which is the last one on the stack
+  const auto& grid_ptr = mesh_stack[it->second];
+  if (mesh_stack.back() != grid_ptr)
+  {
+    mesh_stack.push_back(grid_ptr);
+    it->second = mesh_stack.size() - 1;
+  }
+
+  return *grid_ptr;
+}
+
+void
+BenchmarkContext::Measure(const std::string& name,
+                          const std::map<std::string, double>& parameters,
+                          size_t items_per_repetition,
+                          const std::function<void()>& kernel)
+{
+  for (size_t r = 0; r < options_.num_warmup; ++r)
+    kernel();
+
+  std::vector<double> times;
+  times.reserve(options_.num_repetitions);
+  for (size_t r = 0; r < options_.num_repetitions; ++r)
+  {
+    mpi_comm.barrier();
+    const auto start = std::chrono::steady_clock::now();
+    kernel();
+    const auto end = std::chrono::steady_clock::now();
+
+    const double local_time = std::chrono::duration<double>(end - start).count();
+    double time = 0.0;
+    mpi_comm.all_reduce(local_time, time, mpi::op::max<double>());
+    times.push_back(time);
+  }
+  std::sort(times.begin(), times.end());
+
+  BenchmarkResult result;
+  result.name = name;
+  result.parameters = parameters;
+  result.num_repetitions = times.size();
+  result.items_per_repetition = items_per_repetition;
+  if (not times.empty())
+  {
+    const size_t mid = times.size() / 2;
+    result.min = times.front();
+    result.max = times.back();
+    result.median = times.size() % 2 == 1 ? times[mid] : 0.5 * (times[mid - 1] + times[mid]);
+    result.mean =
+      std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(times.size());
+  }
+
+  std::stringstream case_description;
+  for (const auto& [parameter, value] : parameters)
+    case_description << " " << parameter << "=" << value;
+  opensn::log.Log() << name << case_description.str() << ": median " << result.median
+                    << " s, min " << result.min << " s over " << result.num_repetitions
+                    << " repetitions";
+
+  results_.push_back(std::move(result));
+}
+
+void
+DoNotOptimize(double value)
+{
+  optimization_sink = value;
+}
+
+std::map<std::string, BenchmarkFunction>&
+BenchmarkRegistry()
+{
+  static std::map<std::string, BenchmarkFunction> registry;
+  return registry;
+}
+
+bool
+RegisterBenchmark(const std::string& name, const BenchmarkFunction& function)
+{
+  auto& registry = BenchmarkRegistry();
+  if (registry.count(name) > 0)
+    throw std::logic_error("Benchmark \"" + name + "\" is registered more than once.");
+  registry[name] = function;
+  return true;
+}
+
+void
+WriteResultsJSON(std::ostream& out,
+                 const BenchmarkOptions& options,
+                 const std::vector<BenchmarkResult>& results)
+{
+  out << std::setprecision(9);
+  out << "{\n"
+      << "  \"opensn_version\": " << JSONString(GetVersionStr()) << ",\n"
+      << "  \"num_processes\": " << mpi_comm.size() << ",\n"
+      << "  \"options\": {\n"
+      << "    \"mesh_size\": " << options.mesh_size << ",\n"
+      << "    \"num_groups\": " << options.num_groups << ",\n"
+      << "    \"num_azimuthal\": " << options.num_azimuthal << ",\n"
+      << "    \"num_polar\": " << options.num_polar << ",\n"
+      << "    \"num_warmup\": " << options.num_warmup << ",\n"
+      << "    \"num_repetitions\": " << options.num_repetitions << ",\n"
+      << "    \"seed\": " << options.seed << "\n"
+      << "  },\n"
+      << "  \"benchmarks\": [";
+
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    const auto& result = results[i];
+    out << (i == 0 ? "\n" : ",\n") << "    {\n"
+        << "      \"name\": " << JSONString(result.name) << ",\n"
+        << "      \"parameters\": {";
+    size_t p = 0;
+    for (const auto& [parameter, value] : result.parameters)
+      out << (p++ == 0 ? "" : ", ") << JSONString(parameter) << ": " << value;
+    out << "},\n"
+        << "      \"repetitions\": " << result.num_repetitions << ",\n"
+        << "      \"items_per_repetition\": " << result.items_per_repetition << ",\n"
+        << "      \"min_s\": " << result.min << ",\n"
+        << "      \"median_s\": " << result.median << ",\n"
+        << "      \"mean_s\": " << result.mean << ",\n"
+        << "      \"max_s\": " << result.max << ",\n"
+        << "      \"items_per_second\": "
+        << (result.median > 0.0 ? static_cast<double>(result.items_per_repetition) / result.median
+                                : 0.0)
+        << "\n"
+        << "    }";
+  }
+
+  out << (results.empty() ? "" : "\n  ") << "]\n"
+      << "}\n";
+}
+
+} // namespace opensnbench
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/utils/utils.h"
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace opensn
+{
+class MeshContinuum;
+}
+
+namespace opensnbench
+{
+
+/// Settings shared by all benchmarks.
+struct BenchmarkOptions
+{
+  /// Number of cells per dimension of the synthetic orthogonal meshes
+  size_t mesh_size = 16;
+  /// Number of energy groups of the synthetic cross sections
+  size_t num_groups = 8;
+  /// Number of azimuthal and polar angles per octant of the product quadrature
+  int num_azimuthal = 4;
+  int num_polar = 2;
+  /// Number of untimed repetitions before measuring
+  size_t num_warmup = 1;
+  /// Number of timed repetitions
+  size_t num_repetitions = 10;
+  /// Only benchmarks whose name contains this string are run
+  std::string filter;
+  /// Fixed seed for all pseudo-random inputs so that runs are reproducible
+  unsigned int seed = 1234;
+};
+
+/// Timing statistics of one benchmark case. Times are in seconds, per repetition.
+struct BenchmarkResult
+{
+  std::string name;
+  std::map<std::string, double> parameters;
+  size_t num_repetitions = 0;
+  /// Number of work items (cells, dofs, solves, ...) processed per repetition
+  size_t items_per_repetition = 0;
+  double min = 0.0;
+  double median = 0.0;
+  double mean = 0.0;
+  double max = 0.0;
+};
+
+/**
+ * Passed to every benchmark. Provides the options, the synthetic meshes and the timing of the
+ * kernels.
+ */
+class BenchmarkContext
+{
+public:
+  explicit BenchmarkContext(const BenchmarkOptions& options) : options_(options) {}
+
+  const BenchmarkOptions& Options() const { return options_; }
+
+  /**
+   * Returns an orthogonal mesh with `Options().mesh_size` cells per dimension on the unit domain,
+   * generated with the OrthogonalMeshGenerator on first use. Meshes are cached per dimension.
+   */
+  const opensn::MeshContinuum& OrthogonalMesh(unsigned int dimension);
+
+  /**
+   * Times `kernel` over the configured number of repetitions, after the warm-up repetitions, and
+   * records the result. Every repetition starts at a barrier and its time is the maximum over all
+   * processes. Collective.
+   *
+   * \param name Name of the benchmark case.
+   * \param parameters Parameters of the case that are reported along with the timings.
+   * \param items_per_repetition Number of work items processed by one call of the kernel.
+   * \param kernel The code to time.
+   */
+  void Measure(const std::string& name,
+               const std::map<std::string, double>& parameters,
+               size_t items_per_repetition,
+               const std::function<void()>& kernel);
+
+  const std::vector<BenchmarkResult>& Results() const { return results_; }
+
+private:
+  const BenchmarkOptions options_;
+  std::map<unsigned int, size_t> mesh_stack_indices_;
+  std::vector<BenchmarkResult> results_;
+};
+
+using BenchmarkFunction = std::function<void(BenchmarkContext&)>;
+
+/// Returns all registered benchmarks by name.
+std::map<std::string, BenchmarkFunction>& BenchmarkRegistry();
+
+/// Adds a benchmark to the registry. Returns true so that it can initialize a static.
+bool RegisterBenchmark(const std::string& name, const BenchmarkFunction& function);
+
+/// Stores a value where the compiler cannot see it, so that benchmarked code is not optimized away.
+void DoNotOptimize(double value);
+
+/// Writes the results as a JSON document.
+void WriteResultsJSON(std::ostream& out,
+                      const BenchmarkOptions& options,
+                      const std::vector<BenchmarkResult>& results);
+
+} // namespace opensnbench
+
+/// Registers a function `void(BenchmarkContext&)` as a benchmark with the given name.
+#define OpenSnRegisterBenchmark(name, function)                                                    \
+  static bool OpenSnJoinWords(unique_var_name_benchmark_, __COUNTER__) =                           \
+    opensnbench::RegisterBenchmark(name, function)
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "bench/benchmark.h"
+#include "modules/diffusion/cfem_diffusion_solver.h"
+#include "framework/math/functions/expression_scalar_spatial_material_function.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/parameters/parameter_block.h"
+#include "framework/runtime.h"
+
+using namespace opensn;
+
+namespace opensnbench
+{
+
+namespace
+{
+
+/// Makes a material function from an expression of `mat_id`, `x`, `y` and `z`.
+std::shared_ptr<ScalarSpatialMaterialFunction>
+MakeFunction(const std::string& expression)
+{
+  ParameterBlock block;
+  block.AddParameter("expression", expression);
+  auto params = ExpressionScalarSpatialMaterialFunction::GetInputParameters();
+  params.AssignParameters(block);
+  return std::make_shared<ExpressionScalarSpatialMaterialFunction>(params);
+}
+
+/**
+ * Times the assembly and solution of a CFEM diffusion problem on the 3D benchmark mesh with the
+ * assembled operator and with the matrix-free operator under both of its preconditioners.
+ */
+void
+BenchmarkCFEMDiffusion(BenchmarkContext& context)
+{
+  const auto& options = context.Options();
+  const auto& grid = context.OrthogonalMesh(3);
+
+  const auto d_coef = MakeFunction("1.0");
+  const auto sigma_a = MakeFunction("0.1");
+  const auto q_ext = MakeFunction("1.0");
+
+  struct Mode
+  {
+    bool matrix_free;
+    std::string preconditioner;
+  };
+  const std::vector<Mode> modes = {{false, "gamg"}, {true, "gamg"}, {true, "jacobi"}};
+
+  for (const auto& mode : modes)
+  {
+    ParameterBlock block;
+    block.AddParameter("name", std::string("bench_cfem"));
+    block.AddParameter("residual_tolerance", 1.0e-8);
+    block.AddParameter("matrix_free", mode.matrix_free);
+    block.AddParameter("matrix_free_preconditioner", mode.preconditioner);
+
+    auto params = CFEMDiffusionSolver::GetInputParameters();
+    params.AssignParameters(block);
+
+    context.Measure("CFEMDiffusionSolver::Execute",
+                    {{"mesh_size", static_cast<double>(options.mesh_size)},
+                     {"matrix_free", mode.matrix_free ? 1.0 : 0.0},
+                     {"jacobi_preconditioner", mode.preconditioner == "jacobi" ? 1.0 : 0.0}},
+                    grid.local_cells.size(),
+                    [&]
+                    {
+                      CFEMDiffusionSolver solver(params);
+                      solver.SetDCoefFunction(d_coef);
+                      solver.SetSigmaAFunction(sigma_a);
+                      solver.SetQExtFunction(q_ext);
+                      solver.Initialize();
+                      solver.Execute();
+
+                      // The solver registers its flux field function globally
+                      field_function_stack.pop_back();
+                    });
+  }
+}
+
+} // namespace
+
+OpenSnRegisterBenchmark("CFEMDiffusionSolver::Execute", BenchmarkCFEMDiffusion);
+
+} // namespace opensnbench
@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "bench/benchmark.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/iterative_methods/sweep_wgs_context.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/lbs_discrete_ordinates_solver.h"
+#include "framework/materials/material.h"
+#include "framework/materials/isotropic_multigroup_source.h"
+#include "framework/materials/multi_group_xs/multi_group_xs.h"
+#include "framework/math/quadratures/angular/product_quadrature.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/parameters/parameter_block.h"
+#include "framework/runtime.h"
+#include <filesystem>
+#include <fstream>
+
+using namespace opensn;
+
+namespace opensnbench
+{
+
+namespace
+{
+
+/**
+ * Writes an OpenSn cross-section file with `num_groups` groups, isotropic within-group scattering
+ * and downscattering into the next group, and returns its path.
+ */
+std::string
+WriteSyntheticXSFile(size_t num_groups)
+{
+  const auto path = std::filesystem::temp_directory_path() /
+                    ("opensn_bench_xs_" + std::to_string(mpi_comm.rank()) + ".xs");
+
+  std::ofstream file(path);
+  if (not file.is_open())
+    throw std::runtime_error("Failed to write the synthetic cross sections to " + path.string());
+
+  file << "NUM_GROUPS " << num_groups << "\n"
+       << "NUM_MOMENTS 1\n\n"
+       << "SIGMA_T_BEGIN\n";
+  for (size_t g = 0; g < num_groups; ++g)
+    file << g << " " << 1.0 + 0.1 * static_cast<double>(g) << "\n";
+  file << "SIGMA_T_END\n\n"
+       << "TRANSFER_MOMENTS_BEGIN\n";
+  for (size_t g = 0; g < num_groups; ++g)
+  {
+    file << "M_GPRIME_G_VAL 0 " << g << " " << g << " 0.5\n";
+    if (g + 1 < num_groups)
+      file << "M_GPRIME_G_VAL 0 " << g << " " << g + 1 << " 0.2\n";
+  }
+  file << "TRANSFER_MOMENTS_END\n";
+
+  return path.string();
+}
+
+/// Makes material 0 with the synthetic cross sections and a unit source in the first group.
+void
+SetupMaterial(size_t num_groups)
+{
+  if (not material_stack.empty())
+    return;
+
+  const auto xs_file = WriteSyntheticXSFile(num_groups);
+  auto xs = std::make_shared<MultiGroupXS>();
+  xs->Initialize(xs_file);
+  std::filesystem::remove(xs_file);
+
+  auto source = std::make_shared<IsotropicMultiGroupSource>();
+  source->source_value_g.assign(num_groups, 0.0);
+  source->source_value_g[0] = 1.0;
+
+  auto material = std::make_shared<Material>();
+  material->name = "Benchmark material";
+  material->properties.push_back(xs);
+  material->properties.push_back(source);
+  material_stack.push_back(material);
+}
+
+/// Builds and initializes a one-groupset discrete ordinates solver on the 3D benchmark mesh.
+std::shared_ptr<DiscreteOrdinatesSolver>
+MakeSolver(BenchmarkContext& context, const std::string& sweep_type)
+{
+  const auto& options = context.Options();
+  context.OrthogonalMesh(3);
+  SetupMaterial(options.num_groups);
+
+  angular_quadrature_stack.push_back(
+    std::make_shared<AngularQuadratureProdGLC>(options.num_azimuthal, options.num_polar));
+
+  ParameterBlock groupset("0");
+  groupset.AddParameter("groups_from_to", std::vector<size_t>{0, options.num_groups - 1});
+  groupset.AddParameter("angular_quadrature_handle", angular_quadrature_stack.size() - 1);
+  groupset.AddParameter("inner_linear_method", std::string("classic_richardson"));
+  groupset.AddParameter("l_max_its", 1);
+
+  ParameterBlock groupsets("groupsets");
+  groupsets.ChangeToArray();
+  groupsets.AddParameter(groupset);
+
+  ParameterBlock solver_options("options");
+  solver_options.AddParameter("scattering_order", 0);
+  solver_options.AddParameter("verbose_inner_iterations", false);
+
+  ParameterBlock block;
+  block.AddParameter("num_groups", options.num_groups);
+  block.AddParameter(groupsets);
+  block.AddParameter("sweep_type", sweep_type);
+  block.AddParameter(solver_options);
+
+  auto params = DiscreteOrdinatesSolver::GetInputParameters();
+  params.AssignParameters(block);
+  auto solver = std::make_shared<DiscreteOrdinatesSolver>(params);
+  solver->Initialize();
+
+  return solver;
+}
+
+/// Times one transport sweep of all angles and groups with the given sweep type.
+void
+BenchmarkSweep(BenchmarkContext& context, const std::string& name, const std::string& sweep_type)
+{
+  const auto& options = context.Options();
+  auto solver = MakeSolver(context, sweep_type);
+  auto& groupset = solver->Groupsets().front();
+  auto& wgs_context = dynamic_cast<SweepWGSContext&>(solver->GetWGSContext(groupset.id));
+
+  // Sweep with a source that includes scattering from the initial flux
+  const auto source_flags = APPLY_FIXED_SOURCES | APPLY_WGS_SCATTER_SOURCES;
+  solver->GetActiveSetSourceFunction()(
+    groupset, solver->QMomentsLocal(), solver->PhiOldLocal(), source_flags);
+
+  const auto num_local_cells = solver->Grid().local_cells.size();
+  const auto num_angles = groupset.quadrature->omegas.size();
+  context.Measure(name,
+                  {{"mesh_size", static_cast<double>(options.mesh_size)},
+                   {"num_groups", static_cast<double>(options.num_groups)},
+                   {"num_angles", static_cast<double>(num_angles)}},
+                  num_local_cells * num_angles * options.num_groups,
+                  [&]
+                  {
+                    wgs_context.sweep_scheduler.ZeroOutputFluxDataStructures();
+                    wgs_context.sweep_scheduler.Sweep();
+                  });
+}
+
+void
+BenchmarkAahSweep(BenchmarkContext& context)
+{
+  BenchmarkSweep(context, "AahSweepChunk::Sweep", "AAH");
+}
+
+void
+BenchmarkCbcSweep(BenchmarkContext& context)
+{
+  BenchmarkSweep(context, "CbcSweepChunk::Sweep", "CBC");
+}
+
+/// Times the evaluation of the fixed and scattering sources of a groupset.
+void
+BenchmarkSourceFunction(BenchmarkContext& context)
+{
+  const auto& options = context.Options();
+  auto solver = MakeSolver(context, "AAH");
+  auto& groupset = solver->Groupsets().front();
+  auto set_source = solver->GetActiveSetSourceFunction();
+  auto& q = solver->QMomentsLocal();
+  const auto& phi = solver->PhiOldLocal();
+
+  const auto source_flags =
+    APPLY_FIXED_SOURCES | APPLY_WGS_SCATTER_SOURCES | APPLY_AGS_SCATTER_SOURCES;
+  context.Measure("SourceFunction::operator()",
+                  {{"mesh_size", static_cast<double>(options.mesh_size)},
+                   {"num_groups", static_cast<double>(options.num_groups)}},
+                  solver->Grid().local_cells.size() * options.num_groups,
+                  [&]
+                  {
+                    std::fill(q.begin(), q.end(), 0.0);
+                    set_source(groupset, q, phi, source_flags);
+                  });
+}
+
+} // namespace
+
+OpenSnRegisterBenchmark("AahSweepChunk::Sweep", BenchmarkAahSweep);
+OpenSnRegisterBenchmark("CbcSweepChunk::Sweep", BenchmarkCbcSweep);
+OpenSnRegisterBenchmark("SourceFunction::operator()", BenchmarkSourceFunction);
+
+} // namespace opensnbench
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "bench/benchmark.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include "mpicpp-lite/mpicpp-lite.h"
+#include "cxxopts/cxxopts.h"
+#include "petsc.h"
+#include <fstream>
+#include <iostream>
+
+namespace mpi = mpicpp_lite;
+using namespace opensn;
+using namespace opensnbench;
+
+namespace
+{
+
+/// Parses the command line. Returns false if the program should exit without benchmarking.
+bool
+ProcessArguments(int argc, char** argv, BenchmarkOptions& options, std::string& output_file)
+{
+  cxxopts::Options cl_options("opensn_bench", "Microbenchmarks of the OpenSn transport kernels");
+
+  /* clang-format off */
+  cl_options.add_options()
+  ("h,help",        "Help message")
+  ("list",          "List the available benchmarks")
+  ("f,filter",      "Only run benchmarks whose name contains this string",
+    cxxopts::value<std::string>()->default_value(""))
+  ("o,output",      "JSON output file", cxxopts::value<std::string>()->default_value("opensn_bench.json"))
+  ("n,mesh-size",   "Number of cells per dimension of the synthetic meshes",
+    cxxopts::value<size_t>()->default_value("16"))
+  ("g,groups",      "Number of energy groups", cxxopts::value<size_t>()->default_value("8"))
+  ("azimuthal",     "Azimuthal angles per octant", cxxopts::value<int>()->default_value("4"))
+  ("polar",         "Polar angles per octant", cxxopts::value<int>()->default_value("2"))
+  ("r,repetitions", "Timed repetitions per benchmark", cxxopts::value<size_t>()->default_value("10"))
+  ("warmup",        "Untimed repetitions per benchmark", cxxopts::value<size_t>()->default_value("1"))
+  ("seed",          "Seed of the pseudo-random inputs", cxxopts::value<unsigned int>()->default_value("1234"));
+  /* clang-format on */
+
+  auto result = cl_options.parse(argc, argv);
+
+  if (result.count("help"))
+  {
+    if (mpi_comm.rank() == 0)
+      std::cout << cl_options.help() << std::endl;
+    return false;
+  }
+
+  if (result.count("list"))
+  {
+    if (mpi_comm.rank() == 0)
+      for (const auto& [name, function] : BenchmarkRegistry())
+        std::cout << name << "\n";
+    return false;
+  }
+
+  options.filter = result["filter"].as<std::string>();
+  options.mesh_size = result["mesh-size"].as<size_t>();
+  options.num_groups = result["groups"].as<size_t>();
+  options.num_azimuthal = result["azimuthal"].as<int>();
+  options.num_polar = result["polar"].as<int>();
+  options.num_repetitions = result["repetitions"].as<size_t>();
+  options.num_warmup = result["warmup"].as<size_t>();
+  options.seed = result["seed"].as<unsigned int>();
+  output_file = result["output"].as<std::string>();
+
+  if (options.mesh_size == 0 or options.num_groups == 0 or options.num_repetitions == 0)
+    throw std::invalid_argument("The mesh size, group count and repetitions must be positive.");
+
+  return true;
+}
+
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+  mpi::Environment env(argc, argv);
+  opensn::mpi_comm = MPI_COMM_WORLD;
+
+  BenchmarkOptions options;
+  std::string output_file;
+  try
+  {
+    if (not ProcessArguments(argc, argv, options, output_file))
+      return 0;
+  }
+  catch (const std::exception& e)
+  {
+    if (mpi_comm.rank() == 0)
+      std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  PetscOptionsInsertString(nullptr, "-no_signal_handler");
+  PetscCall(PetscInitialize(&argc, &argv, nullptr, nullptr));
+  opensn::Initialize();
+
+  int error_code = 0;
+  BenchmarkContext context(options);
+  try
+  {
+    for (const auto& [name, function] : BenchmarkRegistry())
+    {
+      if (name.find(options.filter) == std::string::npos)
+        continue;
+      opensn::log.Log() << "Running benchmark " << name;
+      function(context);
+    }
+
+    if (mpi_comm.rank() == 0)
+    {
+      std::ofstream out(output_file);
+      if (not out.is_open())
+        throw std::runtime_error("Failed to open " + output_file + " for writing.");
+      WriteResultsJSON(out, options, context.Results());
+    }
+    opensn::log.Log() << "Wrote benchmark results to " << output_file;
+  }
+  catch (const std::exception& e)
+  {
+    opensn::log.LogAllError() << e.what();
+    error_code = 1;
+  }
+
+  opensn::Finalize();
+  PetscFinalize();
+
+  return error_code;
+}
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "bench/benchmark.h"
+#include "framework/math/dense_matrix.h"
+#include "framework/math/spatial_discretization/finite_element/piecewise_linear/piecewise_linear_discontinuous.h"
+#include "framework/math/unknown_manager/unknown_manager.h"
+#include "framework/math/vector_ghost_communicator/vector_ghost_communicator.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/runtime.h"
+#include <random>
+
+using namespace opensn;
+
+namespace opensnbench
+{
+
+namespace
+{
+
+/// Times the solution of dense systems of the sizes of the PWLD cell matrices.
+void
+BenchmarkGaussElimination(BenchmarkContext& context)
+{
+  // Node counts of slabs, triangles, quadrilaterals and tetrahedra, hexahedra, and polyhedra
+  const std::vector<unsigned int> sizes = {2, 3, 4, 8, 12, 20};
+  const size_t num_systems = 1000;
+
+  std::mt19937 generator(context.Options().seed);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  for (const auto n : sizes)
+  {
+    // Diagonally dominant systems so that elimination without pivoting is stable
+    std::vector<DenseMatrix<double>> matrices(num_systems, DenseMatrix<double>(n, n));
+    std::vector<Vector<double>> rhs(num_systems, Vector<double>(n));
+    for (size_t s = 0; s < num_systems; ++s)
+      for (unsigned int i = 0; i < n; ++i)
+      {
+        for (unsigned int j = 0; j < n; ++j)
+          matrices[s](i, j) = distribution(generator);
+        matrices[s](i, i) += static_cast<double>(n);
+        rhs[s](i) = distribution(generator);
+      }
+
+    auto A = matrices;
+    auto b = rhs;
+    context.Measure("GaussElimination",
+                    {{"num_nodes", static_cast<double>(n)}},
+                    num_systems,
+                    [&]
+                    {
+                      for (size_t s = 0; s < num_systems; ++s)
+                      {
+                        A[s] = matrices[s];
+                        b[s] = rhs[s];
+                        GaussElimination(A[s], b[s], n);
+                      }
+                      DoNotOptimize(b.back()(0));
+                    });
+  }
+}
+
+/// Times the ghost exchange of a multigroup PWLD vector on the 3D benchmark mesh.
+void
+BenchmarkCommunicateGhostEntries(BenchmarkContext& context)
+{
+  const auto& options = context.Options();
+  const auto& grid = context.OrthogonalMesh(3);
+  const auto sdm = PieceWiseLinearDiscontinuous::New(grid);
+
+  UnknownManager uk_man;
+  uk_man.AddUnknown(UnknownType::VECTOR_N, options.num_groups);
+
+  VectorGhostCommunicator communicator(sdm->GetNumLocalDOFs(uk_man),
+                                       sdm->GetNumGlobalDOFs(uk_man),
+                                       sdm->GetGhostDOFIndices(uk_man),
+                                       mpi_comm);
+  auto ghosted_vector = communicator.MakeGhostedVector();
+  for (size_t i = 0; i < communicator.LocalSize(); ++i)
+    ghosted_vector[i] = static_cast<double>(i);
+
+  context.Measure("VectorGhostCommunicator::CommunicateGhostEntries",
+                  {{"mesh_size", static_cast<double>(options.mesh_size)},
+                   {"num_groups", static_cast<double>(options.num_groups)}},
+                  communicator.NumGhosts(),
+                  [&] { communicator.CommunicateGhostEntries(ghosted_vector); });
+}
+
+/// Times the mapping of all local nodes and groups to global dof indices.
+void
+BenchmarkMapDOF(BenchmarkContext& context)
+{
+  const auto& options = context.Options();
+  const auto& grid = context.OrthogonalMesh(3);
+  const auto sdm = PieceWiseLinearDiscontinuous::New(grid);
+
+  UnknownManager uk_man;
+  uk_man.AddUnknown(UnknownType::VECTOR_N, options.num_groups);
+  const auto num_groups = static_cast<unsigned int>(options.num_groups);
+
+  context.Measure("PieceWiseLinearDiscontinuous::MapDOF",
+                  {{"mesh_size", static_cast<double>(options.mesh_size)},
+                   {"num_groups", static_cast<double>(options.num_groups)}},
+                  sdm->GetNumLocalDOFs(uk_man),
+                  [&]
+                  {
+                    int64_t checksum = 0;
+                    for (const auto& cell : grid.local_cells)
+                    {
+                      const size_t num_nodes = sdm->GetCellNumNodes(cell);
+                      for (size_t i = 0; i < num_nodes; ++i)
+                        for (unsigned int g = 0; g < num_groups; ++g)
+                          checksum += sdm->MapDOF(cell, i, uk_man, 0, g);
+                    }
+                    DoNotOptimize(static_cast<double>(checksum));
+                  });
+}
+
+} // namespace
+
+OpenSnRegisterBenchmark("GaussElimination", BenchmarkGaussElimination);
+OpenSnRegisterBenchmark("VectorGhostCommunicator::CommunicateGhostEntries",
+                        BenchmarkCommunicateGhostEntries);
+OpenSnRegisterBenchmark("PieceWiseLinearDiscontinuous::MapDOF", BenchmarkMapDOF);
+
+} // namespace opensnbench
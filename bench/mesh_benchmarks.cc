@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "bench/benchmark.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include <random>
+
+using namespace opensn;
+
+namespace opensnbench
+{
+
+namespace
+{
+
+/**
+ * Times point-in-cell queries on the 2D and 3D benchmark meshes. Each cell is queried with points
+ * near its centroid, half of which lie outside the cell.
+ */
+void
+BenchmarkCheckPointInsideCell(BenchmarkContext& context)
+{
+  const auto& options = context.Options();
+  const size_t points_per_cell = 8;
+  const double cell_width = 1.0 / static_cast<double>(options.mesh_size);
+
+  for (const unsigned int dimension : {2u, 3u})
+  {
+    const auto& grid = context.OrthogonalMesh(dimension);
+
+    std::mt19937 generator(options.seed);
+    std::uniform_real_distribution<double> distribution(-cell_width, cell_width);
+    std::vector<Vector3> points;
+    points.reserve(grid.local_cells.size() * points_per_cell);
+    for (const auto& cell : grid.local_cells)
+      for (size_t p = 0; p < points_per_cell; ++p)
+      {
+        Vector3 offset(distribution(generator), distribution(generator), 0.0);
+        if (dimension == 3)
+          offset.z = distribution(generator);
+        points.push_back(cell.centroid + offset);
+      }
+
+    context.Measure("MeshContinuum::CheckPointInsideCell",
+                    {{"dimension", static_cast<double>(dimension)},
+                     {"mesh_size", static_cast<double>(options.mesh_size)}},
+                    points.size(),
+                    [&]
+                    {
+                      size_t num_inside = 0;
+                      size_t p = 0;
+                      for (const auto& cell : grid.local_cells)
+                        for (size_t i = 0; i < points_per_cell; ++i)
+                          if (grid.CheckPointInsideCell(cell, points[p++]))
+                            ++num_inside;
+                      DoNotOptimize(static_cast<double>(num_inside));
+                    });
+  }
+}
+
+} // namespace
+
+OpenSnRegisterBenchmark("MeshContinuum::CheckPointInsideCell", BenchmarkCheckPointInsideCell);
+
+} // namespace opensnbench
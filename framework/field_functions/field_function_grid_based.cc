@@ -17,6 +17,7 @@
 #include <vtkCellData.h>
 #include <vtkPointData.h>
 #include <vtkDoubleArray.h>
+#include <algorithm>
 
 namespace opensn
 {
@@ -49,7 +50,7 @@ FieldFunctionGridBased::GetInputParameters()
 FieldFunctionGridBased::FieldFunctionGridBased(const InputParameters& params)
   : FieldFunction(params),
     discretization_(MakeSpatialDiscretization(params)),
-    ghosted_field_vector_(MakeFieldVector(*discretization_, GetUnknownManager())),
+    ghosted_field_vector_(MakeFieldVector(discretization_, GetUnknownManager())),
     local_grid_bounding_box_(GetCurrentMesh()->GetLocalBoundingBox())
 {
   ghosted_field_vector_->Set(params.GetParamValue<double>("initial_value"));
@@ -59,7 +60,7 @@ FieldFunctionGridBased::FieldFunctionGridBased(
   std::string name, std::shared_ptr<SpatialDiscretization>& discretization_ptr, Unknown unknown)
   : FieldFunction(std::move(name), std::move(unknown)),
     discretization_(discretization_ptr),
-    ghosted_field_vector_(MakeFieldVector(*discretization_, GetUnknownManager())),
+    ghosted_field_vector_(MakeFieldVector(discretization_, GetUnknownManager())),
     local_grid_bounding_box_(discretization_->Grid().GetLocalBoundingBox())
 {
 }
@@ -71,7 +72,7 @@ FieldFunctionGridBased::FieldFunctionGridBased(
   const std::vector<double>& field_vector)
   : FieldFunction(std::move(name), std::move(unknown)),
     discretization_(discretization_ptr),
-    ghosted_field_vector_(MakeFieldVector(*discretization_, GetUnknownManager())),
+    ghosted_field_vector_(MakeFieldVector(discretization_, GetUnknownManager())),
     local_grid_bounding_box_(discretization_->Grid().GetLocalBoundingBox())
 {
   OpenSnInvalidArgumentIf(field_vector.size() != ghosted_field_vector_->LocalSize(),
@@ -87,7 +88,7 @@ FieldFunctionGridBased::FieldFunctionGridBased(
   double field_value)
   : FieldFunction(std::move(name), std::move(unknown)),
     discretization_(discretization_ptr),
-    ghosted_field_vector_(MakeFieldVector(*discretization_, GetUnknownManager())),
+    ghosted_field_vector_(MakeFieldVector(discretization_, GetUnknownManager())),
     local_grid_bounding_box_(discretization_->Grid().GetLocalBoundingBox())
 {
   ghosted_field_vector_->Set(field_value);
@@ -117,6 +118,12 @@ FieldFunctionGridBased::GetGhostedFieldVector() const
   return ghosted_field_vector_->LocalSTLData();
 }
 
+const std::vector<double>&
+FieldFunctionGridBased::GetGhostedFieldData() const
+{
+  return ghosted_field_vector_->LocalSTLData();
+}
+
 void
 FieldFunctionGridBased::UpdateFieldVector(const std::vector<double>& field_vector)
 {
@@ -135,6 +142,23 @@ FieldFunctionGridBased::UpdateFieldVector(const Vec& field_vector)
   ghosted_field_vector_->CommunicateGhostEntries();
 }
 
+void
+FieldFunctionGridBased::UpdateFieldVector(const std::vector<double>& source,
+                                          size_t offset,
+                                          size_t stride)
+{
+  const auto local_size = ghosted_field_vector_->LocalSize();
+  OpenSnInvalidArgumentIf(stride == 0, "The stride must be positive.");
+  OpenSnInvalidArgumentIf(local_size > 0 and offset + (local_size - 1) * stride >= source.size(),
+                          "Attempted update with a vector of insufficient size.");
+
+  auto& values = ghosted_field_vector_->LocalSTLData();
+  for (size_t k = 0; k < local_size; ++k)
+    values[k] = source[offset + k * stride];
+
+  ghosted_field_vector_->CommunicateGhostEntries();
+}
+
 std::vector<double>
 FieldFunctionGridBased::GetPointValue(const Vector3& point) const
 {
@@ -376,15 +400,41 @@ FieldFunctionGridBased::MakeSpatialDiscretization(const InputParameters& params)
 }
 
 std::unique_ptr<GhostedParallelSTLVector>
-FieldFunctionGridBased::MakeFieldVector(const SpatialDiscretization& discretization,
-                                        const UnknownManager& uk_man)
+FieldFunctionGridBased::MakeFieldVector(
+  const std::shared_ptr<SpatialDiscretization>& discretization, const UnknownManager& uk_man)
 {
-  auto field = std::make_unique<GhostedParallelSTLVector>(discretization.GetNumLocalDOFs(uk_man),
-                                                          discretization.GetNumGlobalDOFs(uk_man),
-                                                          discretization.GetGhostDOFIndices(uk_man),
-                                                          mpi_comm);
-
-  return field;
+  // Field functions on the same discretization with the same unknown structure share their
+  // ghost communication pattern, which is only set up for the first of them. Solvers can create
+  // hundreds of such field functions.
+  struct GhostCommunicatorCacheEntry
+  {
+    std::weak_ptr<SpatialDiscretization> discretization;
+    size_t num_components;
+    UnknownStorageType storage_type;
+    std::shared_ptr<VectorGhostCommunicator> ghost_comm;
+  };
+  static std::vector<GhostCommunicatorCacheEntry> ghost_comm_cache;
+
+  ghost_comm_cache.erase(std::remove_if(ghost_comm_cache.begin(),
+                                        ghost_comm_cache.end(),
+                                        [](const GhostCommunicatorCacheEntry& entry)
+                                        { return entry.discretization.expired(); }),
+                         ghost_comm_cache.end());
+
+  const auto num_components = uk_man.GetTotalUnknownStructureSize();
+  for (const auto& entry : ghost_comm_cache)
+    if (entry.discretization.lock() == discretization and
+        entry.num_components == num_components and entry.storage_type == uk_man.dof_storage_type)
+      return std::make_unique<GhostedParallelSTLVector>(*entry.ghost_comm);
+
+  auto ghost_comm =
+    std::make_shared<VectorGhostCommunicator>(discretization->GetNumLocalDOFs(uk_man),
+                                              discretization->GetNumGlobalDOFs(uk_man),
+                                              discretization->GetGhostDOFIndices(uk_man),
+                                              mpi_comm);
+  ghost_comm_cache.push_back({discretization, num_components, uk_man.dof_storage_type, ghost_comm});
+
+  return std::make_unique<GhostedParallelSTLVector>(*ghost_comm);
 }
 
 } // namespace opensn
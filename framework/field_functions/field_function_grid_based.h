@@ -8,6 +8,7 @@
 #include "framework/math/parallel_vector/ghosted_parallel_stl_vector.h"
 #include <string>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <utility>
 
@@ -59,12 +60,22 @@ public:
   /// Makes a copy of the locally stored data with ghost access.
   std::vector<double> GetGhostedFieldVector() const;
 
+  /// Returns a read-only reference to the locally stored data with ghost access.
+  const std::vector<double>& GetGhostedFieldData() const;
+
   /// Updates the field vector with a local STL vector.
   void UpdateFieldVector(const std::vector<double>& field_vector);
 
   /// Updates the field vector with a PETSc vector. This only operates locally.
   void UpdateFieldVector(const Vec& field_vector);
 
+  /**
+   * Updates the field vector with a strided range of a local STL vector: local entry k of the
+   * field vector is set to `source[offset + k * stride]`. The ghost entries are communicated, so
+   * this must be called on all processes.
+   */
+  void UpdateFieldVector(const std::vector<double>& source, size_t offset, size_t stride);
+
   /// Returns the component values at requested point.
   virtual std::vector<double> GetPointValue(const Vector3& point) const;
 
@@ -84,6 +95,23 @@ public:
   ExportMultipleToVTK(const std::string& file_base_name,
                       const std::vector<std::shared_ptr<const FieldFunctionGridBased>>& ff_list);
 
+  /**
+   * Exports multiple field functions to a single HDF5 file, `<file_base_name>.h5`, that is written
+   * by all processes, together with an XDMF index, `<file_base_name>.xmf`, for ParaView and VisIt.
+   * The first export with a given file base writes the mesh; every export appends the field data
+   * as a new time step. Each process writes every array as one contiguous block. Requires HDF5
+   * with parallel support.
+   *
+   * \param file_base_name Base name of the `.h5` and `.xmf` files.
+   * \param ff_list Field functions to export. They must be based on the same grid.
+   * \param time Time of the step. Defaults to the step index.
+   * \param single_precision Stores the field data as 32-bit floats when true.
+   */
+  static void ExportMultipleToXDMF(const std::string& file_base_name,
+                                   const FFList& ff_list,
+                                   std::optional<double> time = std::nullopt,
+                                   bool single_precision = false);
+
 private:
   /// Static method for making the GetSpatialDiscretization for the constructors.
   static std::shared_ptr<SpatialDiscretization>
@@ -91,7 +119,8 @@ private:
 
   /// Private method for creating the field vector.
   static std::unique_ptr<GhostedParallelSTLVector>
-  MakeFieldVector(const SpatialDiscretization& discretization, const UnknownManager& uk_man);
+  MakeFieldVector(const std::shared_ptr<SpatialDiscretization>& discretization,
+                  const UnknownManager& uk_man);
 };
 
 } // namespace opensn
@@ -0,0 +1,547 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/field_functions/field_function_grid_based.h"
+#include "framework/math/spatial_discretization/spatial_discretization.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mpi/mpi_utils.h"
+#include "framework/utils/hdf_utils.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <fstream>
+#include <iomanip>
+#include <map>
+
+namespace opensn
+{
+
+#ifdef H5_HAVE_PARALLEL
+namespace
+{
+
+/// Cell type codes of XDMF mixed topologies
+enum XdmfCellType : int64_t
+{
+  XDMF_POLYLINE = 2,
+  XDMF_POLYGON = 3,
+  XDMF_TRIANGLE = 4,
+  XDMF_QUADRILATERAL = 5,
+  XDMF_TETRAHEDRON = 6,
+  XDMF_PYRAMID = 7,
+  XDMF_WEDGE = 8,
+  XDMF_HEXAHEDRON = 9,
+  XDMF_POLYHEDRON = 16
+};
+
+struct XdmfAttribute
+{
+  std::string name;
+  bool cell_centered = false;
+  /// Number of bytes per value
+  int precision = 8;
+};
+
+struct XdmfStep
+{
+  double time = 0.0;
+  std::vector<XdmfAttribute> attributes;
+};
+
+/// State of an XDMF time series. The mesh is written with the first step.
+struct XdmfSeries
+{
+  const MeshContinuum* grid = nullptr;
+  uint64_t num_points = 0;
+  uint64_t num_cells = 0;
+  uint64_t topology_size = 0;
+  /// Offsets of this process' points and cells in the global arrays
+  uint64_t point_offset = 0;
+  uint64_t cell_offset = 0;
+  uint64_t num_local_points = 0;
+  std::vector<XdmfStep> steps;
+};
+
+/// Series that have been written during this run, by file base name
+std::map<std::string, XdmfSeries> xdmf_series;
+
+/**
+ * Appends the XDMF mixed-topology entry of a cell. Every cell has its own copy of its vertices
+ * (as in the discontinuous VTK export), numbered consecutively from `first_point`.
+ */
+void
+AppendCellTopology(const Cell& cell, int64_t first_point, std::vector<int64_t>& topology)
+{
+  const size_t num_verts = cell.vertex_ids.size();
+
+  if (cell.Type() == CellType::SLAB)
+  {
+    topology.push_back(XDMF_POLYLINE);
+    topology.push_back(static_cast<int64_t>(num_verts));
+  }
+  else if (cell.Type() == CellType::POLYGON)
+  {
+    switch (cell.SubType())
+    {
+      case CellType::TRIANGLE:
+        topology.push_back(XDMF_TRIANGLE);
+        break;
+      case CellType::QUADRILATERAL:
+        topology.push_back(XDMF_QUADRILATERAL);
+        break;
+      default:
+        topology.push_back(XDMF_POLYGON);
+        topology.push_back(static_cast<int64_t>(num_verts));
+        break;
+    }
+  }
+  else if (cell.Type() == CellType::POLYHEDRON)
+  {
+    switch (cell.SubType())
+    {
+      case CellType::TETRAHEDRON:
+        topology.push_back(XDMF_TETRAHEDRON);
+        break;
+      case CellType::PYRAMID:
+        topology.push_back(XDMF_PYRAMID);
+        break;
+      case CellType::WEDGE:
+        topology.push_back(XDMF_WEDGE);
+        break;
+      case CellType::HEXAHEDRON:
+        topology.push_back(XDMF_HEXAHEDRON);
+        break;
+      default:
+      {
+        // Polyhedra are described by their faces
+        topology.push_back(XDMF_POLYHEDRON);
+        topology.push_back(static_cast<int64_t>(cell.faces.size()));
+        for (const auto& face : cell.faces)
+        {
+          topology.push_back(static_cast<int64_t>(face.vertex_ids.size()));
+          for (const auto vid : face.vertex_ids)
+          {
+            size_t v = 0;
+            for (size_t cv = 0; cv < num_verts; ++cv)
+              if (cell.vertex_ids[cv] == vid)
+              {
+                v = cv;
+                break;
+              }
+            topology.push_back(first_point + static_cast<int64_t>(v));
+          }
+        }
+        return;
+      }
+    }
+  }
+  else
+    throw std::logic_error("Unsupported cell type for XDMF export.");
+
+  for (size_t v = 0; v < num_verts; ++v)
+    topology.push_back(first_point + static_cast<int64_t>(v));
+}
+
+/// Returns true on all processes if `local_succeeded` is true on all processes. Collective.
+bool
+AllSucceeded(bool local_succeeded)
+{
+  bool global_succeeded = false;
+  mpi_comm.all_reduce(local_succeeded, global_succeeded, mpi::op::logical_and<bool>());
+  return global_succeeded;
+}
+
+/**
+ * Creates a dataset with `num_global_rows` rows of `num_cols` values and collectively writes this
+ * process' rows, which start at `row_offset`, from `data`. The values are converted from T to
+ * `file_type` by HDF5 during the write.
+ */
+template <typename T>
+bool
+H5WriteBlock(hid_t location,
+             const std::string& name,
+             hid_t file_type,
+             const T* data,
+             hsize_t num_local_rows,
+             hsize_t row_offset,
+             hsize_t num_global_rows,
+             hsize_t num_cols = 1)
+{
+  const int rank = num_cols > 1 ? 2 : 1;
+  const hsize_t dims[2] = {num_global_rows, num_cols};
+  hid_t file_space = H5Screate_simple(rank, dims, nullptr);
+  hid_t dataset = H5Dcreate2(
+    location, name.c_str(), file_type, file_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  // A process that failed to create the dataset must not leave the others in the collective write
+  if (not AllSucceeded(dataset >= 0))
+  {
+    if (dataset >= 0)
+      H5Dclose(dataset);
+    H5Sclose(file_space);
+    return false;
+  }
+
+  const hsize_t num_values = num_local_rows * num_cols;
+  hid_t mem_space = H5Screate_simple(1, &num_values, nullptr);
+  if (num_values == 0)
+  {
+    H5Sselect_none(file_space);
+    H5Sselect_none(mem_space);
+  }
+  else
+  {
+    const hsize_t start[2] = {row_offset, 0};
+    const hsize_t count[2] = {num_local_rows, num_cols};
+    H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, nullptr, count, nullptr);
+  }
+
+  hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+  const bool succeeded =
+    H5Dwrite(dataset, get_datatype<T>(), mem_space, file_space, dxpl, data) >= 0;
+  H5Pclose(dxpl);
+  H5Sclose(mem_space);
+  H5Dclose(dataset);
+  H5Sclose(file_space);
+
+  return succeeded;
+}
+
+/// Writes the points, topology, material ids and partition ids of the local cells.
+bool
+H5WriteXdmfMesh(hid_t file, const MeshContinuum& grid, XdmfSeries& series)
+{
+  std::vector<double> points;
+  std::vector<int64_t> topology;
+  std::vector<int> material_ids;
+  std::vector<int> partition_ids;
+  material_ids.reserve(grid.local_cells.size());
+  partition_ids.reserve(grid.local_cells.size());
+
+  size_t num_local_points = 0;
+  for (const auto& cell : grid.local_cells)
+    num_local_points += cell.vertex_ids.size();
+  points.reserve(3 * num_local_points);
+
+  // Offsets of this process' cells and points
+  const auto cell_extents = BuildLocationExtents(grid.local_cells.size(), mpi_comm);
+  const auto point_extents = BuildLocationExtents(num_local_points, mpi_comm);
+  series.num_cells = cell_extents.back();
+  series.num_points = point_extents.back();
+  series.cell_offset = cell_extents[opensn::mpi_comm.rank()];
+  series.point_offset = point_extents[opensn::mpi_comm.rank()];
+  series.num_local_points = num_local_points;
+
+  auto point_counter = static_cast<int64_t>(series.point_offset);
+  for (const auto& cell : grid.local_cells)
+  {
+    for (const auto vid : cell.vertex_ids)
+    {
+      const auto& vertex = grid.vertices[vid];
+      points.push_back(vertex.x);
+      points.push_back(vertex.y);
+      points.push_back(vertex.z);
+    }
+    AppendCellTopology(cell, point_counter, topology);
+    point_counter += static_cast<int64_t>(cell.vertex_ids.size());
+
+    material_ids.push_back(cell.material_id);
+    partition_ids.push_back(static_cast<int>(cell.partition_id));
+  }
+
+  const auto topology_extents = BuildLocationExtents(topology.size(), mpi_comm);
+  series.topology_size = topology_extents.back();
+
+  hid_t group = H5Gcreate2(file, "mesh", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  if (not AllSucceeded(group >= 0))
+  {
+    if (group >= 0)
+      H5Gclose(group);
+    return false;
+  }
+
+  const auto rank = opensn::mpi_comm.rank();
+  bool succeeded = H5WriteBlock<double>(group,
+                                        "geometry",
+                                        H5T_NATIVE_DOUBLE,
+                                        points.data(),
+                                        num_local_points,
+                                        series.point_offset,
+                                        series.num_points,
+                                        3);
+  succeeded = H5WriteBlock<int64_t>(group,
+                                    "topology",
+                                    H5T_NATIVE_INT64,
+                                    topology.data(),
+                                    topology.size(),
+                                    topology_extents[rank],
+                                    series.topology_size) and
+              succeeded;
+  succeeded = H5WriteBlock<int>(group,
+                                "material",
+                                H5T_NATIVE_INT,
+                                material_ids.data(),
+                                material_ids.size(),
+                                series.cell_offset,
+                                series.num_cells) and
+              succeeded;
+  succeeded = H5WriteBlock<int>(group,
+                                "partition",
+                                H5T_NATIVE_INT,
+                                partition_ids.data(),
+                                partition_ids.size(),
+                                series.cell_offset,
+                                series.num_cells) and
+              succeeded;
+
+  return H5Gclose(group) >= 0 and succeeded;
+}
+
+/// Writes a scalar attribute entry of the XDMF index.
+void
+WriteXdmfAttribute(std::ofstream& file,
+                   const std::string& h5_file_name,
+                   const std::string& name,
+                   const std::string& path,
+                   bool cell_centered,
+                   const std::string& number_type,
+                   int precision,
+                   uint64_t num_values)
+{
+  file << "        <Attribute Name=\"" << name << "\" AttributeType=\"Scalar\" Center=\""
+       << (cell_centered ? "Cell" : "Node") << "\">\n"
+       << "          <DataItem Dimensions=\"" << num_values << "\" NumberType=\"" << number_type
+       << "\" Precision=\"" << precision << "\" Format=\"HDF\">" << h5_file_name << ":" << path
+       << "</DataItem>\n"
+       << "        </Attribute>\n";
+}
+
+/// Rewrites the XDMF index of a series with all of its steps.
+void
+WriteXdmfIndex(const std::string& file_base_name, const XdmfSeries& series)
+{
+  // Data paths in the index are relative to the index file
+  std::string h5_file_name = file_base_name + ".h5";
+  const auto slash = h5_file_name.find_last_of('/');
+  if (slash != std::string::npos)
+    h5_file_name = h5_file_name.substr(slash + 1);
+
+  std::ofstream file(file_base_name + ".xmf");
+  if (not file.is_open())
+    throw std::runtime_error("Failed to open " + file_base_name + ".xmf for writing.");
+
+  file << std::setprecision(16);
+  file << "<?xml version=\"1.0\" ?>\n"
+       << "<Xdmf Version=\"3.0\">\n"
+       << "  <Domain>\n"
+       << "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+
+  for (size_t step = 0; step < series.steps.size(); ++step)
+  {
+    const auto& xdmf_step = series.steps[step];
+    file << "      <Grid Name=\"step_" << step << "\" GridType=\"Uniform\">\n"
+         << "        <Time Value=\"" << xdmf_step.time << "\"/>\n"
+         << "        <Topology TopologyType=\"Mixed\" NumberOfElements=\"" << series.num_cells
+         << "\">\n"
+         << "          <DataItem Dimensions=\"" << series.topology_size
+         << "\" NumberType=\"Int\" Precision=\"8\" Format=\"HDF\">" << h5_file_name
+         << ":/mesh/topology</DataItem>\n"
+         << "        </Topology>\n"
+         << "        <Geometry GeometryType=\"XYZ\">\n"
+         << "          <DataItem Dimensions=\"" << series.num_points
+         << " 3\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">" << h5_file_name
+         << ":/mesh/geometry</DataItem>\n"
+         << "        </Geometry>\n";
+
+    WriteXdmfAttribute(
+      file, h5_file_name, "Material", "/mesh/material", true, "Int", 4, series.num_cells);
+    WriteXdmfAttribute(
+      file, h5_file_name, "Partition", "/mesh/partition", true, "Int", 4, series.num_cells);
+
+    const std::string step_path = "/step_" + std::to_string(step) + "/";
+    for (const auto& attribute : xdmf_step.attributes)
+    {
+      const std::string path =
+        step_path + attribute.name + (attribute.cell_centered ? "_cell" : "_node");
+      WriteXdmfAttribute(file,
+                         h5_file_name,
+                         attribute.name,
+                         path,
+                         attribute.cell_centered,
+                         "Float",
+                         attribute.precision,
+                         attribute.cell_centered ? series.num_cells : series.num_points);
+    }
+
+    file << "      </Grid>\n";
+  }
+
+  file << "    </Grid>\n"
+       << "  </Domain>\n"
+       << "</Xdmf>\n";
+}
+
+} // namespace
+#endif
+
+void
+FieldFunctionGridBased::ExportMultipleToXDMF(const std::string& file_base_name,
+                                             const FFList& ff_list,
+                                             std::optional<double> time,
+                                             bool single_precision)
+{
+  const std::string fname = "FieldFunctionGridBased::ExportMultipleToXDMF";
+  log.Log() << "Exporting field functions to XDMF with file base \"" << file_base_name << "\"";
+
+  if (ff_list.empty())
+    throw std::logic_error(fname + ": Cannot be used with empty field-function list");
+
+  const auto& master_ff_ptr = ff_list.front();
+  for (const auto& ff_ptr : ff_list)
+    if (ff_ptr != master_ff_ptr)
+      if (&ff_ptr->discretization_->Grid() != &master_ff_ptr->discretization_->Grid())
+        throw std::logic_error(fname +
+                               ": Cannot be used with field functions based on different grids.");
+
+#ifndef H5_HAVE_PARALLEL
+  throw std::logic_error(fname + ": OpenSn was built without parallel HDF5 support.");
+#else
+  const auto& grid = master_ff_ptr->discretization_->Grid();
+  const std::string h5_file_name = file_base_name + ".h5";
+
+  // The first export of a series, or an export on a different grid, starts a new file
+  auto& series = xdmf_series[file_base_name];
+  const bool new_series = series.grid != &grid;
+  if (new_series)
+  {
+    series = XdmfSeries();
+    series.grid = &grid;
+  }
+
+  hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(fapl, mpi_comm, MPI_INFO_NULL);
+  hid_t file = new_series ? H5Fcreate(h5_file_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl)
+                          : H5Fopen(h5_file_name.c_str(), H5F_ACC_RDWR, fapl);
+  H5Pclose(fapl);
+
+  if (not AllSucceeded(file >= 0))
+  {
+    if (file >= 0)
+      H5Fclose(file);
+    xdmf_series.erase(file_base_name);
+    throw std::runtime_error(fname + ": Failed to open " + h5_file_name + ".");
+  }
+
+  bool succeeded = true;
+  if (new_series)
+    succeeded = H5WriteXdmfMesh(file, grid, series);
+
+  const size_t step = series.steps.size();
+  XdmfStep xdmf_step;
+  xdmf_step.time = time.value_or(static_cast<double>(step));
+
+  const std::string group_name = "step_" + std::to_string(step);
+  hid_t group = H5Gcreate2(file, group_name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  succeeded = group >= 0 and succeeded;
+
+  const hid_t file_type = single_precision ? H5T_NATIVE_FLOAT : H5T_NATIVE_DOUBLE;
+  const int precision = single_precision ? 4 : 8;
+
+  std::vector<double> point_values;
+  std::vector<double> cell_values;
+  std::vector<int64_t> point_dofs;
+  for (const auto& ff_ptr : ff_list)
+  {
+    const auto& field_vector = ff_ptr->GetGhostedFieldData();
+    const auto& uk_man = ff_ptr->GetUnknownManager();
+    const auto& unknown = ff_ptr->GetUnknown();
+    const auto& sdm = *ff_ptr->discretization_;
+    const size_t num_comps = unknown.NumComponents();
+
+    for (uint c = 0; c < num_comps; ++c)
+    {
+      std::string component_name = ff_ptr->Name() + unknown.name;
+      if (num_comps > 1)
+        component_name += unknown.component_names[c];
+
+      // Nodal values are written per cell vertex. When the field has one node per vertex and the
+      // local dofs are numbered in the same order, the field vector is written without staging.
+      point_dofs.clear();
+      cell_values.clear();
+      bool nodal = true;
+      for (const auto& cell : grid.local_cells)
+      {
+        const size_t num_nodes = sdm.GetCellNumNodes(cell);
+        nodal = nodal and num_nodes == cell.vertex_ids.size();
+
+        double node_average = 0.0;
+        for (size_t n = 0; n < num_nodes; ++n)
+        {
+          const int64_t dof = sdm.MapDOFLocal(cell, n, uk_man, 0, c);
+          point_dofs.push_back(dof);
+          node_average += field_vector[dof];
+        }
+        cell_values.push_back(node_average / static_cast<double>(num_nodes));
+      }
+
+      bool in_order = nodal;
+      for (size_t i = 0; in_order and i < point_dofs.size(); ++i)
+        in_order = point_dofs[i] == static_cast<int64_t>(i);
+
+      const double* point_data = field_vector.data();
+      if (not in_order)
+      {
+        point_values.clear();
+        size_t node_counter = 0;
+        for (const auto& cell : grid.local_cells)
+        {
+          const size_t num_nodes = sdm.GetCellNumNodes(cell);
+          if (num_nodes == cell.vertex_ids.size())
+            for (size_t n = 0; n < num_nodes; ++n)
+              point_values.push_back(field_vector[point_dofs[node_counter + n]]);
+          else
+            point_values.insert(
+              point_values.end(), cell.vertex_ids.size(), cell_values[cell.local_id]);
+          node_counter += num_nodes;
+        }
+        point_data = point_values.data();
+      }
+
+      succeeded = H5WriteBlock<double>(group,
+                                       component_name + "_node",
+                                       file_type,
+                                       point_data,
+                                       series.num_local_points,
+                                       series.point_offset,
+                                       series.num_points) and
+                  succeeded;
+      succeeded = H5WriteBlock<double>(group,
+                                       component_name + "_cell",
+                                       file_type,
+                                       cell_values.data(),
+                                       cell_values.size(),
+                                       series.cell_offset,
+                                       series.num_cells) and
+                  succeeded;
+
+      xdmf_step.attributes.push_back({component_name, false, precision});
+      xdmf_step.attributes.push_back({component_name, true, precision});
+    } // for component
+  }   // for ff_ptr
+
+  if (group >= 0)
+    succeeded = H5Gclose(group) >= 0 and succeeded;
+  succeeded = H5Fclose(file) >= 0 and succeeded;
+
+  if (not AllSucceeded(succeeded))
+    throw std::runtime_error(fname + ": Failed to write field functions to " + h5_file_name + ".");
+
+  series.steps.push_back(std::move(xdmf_step));
+  if (opensn::mpi_comm.rank() == 0)
+    WriteXdmfIndex(file_base_name, series);
+
+  log.Log() << "Done exporting field functions to XDMF.";
+  opensn::mpi_comm.barrier();
+#endif
+}
+
+} // namespace opensn
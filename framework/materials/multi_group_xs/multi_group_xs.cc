@@ -3,6 +3,7 @@
 
 #include "framework/materials/multi_group_xs/multi_group_xs.h"
 #include "framework/logging/log.h"
+#include <numeric>
 
 namespace opensn
 {
@@ -208,6 +209,97 @@ MultiGroupXS::Initialize(std::vector<std::pair<int, double>>& combinations)
   ComputeDiffusionParameters();
 }
 
+void
+MultiGroupXS::Initialize(const MultiGroupXS& xs_lower, const MultiGroupXS& xs_upper, double weight)
+{
+  Reset();
+
+  OpenSnLogicalErrorIf(xs_lower.num_groups_ != xs_upper.num_groups_,
+                       "Cross sections being interpolated must have the same group structure.");
+  OpenSnLogicalErrorIf(xs_lower.is_fissionable_ != xs_upper.is_fissionable_ or
+                         xs_lower.num_precursors_ != xs_upper.num_precursors_,
+                       "Cross sections being interpolated must have the same fission data.");
+  OpenSnLogicalErrorIf(weight < 0.0 or weight > 1.0,
+                       "The interpolation weight must be in the range [0, 1].");
+
+  const double w_lo = 1.0 - weight;
+  const double w_hi = weight;
+  auto Interpolate = [w_lo, w_hi](const std::vector<double>& lo, const std::vector<double>& hi)
+  {
+    std::vector<double> result(lo.size(), 0.0);
+    for (size_t i = 0; i < lo.size(); ++i)
+      result[i] = w_lo * lo[i] + w_hi * hi[i];
+    return result;
+  };
+
+  num_groups_ = xs_lower.num_groups_;
+  scattering_order_ = std::max(xs_lower.scattering_order_, xs_upper.scattering_order_);
+  num_precursors_ = xs_lower.num_precursors_;
+  is_fissionable_ = xs_lower.is_fissionable_;
+  temperature_ = w_lo * xs_lower.temperature_ + w_hi * xs_upper.temperature_;
+  e_bounds_ = xs_lower.e_bounds_;
+
+  sigma_t_ = Interpolate(xs_lower.sigma_t_, xs_upper.sigma_t_);
+  sigma_a_ = Interpolate(xs_lower.sigma_a_, xs_upper.sigma_a_);
+  if (not xs_lower.inv_velocity_.empty() and not xs_upper.inv_velocity_.empty())
+    inv_velocity_ = Interpolate(xs_lower.inv_velocity_, xs_upper.inv_velocity_);
+
+  // The sparsity patterns of the two transfer matrices need not agree, so the scaled
+  // entries of each are added into a matrix with the union of both patterns.
+  if (not xs_lower.transfer_matrices_.empty() or not xs_upper.transfer_matrices_.empty())
+  {
+    transfer_matrices_.assign(scattering_order_ + 1, SparseMatrix(num_groups_, num_groups_));
+    for (const auto& [xs, w] : {std::make_pair(&xs_lower, w_lo), std::make_pair(&xs_upper, w_hi)})
+      for (size_t m = 0; m < xs->transfer_matrices_.size(); ++m)
+        for (size_t g = 0; g < num_groups_; ++g)
+        {
+          const auto& cols = xs->transfer_matrices_[m].rowI_indices[g];
+          const auto& vals = xs->transfer_matrices_[m].rowI_values[g];
+          for (size_t t = 0; t < cols.size(); ++t)
+            transfer_matrices_[m].InsertAdd(g, cols[t], w * vals[t]);
+        }
+  }
+
+  if (is_fissionable_)
+  {
+    sigma_f_ = Interpolate(xs_lower.sigma_f_, xs_upper.sigma_f_);
+    nu_sigma_f_ = Interpolate(xs_lower.nu_sigma_f_, xs_upper.nu_sigma_f_);
+    nu_prompt_sigma_f_ = Interpolate(xs_lower.nu_prompt_sigma_f_, xs_upper.nu_prompt_sigma_f_);
+    nu_delayed_sigma_f_ = Interpolate(xs_lower.nu_delayed_sigma_f_, xs_upper.nu_delayed_sigma_f_);
+
+    // Spectra are interpolated and renormalized to preserve a unit spectrum
+    chi_ = Interpolate(xs_lower.chi_, xs_upper.chi_);
+    const auto chi_sum = std::accumulate(chi_.begin(), chi_.end(), 0.0);
+    if (chi_sum > 0.0)
+      for (auto& x : chi_)
+        x /= chi_sum;
+
+    production_matrix_.assign(num_groups_, std::vector<double>(num_groups_, 0.0));
+    for (size_t g = 0; g < num_groups_; ++g)
+      for (size_t gp = 0; gp < num_groups_; ++gp)
+        production_matrix_[g][gp] = w_lo * xs_lower.production_matrix_[g][gp] +
+                                    w_hi * xs_upper.production_matrix_[g][gp];
+
+    precursors_ = xs_lower.precursors_;
+    for (size_t j = 0; j < num_precursors_; ++j)
+    {
+      const auto& prec_lo = xs_lower.precursors_[j];
+      const auto& prec_hi = xs_upper.precursors_[j];
+      precursors_[j].decay_constant =
+        w_lo * prec_lo.decay_constant + w_hi * prec_hi.decay_constant;
+      precursors_[j].fractional_yield =
+        w_lo * prec_lo.fractional_yield + w_hi * prec_hi.fractional_yield;
+      precursors_[j].emission_spectrum =
+        Interpolate(prec_lo.emission_spectrum, prec_hi.emission_spectrum);
+    }
+  }
+
+  ComputeDiffusionParameters();
+
+  if (xs_lower.adjoint_ or xs_upper.adjoint_)
+    SetAdjointMode(true);
+}
+
 void
 MultiGroupXS::Reset()
 {
@@ -219,6 +311,7 @@ MultiGroupXS::Reset()
   sigma_t_.clear();
   sigma_a_.clear();
   transfer_matrices_.clear();
+  transposed_transfer_matrices_.clear();
 
   sigma_f_.clear();
   chi_.clear();
@@ -226,6 +319,7 @@ MultiGroupXS::Reset()
   nu_prompt_sigma_f_.clear();
   nu_delayed_sigma_f_.clear();
   production_matrix_.clear();
+  transposed_production_matrix_.clear();
   precursors_.clear();
 
   inv_velocity_.clear();
@@ -37,6 +37,12 @@ public:
   void
   Initialize(const std::string& file_name, const std::string& dataset_name, double temperature);
 
+  /**
+   * Populates the cross section by linearly interpolating between two cross sections with the
+   * same group structure, i.e. \f$ (1 - w) \sigma_{lower} + w \sigma_{upper} \f$.
+   */
+  void Initialize(const MultiGroupXS& xs_lower, const MultiGroupXS& xs_upper, double weight);
+
   /// A struct containing data for a delayed neutron precursor.
   struct Precursor
   {
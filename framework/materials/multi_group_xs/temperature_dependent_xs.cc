@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/materials/multi_group_xs/temperature_dependent_xs.h"
+#include "framework/logging/log.h"
+#include "framework/utils/hdf_utils.h"
+#include <algorithm>
+#include <cmath>
+
+namespace opensn
+{
+
+TemperatureDependentXS::TemperatureDependentXS(const std::string& file_name,
+                                               const std::string& dataset_name,
+                                               TemperatureInterpolation interpolation,
+                                               double temperature_resolution)
+  : interpolation_(interpolation), temperature_resolution_(temperature_resolution)
+{
+  OpenSnInvalidArgumentIf(temperature_resolution_ <= 0.0,
+                          "The temperature resolution must be positive.");
+
+  temperatures_ = ReadOpenMCTemperatures(file_name, dataset_name);
+  OpenSnInvalidArgumentIf(temperatures_.empty(),
+                          "No temperature datasets found for " + dataset_name + " in " +
+                            file_name + ".");
+
+  table_.reserve(temperatures_.size());
+  for (const auto temperature : temperatures_)
+  {
+    auto xs = std::make_shared<MultiGroupXS>();
+    xs->Initialize(file_name, dataset_name, temperature);
+    OpenSnLogicalErrorIf(not table_.empty() and xs->NumGroups() != table_.front()->NumGroups(),
+                         "All temperature datasets must have the same group structure.");
+    table_.push_back(xs);
+  }
+
+  log.Log0Verbose1() << "Temperature-dependent cross sections \"" << dataset_name
+                     << "\" loaded at " << temperatures_.size() << " temperatures in ["
+                     << temperatures_.front() << "K, " << temperatures_.back() << "K]";
+}
+
+std::shared_ptr<MultiGroupXS>
+TemperatureDependentXS::GetXS(double temperature)
+{
+  const auto key = std::lround(temperature / temperature_resolution_);
+
+  const auto it = cache_.find(key);
+  if (it != cache_.end())
+    return it->second;
+
+  // Clamp the quantized temperature to the tabulated range
+  const double t_min = temperatures_.front();
+  const double t_max = temperatures_.back();
+  const double t = std::clamp(static_cast<double>(key) * temperature_resolution_, t_min, t_max);
+
+  // Find the bracketing temperatures
+  auto upper = std::upper_bound(temperatures_.begin(), temperatures_.end(), t);
+  if (upper == temperatures_.end())
+    --upper;
+  const auto i_hi = static_cast<size_t>(std::distance(temperatures_.begin(), upper));
+  const auto i_lo = (i_hi > 0) ? i_hi - 1 : 0;
+
+  std::shared_ptr<MultiGroupXS> xs;
+  if (i_lo == i_hi or t <= temperatures_[i_lo])
+    xs = table_[i_lo];
+  else if (t >= temperatures_[i_hi])
+    xs = table_[i_hi];
+  else
+  {
+    const double t_lo = temperatures_[i_lo];
+    const double t_hi = temperatures_[i_hi];
+    double weight = 0.0;
+    if (interpolation_ == TemperatureInterpolation::SQRT_T)
+      weight = (std::sqrt(t) - std::sqrt(t_lo)) / (std::sqrt(t_hi) - std::sqrt(t_lo));
+    else
+      weight = (t - t_lo) / (t_hi - t_lo);
+
+    xs = std::make_shared<MultiGroupXS>();
+    xs->Initialize(*table_[i_lo], *table_[i_hi], weight);
+  }
+
+  cache_[key] = xs;
+  return xs;
+}
+
+std::vector<double>
+TemperatureDependentXS::ReadOpenMCTemperatures(const std::string& file_name,
+                                               const std::string& dataset_name)
+{
+  hid_t file = H5Fopen(file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file < 0)
+    throw std::logic_error("Unable to open " + file_name + " or it is not a valid HDF5 file.\n");
+
+  if (not H5Has(file, "/" + dataset_name))
+  {
+    H5Fclose(file);
+    throw std::runtime_error("Could not find dataset " + dataset_name + " in " + file_name);
+  }
+
+  std::vector<double> temperatures;
+  hid_t group = H5Gopen2(file, ("/" + dataset_name).c_str(), H5P_DEFAULT);
+  H5G_info_t group_info;
+  if (group >= 0 and H5Gget_info(group, &group_info) >= 0)
+  {
+    // Temperature datasets are subgroups named "<T>K"
+    for (hsize_t i = 0; i < group_info.nlinks; ++i)
+    {
+      const auto size = H5Lget_name_by_idx(
+        group, ".", H5_INDEX_NAME, H5_ITER_INC, i, nullptr, 0, H5P_DEFAULT);
+      if (size <= 1)
+        continue;
+      std::vector<char> buffer(size + 1);
+      H5Lget_name_by_idx(
+        group, ".", H5_INDEX_NAME, H5_ITER_INC, i, buffer.data(), buffer.size(), H5P_DEFAULT);
+      const std::string name(buffer.data());
+      if (name.back() != 'K')
+        continue;
+      try
+      {
+        size_t pos = 0;
+        const double temperature = std::stod(name, &pos);
+        if (pos == name.size() - 1)
+          temperatures.push_back(temperature);
+      }
+      catch (const std::exception&)
+      {
+        continue;
+      }
+    }
+  }
+  if (group >= 0)
+    H5Gclose(group);
+  H5Fclose(file);
+
+  std::sort(temperatures.begin(), temperatures.end());
+  return temperatures;
+}
+
+} // namespace opensn
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/materials/multi_group_xs/multi_group_xs.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opensn
+{
+
+/// Interpolation schemes available for temperature-dependent cross sections.
+enum class TemperatureInterpolation
+{
+  /// Linear in temperature.
+  LINEAR = 0,
+  /// Linear in the square root of temperature.
+  SQRT_T = 1
+};
+
+/**
+ * A table of multigroup cross sections evaluated at several temperatures.
+ *
+ * All temperature datasets are read once. Cross sections at an arbitrary temperature are obtained
+ * by interpolating between the two bracketing datasets. Interpolated cross sections are cached
+ * on a quantized temperature so that cells at (nearly) the same temperature share a single
+ * MultiGroupXS object and repeated evaluations do not recompute the interpolation.
+ */
+class TemperatureDependentXS
+{
+public:
+  /**
+   * Reads all temperature datasets of `dataset_name` from an OpenMC cross-section library.
+   *
+   * \param file_name The OpenMC MGXS library file.
+   * \param dataset_name The name of the dataset within the library.
+   * \param interpolation The temperature interpolation scheme.
+   * \param temperature_resolution The temperature quantum (in K) used as the cache key.
+   */
+  TemperatureDependentXS(const std::string& file_name,
+                         const std::string& dataset_name,
+                         TemperatureInterpolation interpolation = TemperatureInterpolation::LINEAR,
+                         double temperature_resolution = 1.0);
+
+  /// Returns the temperatures (in K) at which data is tabulated, in ascending order.
+  const std::vector<double>& Temperatures() const { return temperatures_; }
+
+  size_t NumGroups() const { return table_.front()->NumGroups(); }
+
+  TemperatureInterpolation Interpolation() const { return interpolation_; }
+
+  double TemperatureResolution() const { return temperature_resolution_; }
+
+  /**
+   * Returns the cross sections at the given temperature. Temperatures outside the tabulated
+   * range are clamped to the nearest tabulated temperature. The returned object is owned by the
+   * cache and remains valid until ClearCache is called.
+   */
+  std::shared_ptr<MultiGroupXS> GetXS(double temperature);
+
+  /// Returns the number of interpolated cross sections currently cached.
+  size_t NumCachedEntries() const { return cache_.size(); }
+
+  /// Removes all cached interpolated cross sections.
+  void ClearCache() { cache_.clear(); }
+
+  /// Returns the temperatures available for a dataset in an OpenMC cross-section library.
+  static std::vector<double> ReadOpenMCTemperatures(const std::string& file_name,
+                                                    const std::string& dataset_name);
+
+private:
+  const TemperatureInterpolation interpolation_;
+  const double temperature_resolution_;
+  /// Tabulated temperatures
+  std::vector<double> temperatures_;
+  /// Cross sections at each tabulated temperature
+  std::vector<std::shared_ptr<MultiGroupXS>> table_;
+  /// Interpolated cross sections keyed on the quantized temperature
+  std::map<long, std::shared_ptr<MultiGroupXS>> cache_;
+};
+
+} // namespace opensn
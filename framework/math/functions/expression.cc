@@ -0,0 +1,545 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/math/functions/expression.h"
+#include "framework/logging/log_exceptions.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+
+namespace opensn
+{
+
+namespace
+{
+
+/// Number of points evaluated together, sized so that the evaluation stack stays in cache.
+constexpr size_t batch_chunk_size = 256;
+
+template <typename F>
+inline void
+Transform(double* a, size_t n, F f)
+{
+  for (size_t i = 0; i < n; ++i)
+    a[i] = f(a[i]);
+}
+
+template <typename F>
+inline void
+Transform(double* a, const double* b, size_t n, F f)
+{
+  for (size_t i = 0; i < n; ++i)
+    a[i] = f(a[i], b[i]);
+}
+
+} // namespace
+
+/// Recursive descent parser that emits the postfix program of an expression.
+class Expression::Parser
+{
+public:
+  Parser(Expression& expression, const std::vector<std::string>& variable_names)
+    : expression_(expression), str_(expression.expression_), variable_names_(variable_names)
+  {
+  }
+
+  void Parse()
+  {
+    ParseOr();
+    SkipSpace();
+    if (pos_ != str_.size())
+      Error("unexpected character '" + std::string(1, str_[pos_]) + "'");
+  }
+
+private:
+  void ParseOr()
+  {
+    ParseAnd();
+    while (Accept("||"))
+    {
+      ParseAnd();
+      expression_.Emit(OpCode::OR);
+    }
+  }
+
+  void ParseAnd()
+  {
+    ParseComparison();
+    while (Accept("&&"))
+    {
+      ParseComparison();
+      expression_.Emit(OpCode::AND);
+    }
+  }
+
+  void ParseComparison()
+  {
+    ParseAdditive();
+
+    // Two-character operators are matched first so that "<=" is not read as "<"
+    static const std::vector<std::pair<std::string, OpCode>> comparisons = {
+      {"<=", OpCode::LESS_EQUAL},
+      {">=", OpCode::GREATER_EQUAL},
+      {"==", OpCode::EQUAL},
+      {"!=", OpCode::NOT_EQUAL},
+      {"<", OpCode::LESS},
+      {">", OpCode::GREATER}};
+    for (const auto& [token, op] : comparisons)
+      if (Accept(token))
+      {
+        ParseAdditive();
+        expression_.Emit(op);
+        return;
+      }
+  }
+
+  void ParseAdditive()
+  {
+    ParseTerm();
+    while (true)
+    {
+      if (Accept("+"))
+      {
+        ParseTerm();
+        expression_.Emit(OpCode::ADD);
+      }
+      else if (Accept("-"))
+      {
+        ParseTerm();
+        expression_.Emit(OpCode::SUBTRACT);
+      }
+      else
+        return;
+    }
+  }
+
+  void ParseTerm()
+  {
+    ParseUnary();
+    while (true)
+    {
+      if (Accept("*"))
+      {
+        ParseUnary();
+        expression_.Emit(OpCode::MULTIPLY);
+      }
+      else if (Accept("/"))
+      {
+        ParseUnary();
+        expression_.Emit(OpCode::DIVIDE);
+      }
+      else
+        return;
+    }
+  }
+
+  void ParseUnary()
+  {
+    if (Accept("-"))
+    {
+      ParseUnary();
+      expression_.Emit(OpCode::NEGATE);
+    }
+    else if (Accept("+"))
+      ParseUnary();
+    else
+      ParsePower();
+  }
+
+  /// Exponentiation is right-associative and binds tighter than unary minus on its left.
+  void ParsePower()
+  {
+    ParsePrimary();
+    if (Accept("^"))
+    {
+      ParseUnary();
+      expression_.Emit(OpCode::POWER);
+    }
+  }
+
+  void ParsePrimary()
+  {
+    SkipSpace();
+    if (pos_ >= str_.size())
+      Error("unexpected end of expression");
+
+    const char c = str_[pos_];
+    if (std::isdigit(static_cast<unsigned char>(c)) or c == '.')
+    {
+      const char* begin = str_.c_str() + pos_;
+      char* end = nullptr;
+      const double value = std::strtod(begin, &end);
+      if (end == begin)
+        Error("invalid number");
+      pos_ += end - begin;
+      expression_.Emit(OpCode::CONSTANT, value);
+    }
+    else if (std::isalpha(static_cast<unsigned char>(c)) or c == '_')
+    {
+      const size_t begin = pos_;
+      while (pos_ < str_.size() and
+             (std::isalnum(static_cast<unsigned char>(str_[pos_])) or str_[pos_] == '_'))
+        ++pos_;
+      const std::string name = str_.substr(begin, pos_ - begin);
+
+      if (Accept("("))
+        ParseFunctionCall(name);
+      else
+      {
+        const auto variable = std::find(variable_names_.begin(), variable_names_.end(), name);
+        if (variable != variable_names_.end())
+          expression_.Emit(OpCode::VARIABLE, 0.0, variable - variable_names_.begin());
+        else if (name == "pi")
+          expression_.Emit(OpCode::CONSTANT, M_PI);
+        else
+          Error("unknown variable \"" + name + "\"");
+      }
+    }
+    else if (Accept("("))
+    {
+      ParseOr();
+      Expect(")");
+    }
+    else
+      Error("unexpected character '" + std::string(1, c) + "'");
+  }
+
+  void ParseFunctionCall(const std::string& name)
+  {
+    static const std::map<std::string, OpCode> functions = {{"sin", OpCode::SIN},
+                                                            {"cos", OpCode::COS},
+                                                            {"tan", OpCode::TAN},
+                                                            {"asin", OpCode::ASIN},
+                                                            {"acos", OpCode::ACOS},
+                                                            {"atan", OpCode::ATAN},
+                                                            {"exp", OpCode::EXP},
+                                                            {"log", OpCode::LOG},
+                                                            {"log10", OpCode::LOG10},
+                                                            {"sqrt", OpCode::SQRT},
+                                                            {"abs", OpCode::ABS},
+                                                            {"floor", OpCode::FLOOR},
+                                                            {"ceil", OpCode::CEIL},
+                                                            {"pow", OpCode::POWER},
+                                                            {"atan2", OpCode::ATAN2},
+                                                            {"min", OpCode::MIN},
+                                                            {"max", OpCode::MAX},
+                                                            {"if", OpCode::IF}};
+
+    const auto function = functions.find(name);
+    if (function == functions.end())
+      Error("unknown function \"" + name + "\"");
+
+    const auto op = function->second;
+    const size_t num_arguments = Arity(op);
+    for (size_t a = 0; a < num_arguments; ++a)
+    {
+      if (a > 0)
+        Expect(",");
+      ParseOr();
+    }
+    Expect(")");
+    expression_.Emit(op);
+  }
+
+  void SkipSpace()
+  {
+    while (pos_ < str_.size() and std::isspace(static_cast<unsigned char>(str_[pos_])))
+      ++pos_;
+  }
+
+  bool Accept(const std::string& token)
+  {
+    SkipSpace();
+    if (str_.compare(pos_, token.size(), token) != 0)
+      return false;
+    pos_ += token.size();
+    return true;
+  }
+
+  void Expect(const std::string& token)
+  {
+    if (not Accept(token))
+      Error("expected \"" + token + "\"");
+  }
+
+  [[noreturn]] void Error(const std::string& message) const
+  {
+    OpenSnInvalidArgument("Error in expression \"" + str_ + "\" at position " +
+                          std::to_string(pos_) + ": " + message + ".");
+  }
+
+  Expression& expression_;
+  const std::string& str_;
+  const std::vector<std::string>& variable_names_;
+  size_t pos_ = 0;
+};
+
+Expression::Expression(const std::string& expression,
+                       const std::vector<std::string>& variable_names)
+  : expression_(expression), num_variables_(variable_names.size())
+{
+  Parser(*this, variable_names).Parse();
+
+  size_t stack_size = 0;
+  for (const auto& instruction : program_)
+  {
+    if (instruction.op == OpCode::CONSTANT or instruction.op == OpCode::VARIABLE)
+      ++stack_size;
+    else
+      stack_size -= Arity(instruction.op) - 1;
+    max_stack_size_ = std::max(max_stack_size_, stack_size);
+  }
+}
+
+bool
+Expression::UsesVariable(size_t index) const
+{
+  return std::any_of(program_.begin(),
+                     program_.end(),
+                     [index](const Instruction& instruction)
+                     { return instruction.op == OpCode::VARIABLE and instruction.index == index; });
+}
+
+size_t
+Expression::Arity(OpCode op)
+{
+  switch (op)
+  {
+    case OpCode::CONSTANT:
+    case OpCode::VARIABLE:
+      return 0;
+    case OpCode::NEGATE:
+    case OpCode::SIN:
+    case OpCode::COS:
+    case OpCode::TAN:
+    case OpCode::ASIN:
+    case OpCode::ACOS:
+    case OpCode::ATAN:
+    case OpCode::EXP:
+    case OpCode::LOG:
+    case OpCode::LOG10:
+    case OpCode::SQRT:
+    case OpCode::ABS:
+    case OpCode::FLOOR:
+    case OpCode::CEIL:
+      return 1;
+    case OpCode::IF:
+      return 3;
+    default:
+      return 2;
+  }
+}
+
+double
+Expression::Apply(OpCode op, const double* operands)
+{
+  const double a = operands[0];
+  switch (op)
+  {
+    case OpCode::NEGATE:
+      return -a;
+    case OpCode::ADD:
+      return a + operands[1];
+    case OpCode::SUBTRACT:
+      return a - operands[1];
+    case OpCode::MULTIPLY:
+      return a * operands[1];
+    case OpCode::DIVIDE:
+      return a / operands[1];
+    case OpCode::POWER:
+      return std::pow(a, operands[1]);
+    case OpCode::LESS:
+      return a < operands[1] ? 1.0 : 0.0;
+    case OpCode::LESS_EQUAL:
+      return a <= operands[1] ? 1.0 : 0.0;
+    case OpCode::GREATER:
+      return a > operands[1] ? 1.0 : 0.0;
+    case OpCode::GREATER_EQUAL:
+      return a >= operands[1] ? 1.0 : 0.0;
+    case OpCode::EQUAL:
+      return a == operands[1] ? 1.0 : 0.0;
+    case OpCode::NOT_EQUAL:
+      return a != operands[1] ? 1.0 : 0.0;
+    case OpCode::AND:
+      return (a != 0.0 and operands[1] != 0.0) ? 1.0 : 0.0;
+    case OpCode::OR:
+      return (a != 0.0 or operands[1] != 0.0) ? 1.0 : 0.0;
+    case OpCode::SIN:
+      return std::sin(a);
+    case OpCode::COS:
+      return std::cos(a);
+    case OpCode::TAN:
+      return std::tan(a);
+    case OpCode::ASIN:
+      return std::asin(a);
+    case OpCode::ACOS:
+      return std::acos(a);
+    case OpCode::ATAN:
+      return std::atan(a);
+    case OpCode::EXP:
+      return std::exp(a);
+    case OpCode::LOG:
+      return std::log(a);
+    case OpCode::LOG10:
+      return std::log10(a);
+    case OpCode::SQRT:
+      return std::sqrt(a);
+    case OpCode::ABS:
+      return std::fabs(a);
+    case OpCode::FLOOR:
+      return std::floor(a);
+    case OpCode::CEIL:
+      return std::ceil(a);
+    case OpCode::ATAN2:
+      return std::atan2(a, operands[1]);
+    case OpCode::MIN:
+      return std::min(a, operands[1]);
+    case OpCode::MAX:
+      return std::max(a, operands[1]);
+    case OpCode::IF:
+      return a != 0.0 ? operands[1] : operands[2];
+    default:
+      OpenSnLogicalError("Invalid operation.");
+  }
+}
+
+void
+Expression::Emit(OpCode op, double value, size_t index)
+{
+  const size_t num_operands = Arity(op);
+  if (num_operands > 0 and program_.size() >= num_operands and
+      std::all_of(program_.end() - num_operands,
+                  program_.end(),
+                  [](const Instruction& instruction)
+                  { return instruction.op == OpCode::CONSTANT; }))
+  {
+    double operands[3];
+    for (size_t k = 0; k < num_operands; ++k)
+      operands[k] = program_[program_.size() - num_operands + k].value;
+    program_.resize(program_.size() - num_operands);
+    program_.push_back({OpCode::CONSTANT, Apply(op, operands), 0});
+    return;
+  }
+
+  program_.push_back({op, value, index});
+}
+
+double
+Expression::Evaluate(const double* variables) const
+{
+  // Small expressions are evaluated on a stack-allocated stack. The parser never produces an
+  // empty program, so the result slot is always written; the stack is zeroed only because the
+  // compiler cannot prove that.
+  double small_stack[16] = {};
+  std::vector<double> large_stack;
+  double* stack = small_stack;
+  if (max_stack_size_ > 16)
+  {
+    large_stack.resize(max_stack_size_);
+    stack = large_stack.data();
+  }
+
+  size_t sp = 0;
+  for (const auto& instruction : program_)
+  {
+    if (instruction.op == OpCode::CONSTANT)
+      stack[sp++] = instruction.value;
+    else if (instruction.op == OpCode::VARIABLE)
+      stack[sp++] = variables[instruction.index];
+    else
+    {
+      const size_t num_operands = Arity(instruction.op);
+      sp -= num_operands;
+      stack[sp] = Apply(instruction.op, &stack[sp]);
+      ++sp;
+    }
+  }
+  return stack[0];
+}
+
+void
+Expression::Evaluate(size_t n, const std::vector<const double*>& variables, double* values) const
+{
+  OpenSnInvalidArgumentIf(variables.size() != num_variables_,
+                          "Expected " + std::to_string(num_variables_) + " variables, got " +
+                            std::to_string(variables.size()) + ".");
+
+  // The stack holds one slot of `batch_chunk_size` values per entry. Each instruction is applied
+  // to a whole slot at once, so that the loops over the points can be vectorized.
+  std::vector<double> stack(max_stack_size_ * batch_chunk_size);
+  for (size_t begin = 0; begin < n; begin += batch_chunk_size)
+  {
+    const size_t m = std::min(batch_chunk_size, n - begin);
+    size_t sp = 0;
+    for (const auto& instruction : program_)
+    {
+      double* a = &stack[sp * batch_chunk_size];
+      switch (instruction.op)
+      {
+        case OpCode::CONSTANT:
+          std::fill(a, a + m, instruction.value);
+          ++sp;
+          continue;
+        case OpCode::VARIABLE:
+          std::copy(variables[instruction.index] + begin,
+                    variables[instruction.index] + begin + m,
+                    a);
+          ++sp;
+          continue;
+        default:
+          break;
+      }
+
+      sp -= Arity(instruction.op);
+      a = &stack[sp * batch_chunk_size];
+      const double* b = a + batch_chunk_size;
+      const double* c = b + batch_chunk_size;
+      switch (instruction.op)
+      {
+        case OpCode::NEGATE:
+          Transform(a, m, [](double u) { return -u; });
+          break;
+        case OpCode::ADD:
+          Transform(a, b, m, [](double u, double v) { return u + v; });
+          break;
+        case OpCode::SUBTRACT:
+          Transform(a, b, m, [](double u, double v) { return u - v; });
+          break;
+        case OpCode::MULTIPLY:
+          Transform(a, b, m, [](double u, double v) { return u * v; });
+          break;
+        case OpCode::DIVIDE:
+          Transform(a, b, m, [](double u, double v) { return u / v; });
+          break;
+        case OpCode::MIN:
+          Transform(a, b, m, [](double u, double v) { return std::min(u, v); });
+          break;
+        case OpCode::MAX:
+          Transform(a, b, m, [](double u, double v) { return std::max(u, v); });
+          break;
+        case OpCode::IF:
+          for (size_t i = 0; i < m; ++i)
+            a[i] = a[i] != 0.0 ? b[i] : c[i];
+          break;
+        default:
+        {
+          // Transcendental functions and comparisons go through the scalar path
+          const size_t num_operands = Arity(instruction.op);
+          double operands[3];
+          for (size_t i = 0; i < m; ++i)
+          {
+            for (size_t k = 0; k < num_operands; ++k)
+              operands[k] = a[k * batch_chunk_size + i];
+            a[i] = Apply(instruction.op, operands);
+          }
+        }
+      }
+      ++sp;
+    }
+    std::copy(stack.begin(), stack.begin() + m, values + begin);
+  }
+}
+
+} // namespace opensn
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace opensn
+{
+
+/**
+ * An arithmetic expression that is compiled once into a postfix program and then evaluated
+ * natively, either at a single point or over a batch of points.
+ *
+ * The expression may contain numbers, the named variables, the constant `pi`, the binary
+ * operators `+ - * / ^`, the comparisons `< <= > >= == !=` and the logical operators `&& ||`,
+ * which yield 1 or 0, unary minus, and the functions `sin cos tan asin acos atan exp log log10
+ * sqrt abs floor ceil` with one argument, `pow atan2 min max` with two and `if(c, a, b)`, which
+ * yields `a` where `c` is nonzero and `b` elsewhere. Subexpressions that only involve constants
+ * are folded at compile time.
+ */
+class Expression
+{
+public:
+  /**
+   * Compiles the expression.
+   *
+   * \param expression The expression string.
+   * \param variable_names The names of the variables that the expression may reference. The
+   *        values of the variables are passed to Evaluate in this order.
+   */
+  Expression(const std::string& expression, const std::vector<std::string>& variable_names);
+
+  /// Returns the expression string.
+  const std::string& String() const { return expression_; }
+
+  /// Returns true if the expression references the variable with the given index.
+  bool UsesVariable(size_t index) const;
+
+  /// Evaluates the expression with the given variable values, one per variable.
+  double Evaluate(const double* variables) const;
+
+  /**
+   * Evaluates the expression at a batch of `n` points. `variables[v]` points to the `n` values of
+   * variable `v` and may be null if the expression does not reference variable `v`. The result
+   * for point `i` is written to `values[i]`.
+   */
+  void Evaluate(size_t n, const std::vector<const double*>& variables, double* values) const;
+
+private:
+  enum class OpCode
+  {
+    CONSTANT,
+    VARIABLE,
+    NEGATE,
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE,
+    POWER,
+    LESS,
+    LESS_EQUAL,
+    GREATER,
+    GREATER_EQUAL,
+    EQUAL,
+    NOT_EQUAL,
+    AND,
+    OR,
+    SIN,
+    COS,
+    TAN,
+    ASIN,
+    ACOS,
+    ATAN,
+    EXP,
+    LOG,
+    LOG10,
+    SQRT,
+    ABS,
+    FLOOR,
+    CEIL,
+    ATAN2,
+    MIN,
+    MAX,
+    IF
+  };
+
+  struct Instruction
+  {
+    OpCode op;
+    double value = 0.0;
+    size_t index = 0;
+  };
+
+  class Parser;
+
+  /// Returns the number of operands of an operation.
+  static size_t Arity(OpCode op);
+
+  /// Applies an operation to scalar operands.
+  static double Apply(OpCode op, const double* operands);
+
+  /// Appends an operation to the program, folding it if all of its operands are constants.
+  void Emit(OpCode op, double value = 0.0, size_t index = 0);
+
+  const std::string expression_;
+  const size_t num_variables_;
+  std::vector<Instruction> program_;
+  size_t max_stack_size_ = 0;
+};
+
+} // namespace opensn
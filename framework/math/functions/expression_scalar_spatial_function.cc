@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/math/functions/expression_scalar_spatial_function.h"
+#include "framework/object_factory.h"
+
+namespace opensn
+{
+
+OpenSnRegisterObjectInNamespace(opensn, ExpressionScalarSpatialFunction);
+
+InputParameters
+ExpressionScalarSpatialFunction::GetInputParameters()
+{
+  InputParameters params = ScalarSpatialFunction::GetInputParameters();
+
+  params.SetGeneralDescription("Scalar spatial function defined by an expression string");
+  params.SetDocGroup("DocMathFunctions");
+
+  params.AddRequiredParameter<std::string>(
+    "expression", "Expression of the coordinates x, y and z, e.g. \"1.0 + 0.5*sin(pi*x)\".");
+
+  return params;
+}
+
+ExpressionScalarSpatialFunction::ExpressionScalarSpatialFunction(const InputParameters& params)
+  : ScalarSpatialFunction(params),
+    expression_(params.GetParamValue<std::string>("expression"), {"x", "y", "z"})
+{
+}
+
+double
+ExpressionScalarSpatialFunction::Evaluate(const Vector3& xyz) const
+{
+  const double variables[] = {xyz.x, xyz.y, xyz.z};
+  return expression_.Evaluate(variables);
+}
+
+void
+ExpressionScalarSpatialFunction::Evaluate(const std::vector<Vector3>& xyz,
+                                          std::vector<double>& values) const
+{
+  const size_t num_points = xyz.size();
+  std::vector<double> x(num_points), y(num_points), z(num_points);
+  for (size_t i = 0; i < num_points; ++i)
+  {
+    x[i] = xyz[i].x;
+    y[i] = xyz[i].y;
+    z[i] = xyz[i].z;
+  }
+
+  values.resize(num_points);
+  expression_.Evaluate(num_points, {x.data(), y.data(), z.data()}, values.data());
+}
+
+} // namespace opensn
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/math/functions/scalar_spatial_function.h"
+#include "framework/math/functions/expression.h"
+
+namespace opensn
+{
+
+/// Scalar spatial function defined by a compiled expression of `x`, `y` and `z`.
+class ExpressionScalarSpatialFunction : public ScalarSpatialFunction
+{
+public:
+  static InputParameters GetInputParameters();
+  explicit ExpressionScalarSpatialFunction(const InputParameters& params);
+
+  double Evaluate(const Vector3& xyz) const override;
+
+  void Evaluate(const std::vector<Vector3>& xyz, std::vector<double>& values) const override;
+
+private:
+  const Expression expression_;
+};
+
+} // namespace opensn
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/math/functions/expression_scalar_spatial_material_function.h"
+#include "framework/object_factory.h"
+
+namespace opensn
+{
+
+OpenSnRegisterObjectInNamespace(opensn, ExpressionScalarSpatialMaterialFunction);
+
+InputParameters
+ExpressionScalarSpatialMaterialFunction::GetInputParameters()
+{
+  InputParameters params = ScalarSpatialMaterialFunction::GetInputParameters();
+
+  params.SetGeneralDescription("Scalar spatial material function defined by an expression string");
+  params.SetDocGroup("DocMathFunctions");
+
+  params.AddRequiredParameter<std::string>(
+    "expression",
+    "Expression of the material ID mat_id and the coordinates x, y and z, e.g. "
+    "\"if(mat_id == 0, 1.0, 2.0*x)\".");
+
+  return params;
+}
+
+ExpressionScalarSpatialMaterialFunction::ExpressionScalarSpatialMaterialFunction(
+  const InputParameters& params)
+  : ScalarSpatialMaterialFunction(params),
+    expression_(params.GetParamValue<std::string>("expression"), {"mat_id", "x", "y", "z"})
+{
+}
+
+double
+ExpressionScalarSpatialMaterialFunction::Evaluate(int mat_id, const Vector3& xyz) const
+{
+  const double variables[] = {static_cast<double>(mat_id), xyz.x, xyz.y, xyz.z};
+  return expression_.Evaluate(variables);
+}
+
+void
+ExpressionScalarSpatialMaterialFunction::Evaluate(int mat_id,
+                                                  const std::vector<Vector3>& xyz,
+                                                  std::vector<double>& values) const
+{
+  const size_t num_points = xyz.size();
+  std::vector<double> x(num_points), y(num_points), z(num_points);
+  for (size_t i = 0; i < num_points; ++i)
+  {
+    x[i] = xyz[i].x;
+    y[i] = xyz[i].y;
+    z[i] = xyz[i].z;
+  }
+  const std::vector<double> mat_ids(num_points, static_cast<double>(mat_id));
+
+  values.resize(num_points);
+  expression_.Evaluate(num_points, {mat_ids.data(), x.data(), y.data(), z.data()}, values.data());
+}
+
+} // namespace opensn
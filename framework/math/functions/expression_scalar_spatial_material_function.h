@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/math/functions/scalar_spatial_material_function.h"
+#include "framework/math/functions/expression.h"
+
+namespace opensn
+{
+
+/// Scalar spatial material function defined by a compiled expression of `mat_id`, `x`, `y` and `z`.
+class ExpressionScalarSpatialMaterialFunction : public ScalarSpatialMaterialFunction
+{
+public:
+  static InputParameters GetInputParameters();
+  explicit ExpressionScalarSpatialMaterialFunction(const InputParameters& params);
+
+  double Evaluate(int mat_id, const Vector3& xyz) const override;
+
+  void
+  Evaluate(int mat_id, const std::vector<Vector3>& xyz, std::vector<double>& values) const override;
+
+private:
+  const Expression expression_;
+};
+
+} // namespace opensn
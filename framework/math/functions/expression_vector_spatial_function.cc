@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/math/functions/expression_vector_spatial_function.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/object_factory.h"
+
+namespace opensn
+{
+
+OpenSnRegisterObjectInNamespace(opensn, ExpressionVectorSpatialFunction);
+
+InputParameters
+ExpressionVectorSpatialFunction::GetInputParameters()
+{
+  InputParameters params = VectorSpatialFunction::GetInputParameters();
+
+  params.SetGeneralDescription("Vector spatial function defined by expression strings");
+  params.SetDocGroup("DocMathFunctions");
+
+  params.AddRequiredParameterArray(
+    "expressions",
+    "Expressions of the coordinates x, y and z and the component index g. A single expression is "
+    "evaluated for every component, otherwise there must be one expression per component.");
+
+  return params;
+}
+
+ExpressionVectorSpatialFunction::ExpressionVectorSpatialFunction(const InputParameters& params)
+  : VectorSpatialFunction(params)
+{
+  const auto expressions = params.GetParamVectorValue<std::string>("expressions");
+  OpenSnInvalidArgumentIf(expressions.empty(), "At least one expression must be given.");
+
+  expressions_.reserve(expressions.size());
+  for (const auto& expression : expressions)
+    expressions_.emplace_back(expression, std::vector<std::string>{"x", "y", "z", "g"});
+}
+
+const Expression&
+ExpressionVectorSpatialFunction::ComponentExpression(int component, int num_components) const
+{
+  if (expressions_.size() == 1)
+    return expressions_.front();
+
+  OpenSnLogicalErrorIf(expressions_.size() != static_cast<size_t>(num_components),
+                       "The function has " + std::to_string(expressions_.size()) +
+                         " expressions but was evaluated with " + std::to_string(num_components) +
+                         " components.");
+  return expressions_[component];
+}
+
+std::vector<double>
+ExpressionVectorSpatialFunction::Evaluate(const Vector3& xyz, int num_components) const
+{
+  std::vector<double> values(num_components);
+  for (int c = 0; c < num_components; ++c)
+  {
+    const double variables[] = {xyz.x, xyz.y, xyz.z, static_cast<double>(c)};
+    values[c] = ComponentExpression(c, num_components).Evaluate(variables);
+  }
+  return values;
+}
+
+void
+ExpressionVectorSpatialFunction::Evaluate(const std::vector<Vector3>& xyz,
+                                          int num_components,
+                                          std::vector<double>& values) const
+{
+  const size_t num_points = xyz.size();
+  std::vector<double> x(num_points), y(num_points), z(num_points), g(num_points);
+  for (size_t i = 0; i < num_points; ++i)
+  {
+    x[i] = xyz[i].x;
+    y[i] = xyz[i].y;
+    z[i] = xyz[i].z;
+  }
+
+  // Each component is evaluated over the whole batch and then stored point by point
+  std::vector<double> component_values(num_points);
+  values.resize(num_points * num_components);
+  for (int c = 0; c < num_components; ++c)
+  {
+    std::fill(g.begin(), g.end(), static_cast<double>(c));
+    ComponentExpression(c, num_components)
+      .Evaluate(num_points, {x.data(), y.data(), z.data(), g.data()}, component_values.data());
+    for (size_t i = 0; i < num_points; ++i)
+      values[i * num_components + c] = component_values[i];
+  }
+}
+
+} // namespace opensn
@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/math/functions/vector_spatial_function.h"
+#include "framework/math/functions/expression.h"
+
+namespace opensn
+{
+
+/**
+ * Vector spatial function defined by compiled expressions of `x`, `y`, `z` and the component
+ * index `g`. Either one expression is given for all components or one per component.
+ */
+class ExpressionVectorSpatialFunction : public VectorSpatialFunction
+{
+public:
+  static InputParameters GetInputParameters();
+  explicit ExpressionVectorSpatialFunction(const InputParameters& params);
+
+  std::vector<double> Evaluate(const Vector3& xyz, int num_components) const override;
+
+  void Evaluate(const std::vector<Vector3>& xyz,
+                int num_components,
+                std::vector<double>& values) const override;
+
+private:
+  /// Returns the expression of a component.
+  const Expression& ComponentExpression(int component, int num_components) const;
+
+  std::vector<Expression> expressions_;
+};
+
+} // namespace opensn
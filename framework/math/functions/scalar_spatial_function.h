@@ -5,6 +5,7 @@
 
 #include "framework/math/functions/function.h"
 #include "framework/mesh/mesh_vector.h"
+#include <vector>
 
 namespace opensn
 {
@@ -23,6 +24,20 @@ public:
    * \return Function value
    */
   virtual double Evaluate(const Vector3& xyz) const = 0;
+
+  /**
+   * Evaluate this function at a batch of points. The default implementation evaluates the points
+   * one at a time.
+   *
+   * \param xyz The xyz coordinates of the points where the function is called.
+   * \param values The function values, one per point.
+   */
+  virtual void Evaluate(const std::vector<Vector3>& xyz, std::vector<double>& values) const
+  {
+    values.resize(xyz.size());
+    for (size_t i = 0; i < xyz.size(); ++i)
+      values[i] = Evaluate(xyz[i]);
+  }
 };
 
 } // namespace opensn
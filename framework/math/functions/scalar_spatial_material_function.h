@@ -5,6 +5,7 @@
 
 #include "framework/math/functions/function.h"
 #include "framework/mesh/mesh_vector.h"
+#include <vector>
 
 namespace opensn
 {
@@ -24,6 +25,22 @@ public:
    * \return Function value
    */
   virtual double Evaluate(int mat_id, const Vector3& xyz) const = 0;
+
+  /**
+   * Evaluate this function at a batch of points with the same material ID. The default
+   * implementation evaluates the points one at a time.
+   *
+   * \param mat_id The material ID of the cells containing the points
+   * \param xyz The xyz coordinates of the points where the function is called.
+   * \param values The function values, one per point.
+   */
+  virtual void
+  Evaluate(int mat_id, const std::vector<Vector3>& xyz, std::vector<double>& values) const
+  {
+    values.resize(xyz.size());
+    for (size_t i = 0; i < xyz.size(); ++i)
+      values[i] = Evaluate(mat_id, xyz[i]);
+  }
 };
 
 } // namespace opensn
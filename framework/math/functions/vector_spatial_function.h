@@ -5,6 +5,8 @@
 
 #include "framework/math/functions/function.h"
 #include "framework/mesh/mesh_vector.h"
+#include <algorithm>
+#include <vector>
 
 namespace opensn
 {
@@ -24,6 +26,26 @@ public:
    * \return A vector with the function evaluation (should have `num_groups` entries)
    */
   virtual std::vector<double> Evaluate(const Vector3& xyz, int num_components) const = 0;
+
+  /**
+   * Evaluate the function at a batch of points. The default implementation evaluates the points
+   * one at a time.
+   *
+   * \param xyz The xyz coordinates of the points where the function is evaluated.
+   * \param num_components The number of components
+   * \param values The components of the function at each point, stored point by point.
+   */
+  virtual void Evaluate(const std::vector<Vector3>& xyz,
+                        int num_components,
+                        std::vector<double>& values) const
+  {
+    values.resize(xyz.size() * num_components);
+    for (size_t i = 0; i < xyz.size(); ++i)
+    {
+      const auto point_values = Evaluate(xyz[i], num_components);
+      std::copy(point_values.begin(), point_values.end(), values.begin() + i * num_components);
+    }
+  }
 };
 
 } // namespace opensn
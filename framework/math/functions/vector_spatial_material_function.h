@@ -5,6 +5,8 @@
 
 #include "framework/math/functions/function.h"
 #include "framework/mesh/mesh_vector.h"
+#include <algorithm>
+#include <vector>
 
 namespace opensn
 {
@@ -26,6 +28,28 @@ public:
    */
   virtual std::vector<double>
   Evaluate(const Vector3& xyz, int mat_id, int num_components) const = 0;
+
+  /**
+   * Evaluate the function at a batch of points with the same material ID. The default
+   * implementation evaluates the points one at a time.
+   *
+   * \param xyz The xyz coordinates of the points where the function is evaluated.
+   * \param mat_id Material ID
+   * \param num_components Number of components
+   * \param values The components of the function at each point, stored point by point.
+   */
+  virtual void Evaluate(const std::vector<Vector3>& xyz,
+                        int mat_id,
+                        int num_components,
+                        std::vector<double>& values) const
+  {
+    values.resize(xyz.size() * num_components);
+    for (size_t i = 0; i < xyz.size(); ++i)
+    {
+      const auto point_values = Evaluate(xyz[i], mat_id, num_components);
+      std::copy(point_values.begin(), point_values.end(), values.begin() + i * num_components);
+    }
+  }
 };
 
 } // namespace opensn
@@ -83,6 +83,15 @@ public:
    */
   void CommunicateGhostEntries() override { ghost_comm_.CommunicateGhostEntries(values_); }
 
+  /**
+   * Start communicating the ghost entries without waiting for completion. Work that does not
+   * modify the vector can be done before the matching call to EndGhostExchange.
+   */
+  void BeginGhostExchange() { ghost_comm_.BeginGhostExchange(values_); }
+
+  /// Wait for the ghost exchange started by BeginGhostExchange and update the ghost entries.
+  void EndGhostExchange() { ghost_comm_.EndGhostExchange(values_); }
+
 private:
   VectorGhostCommunicator ghost_comm_;
 };
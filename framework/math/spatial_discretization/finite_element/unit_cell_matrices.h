@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/math/math.h"
+#include <vector>
+
+namespace opensn
+{
+
+/// Integrals of the shape functions of a cell and their gradients, without coefficients.
+struct UnitCellMatrices
+{
+  DenseMatrix<double> intV_gradshapeI_gradshapeJ;
+  DenseMatrix<Vector3> intV_shapeI_gradshapeJ;
+  DenseMatrix<double> intV_shapeI_shapeJ;
+  Vector<double> intV_shapeI;
+
+  std::vector<DenseMatrix<double>> intS_shapeI_shapeJ;
+  std::vector<DenseMatrix<Vector3>> intS_shapeI_gradshapeJ;
+  std::vector<Vector<double>> intS_shapeI;
+};
+
+} // namespace opensn
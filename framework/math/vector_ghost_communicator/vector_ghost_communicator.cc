@@ -22,7 +22,11 @@ VectorGhostCommunicator::VectorGhostCommunicator(const uint64_t local_size,
     location_id_(communicator.rank()),
     process_count_(communicator.size()),
     extents_(BuildLocationExtents(local_size, communicator)),
-    cached_parallel_data_(MakeCachedParallelData())
+    cached_parallel_data_(MakeCachedParallelData()),
+    graph_comm_(MakeGraphCommunicator()),
+    send_buffer_(cached_parallel_data_.local_ids_to_send.size(), 0.0),
+    recv_buffer_(ghost_ids_.size(), 0.0),
+    request_(MPI_REQUEST_NULL)
 {
 }
 
@@ -45,6 +49,13 @@ VectorGhostCommunicator::MakeCachedParallelData()
     for (const int64_t gid : gids)
       ghost_to_recv_map[gid] = count++;
 
+  std::vector<size_t> ghost_recv_positions;
+  ghost_recv_positions.reserve(ghost_ids_.size());
+  for (const int64_t ghost_id : ghost_ids_)
+    ghost_recv_positions.push_back(ghost_to_recv_map.at(ghost_id));
+
+  std::vector<int> send_neighbors;
+  std::vector<int> recv_neighbors;
   std::vector<int> sendcounts;
   std::vector<int> senddispls;
   std::vector<int> recvcounts;
@@ -52,15 +63,14 @@ VectorGhostCommunicator::MakeCachedParallelData()
 
   // Now, the structure of the data being received from communication
   // is developed. This involves determining the amount of data
-  // being sent per process and the starting position of the data in
-  // the receive buffer per process.
+  // being sent per neighboring process and the starting position of
+  // the data in the receive buffer per neighboring process.
   int total_recvcounts = 0;
-  recvcounts.assign(process_count_, 0);
-  recvdispls.assign(process_count_, 0);
   for (const auto& [pid, gids] : recv_map)
   {
-    recvcounts[pid] = static_cast<int>(gids.size());
-    recvdispls[pid] = total_recvcounts;
+    recv_neighbors.push_back(pid);
+    recvcounts.push_back(static_cast<int>(gids.size()));
+    recvdispls.push_back(total_recvcounts);
     total_recvcounts += static_cast<int>(gids.size());
   }
 
@@ -99,45 +109,86 @@ VectorGhostCommunicator::MakeCachedParallelData()
   // Finally, the communication pattern for the data being sent
   // can be constructed similarly to that for the received data.
   int total_sendcounts = 0;
-  sendcounts.assign(process_count_, 0);
-  senddispls.assign(process_count_, 0);
   for (const auto& [pid, gids] : send_map)
   {
-    sendcounts[pid] = static_cast<int>(gids.size());
-    senddispls[pid] = total_sendcounts;
+    send_neighbors.push_back(pid);
+    sendcounts.push_back(static_cast<int>(gids.size()));
+    senddispls.push_back(total_sendcounts);
     total_sendcounts += static_cast<int>(gids.size());
   }
 
-  return CachedParallelData{std::move(sendcounts),
+  return CachedParallelData{std::move(send_neighbors),
+                            std::move(recv_neighbors),
+                            std::move(sendcounts),
                             std::move(senddispls),
                             std::move(recvcounts),
                             std::move(recvdispls),
                             std::move(local_ids_to_send),
-                            std::move(ghost_to_recv_map)};
+                            std::move(ghost_to_recv_map),
+                            std::move(ghost_recv_positions)};
+}
+
+std::shared_ptr<MPI_Comm>
+VectorGhostCommunicator::MakeGraphCommunicator() const
+{
+  // The graph only connects this process to the processes it exchanges ghost data with, so that
+  // neighborhood collectives scale with the number of neighbors instead of the number of processes.
+  const auto& sources = cached_parallel_data_.recv_neighbors;
+  const auto& destinations = cached_parallel_data_.send_neighbors;
+
+  auto graph_comm = std::shared_ptr<MPI_Comm>(new MPI_Comm(MPI_COMM_NULL),
+                                              [](MPI_Comm* comm)
+                                              {
+                                                int finalized = 0;
+                                                MPI_Finalized(&finalized);
+                                                if (*comm != MPI_COMM_NULL and not finalized)
+                                                  MPI_Comm_free(comm);
+                                                delete comm;
+                                              });
+  MPI_Dist_graph_create_adjacent(comm_,
+                                 static_cast<int>(sources.size()),
+                                 sources.data(),
+                                 MPI_UNWEIGHTED,
+                                 static_cast<int>(destinations.size()),
+                                 destinations.data(),
+                                 MPI_UNWEIGHTED,
+                                 MPI_INFO_NULL,
+                                 0,
+                                 graph_comm.get());
+  return graph_comm;
 }
 
 VectorGhostCommunicator::VectorGhostCommunicator(const VectorGhostCommunicator& other)
   : local_size_(other.local_size_),
-    global_size_(other.local_size_),
+    global_size_(other.global_size_),
     ghost_ids_(other.ghost_ids_),
     comm_(other.comm_),
     location_id_(other.location_id_),
     process_count_(other.process_count_),
     extents_(other.extents_),
-    cached_parallel_data_(other.cached_parallel_data_)
+    cached_parallel_data_(other.cached_parallel_data_),
+    graph_comm_(other.graph_comm_),
+    send_buffer_(other.send_buffer_.size(), 0.0),
+    recv_buffer_(other.recv_buffer_.size(), 0.0),
+    request_(MPI_REQUEST_NULL)
 {
 }
 
 VectorGhostCommunicator::VectorGhostCommunicator(VectorGhostCommunicator&& other) noexcept
   : local_size_(other.local_size_),
-    global_size_(other.local_size_),
+    global_size_(other.global_size_),
     ghost_ids_(other.ghost_ids_),
     comm_(other.comm_),
     location_id_(other.location_id_),
     process_count_(other.process_count_),
     extents_(other.extents_),
-    cached_parallel_data_(other.cached_parallel_data_)
+    cached_parallel_data_(other.cached_parallel_data_),
+    graph_comm_(other.graph_comm_),
+    send_buffer_(std::move(other.send_buffer_)),
+    recv_buffer_(std::move(other.recv_buffer_)),
+    request_(other.request_)
 {
+  other.request_ = MPI_REQUEST_NULL;
 }
 
 int64_t
@@ -155,6 +206,13 @@ VectorGhostCommunicator::MapGhostToLocal(const int64_t ghost_id) const
 
 void
 VectorGhostCommunicator::CommunicateGhostEntries(std::vector<double>& ghosted_vector) const
+{
+  BeginGhostExchange(ghosted_vector);
+  EndGhostExchange(ghosted_vector);
+}
+
+void
+VectorGhostCommunicator::BeginGhostExchange(const std::vector<double>& ghosted_vector) const
 {
   OpenSnInvalidArgumentIf(ghosted_vector.size() != local_size_ + ghost_ids_.size(),
                           std::string(__FUNCTION__) +
@@ -162,33 +220,43 @@ VectorGhostCommunicator::CommunicateGhostEntries(std::vector<double>& ghosted_ve
                             "input size = " +
                             std::to_string(ghosted_vector.size()) + " requirement " +
                             std::to_string(local_size_ + ghost_ids_.size()));
+  OpenSnLogicalErrorIf(request_ != MPI_REQUEST_NULL,
+                       std::string(__FUNCTION__) + ": A ghost exchange is already in progress.");
 
   // Serialize the data that needs to be sent
-  const size_t send_size = cached_parallel_data_.local_ids_to_send.size();
-  std::vector<double> send_data;
-  send_data.reserve(send_size);
-  for (const int64_t local_id : cached_parallel_data_.local_ids_to_send)
-    send_data.push_back(ghosted_vector[local_id]);
-
-  // Create serialized storage for the data to be received
-  const size_t recv_size = ghost_ids_.size();
-  std::vector<double> recv_data(recv_size, 0.0);
-
-  // Communicate the ghost data
-  comm_.all_to_all(send_data,
-                   cached_parallel_data_.sendcounts,
-                   cached_parallel_data_.senddispls,
-                   recv_data,
-                   cached_parallel_data_.recvcounts,
-                   cached_parallel_data_.recvdispls);
+  const auto& local_ids_to_send = cached_parallel_data_.local_ids_to_send;
+  for (size_t k = 0; k < local_ids_to_send.size(); ++k)
+    send_buffer_[k] = ghosted_vector[local_ids_to_send[k]];
+
+  // Communicate the ghost data with the neighbors only
+  MPI_Ineighbor_alltoallv(send_buffer_.data(),
+                          cached_parallel_data_.sendcounts.data(),
+                          cached_parallel_data_.senddispls.data(),
+                          MPI_DOUBLE,
+                          recv_buffer_.data(),
+                          cached_parallel_data_.recvcounts.data(),
+                          cached_parallel_data_.recvdispls.data(),
+                          MPI_DOUBLE,
+                          *graph_comm_,
+                          &request_);
+}
+
+void
+VectorGhostCommunicator::EndGhostExchange(std::vector<double>& ghosted_vector) const
+{
+  OpenSnInvalidArgumentIf(ghosted_vector.size() != local_size_ + ghost_ids_.size(),
+                          std::string(__FUNCTION__) + ": Vector size mismatch.");
+  OpenSnLogicalErrorIf(request_ == MPI_REQUEST_NULL,
+                       std::string(__FUNCTION__) + ": No ghost exchange is in progress.");
+
+  MPI_Wait(&request_, MPI_STATUS_IGNORE);
 
   // Lastly, populate the local vector with ghost data. All ghost data is
-  // appended to the back of the local vector. Using the mapping between
-  // ghost indices and the relative ghost index position along with the
-  // ordering of the ghost indices, this can be accomplished.
-  for (size_t k = 0; k < recv_size; ++k)
-    ghosted_vector[local_size_ + k] =
-      recv_data[cached_parallel_data_.ghost_to_recv_map.at(ghost_ids_[k])];
+  // appended to the back of the local vector in the ordering of the
+  // ghost indices.
+  const auto& ghost_recv_positions = cached_parallel_data_.ghost_recv_positions;
+  for (size_t k = 0; k < ghost_recv_positions.size(); ++k)
+    ghosted_vector[local_size_ + k] = recv_buffer_[ghost_recv_positions[k]];
 }
 
 std::vector<double>
@@ -7,6 +7,7 @@
 #include <vector>
 #include <cstdint>
 #include <map>
+#include <memory>
 
 namespace mpi = mpicpp_lite;
 
@@ -39,8 +40,19 @@ public:
 
   int64_t MapGhostToLocal(int64_t ghost_id) const;
 
+  /// Communicates the ghost entries of a ghosted vector. Equivalent to Begin/EndGhostExchange.
   void CommunicateGhostEntries(std::vector<double>& ghosted_vector) const;
 
+  /**
+   * Starts a non-blocking exchange of the ghost entries of a ghosted vector. The locally owned
+   * entries are read at this point, so they may not be modified before EndGhostExchange is called.
+   * Only one exchange per communicator may be in progress at a time.
+   */
+  void BeginGhostExchange(const std::vector<double>& ghosted_vector) const;
+
+  /// Completes an exchange started with BeginGhostExchange and writes the ghost entries.
+  void EndGhostExchange(std::vector<double>& ghosted_vector) const;
+
   std::vector<double> MakeGhostedVector() const;
   std::vector<double> MakeGhostedVector(const std::vector<double>& local_vector) const;
 
@@ -56,6 +68,11 @@ protected:
 
   struct CachedParallelData
   {
+    /// Processes that this process sends to and receives from
+    std::vector<int> send_neighbors;
+    std::vector<int> recv_neighbors;
+
+    /// Counts and displacements, per neighbor
     std::vector<int> sendcounts;
     std::vector<int> senddispls;
     std::vector<int> recvcounts;
@@ -63,13 +80,25 @@ protected:
 
     std::vector<int64_t> local_ids_to_send;
     std::map<int64_t, size_t> ghost_to_recv_map;
+    /// Position in the receive buffer of each ghost, in ghost order
+    std::vector<size_t> ghost_recv_positions;
   };
 
   const CachedParallelData cached_parallel_data_;
 
+  /// Distributed graph communicator connecting this process to its neighbors only. Shared by
+  /// copies of this communicator.
+  std::shared_ptr<MPI_Comm> graph_comm_;
+
+  /// Reused exchange buffers and the request of the exchange in progress
+  mutable std::vector<double> send_buffer_;
+  mutable std::vector<double> recv_buffer_;
+  mutable MPI_Request request_;
+
 private:
   int FindOwnerPID(int64_t global_id) const;
   CachedParallelData MakeCachedParallelData();
+  std::shared_ptr<MPI_Comm> MakeGraphCommunicator() const;
 };
 
 } // namespace opensn
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "framework/mesh/logical_volume/logical_volume.h"
+#include <limits>
 
 namespace opensn
 {
@@ -16,4 +17,11 @@ LogicalVolume::LogicalVolume(const InputParameters& params) : Object(params)
 {
 }
 
+std::pair<Vector3, Vector3>
+LogicalVolume::GetBoundingBox() const
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  return {Vector3(-inf, -inf, -inf), Vector3(inf, inf, inf)};
+}
+
 } // namespace opensn
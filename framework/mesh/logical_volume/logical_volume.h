@@ -7,6 +7,7 @@
 #include "framework/logging/log.h"
 #include "framework/object.h"
 #include <array>
+#include <utility>
 
 namespace opensn
 {
@@ -20,6 +21,12 @@ public:
   /// Logical operation for surface mesh.
   virtual bool Inside(const Vector3& point) const { return false; }
 
+  /**
+   * Returns the minimum and maximum corners of an axis-aligned box that contains the volume. The
+   * default box is unbounded.
+   */
+  virtual std::pair<Vector3, Vector3> GetBoundingBox() const;
+
 protected:
   explicit LogicalVolume() : Object() {}
   explicit LogicalVolume(const InputParameters& parameters);
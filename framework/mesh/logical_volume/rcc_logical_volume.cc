@@ -85,4 +85,22 @@ RCCLogicalVolume::Inside(const Vector3& point) const
     return false;
 }
 
+std::pair<Vector3, Vector3>
+RCCLogicalVolume::GetBoundingBox() const
+{
+  // The box around the two end caps, padded to stay conservative under the round-off of Inside
+  const Vector3 axis(vx_, vy_, vz_);
+  const Vector3 p0(x0_, y0_, z0_);
+  const Vector3 p1 = p0 + axis;
+  const double pad = r_ + 1.0e-10 * (r_ + axis.Norm());
+
+  Vector3 xyz_min, xyz_max;
+  for (int d = 0; d < 3; ++d)
+  {
+    xyz_min(d) = std::min(p0[d], p1[d]) - pad;
+    xyz_max(d) = std::max(p0[d], p1[d]) + pad;
+  }
+  return {xyz_min, xyz_max};
+}
+
 } // namespace opensn
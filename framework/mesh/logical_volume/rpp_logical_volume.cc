@@ -3,6 +3,7 @@
 
 #include "framework/mesh/logical_volume/rpp_logical_volume.h"
 #include "framework/object_factory.h"
+#include <limits>
 
 namespace opensn
 {
@@ -66,4 +67,12 @@ RPPLogicalVolume::Inside(const Vector3& point) const
   return condition == true_condition;
 }
 
+std::pair<Vector3, Vector3>
+RPPLogicalVolume::GetBoundingBox() const
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  return {Vector3(infx_ ? -inf : xmin_, infy_ ? -inf : ymin_, infz_ ? -inf : zmin_),
+          Vector3(infx_ ? inf : xmax_, infy_ ? inf : ymax_, infz_ ? inf : zmax_)};
+}
+
 } // namespace opensn
@@ -27,6 +27,8 @@ public:
 
   bool Inside(const Vector3& point) const override;
 
+  std::pair<Vector3, Vector3> GetBoundingBox() const override;
+
 protected:
   double xmin_, xmax_;
   double ymin_, ymax_;
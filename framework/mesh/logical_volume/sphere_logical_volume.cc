@@ -50,4 +50,10 @@ SphereLogicalVolume::Inside(const Vector3& point) const
     return false;
 }
 
+std::pair<Vector3, Vector3>
+SphereLogicalVolume::GetBoundingBox() const
+{
+  return {Vector3(x0_ - r_, y0_ - r_, z0_ - r_), Vector3(x0_ + r_, y0_ + r_, z0_ + r_)};
+}
+
 } // namespace opensn
@@ -17,6 +17,8 @@ public:
 
   bool Inside(const Vector3& point) const override;
 
+  std::pair<Vector3, Vector3> GetBoundingBox() const override;
+
 protected:
   double r_;
   double x0_, y0_, z0_;
@@ -207,4 +207,11 @@ SurfaceMeshLogicalVolume::Inside(const Vector3& point) const
   return true;
 }
 
+std::pair<Vector3, Vector3>
+SurfaceMeshLogicalVolume::GetBoundingBox() const
+{
+  return {Vector3(xbounds_[0], ybounds_[0], zbounds_[0]),
+          Vector3(xbounds_[1], ybounds_[1], zbounds_[1])};
+}
+
 } // namespace opensn
@@ -17,6 +17,8 @@ public:
 
   bool Inside(const Vector3& point) const override;
 
+  std::pair<Vector3, Vector3> GetBoundingBox() const override;
+
 private:
   const std::shared_ptr<SurfaceMesh> surf_mesh_ = nullptr;
   std::array<double, 2> xbounds_;
@@ -6,6 +6,7 @@
 #include "framework/mesh/mesh_continuum/grid_face_histogram.h"
 #include "framework/mesh/mesh_continuum/grid_vtk_utils.h"
 #include "framework/mesh/logical_volume/logical_volume.h"
+#include "framework/math/functions/scalar_spatial_material_function.h"
 #include "framework/mesh/cell/cell.h"
 #include "framework/data_types/ndarray.h"
 #include "framework/mpi/mpi_comm_set.h"
@@ -13,11 +14,28 @@
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
 #include <algorithm>
+#include <cmath>
+#include <map>
+#include <numeric>
 #include <set>
 
 namespace opensn
 {
 
+namespace
+{
+
+/// Returns true if the point lies in the axis-aligned box given by its minimum and maximum corners.
+bool
+InsideBox(const Vector3& point, const std::pair<Vector3, Vector3>& box)
+{
+  const auto& [xyz_min, xyz_max] = box;
+  return point.x >= xyz_min.x and point.x <= xyz_max.x and point.y >= xyz_min.y and
+         point.y <= xyz_max.y and point.z >= xyz_min.z and point.z <= xyz_max.z;
+}
+
+} // namespace
+
 MeshContinuum::MeshContinuum()
   : dim_(0),
     mesh_type_(UNSTRUCTURED),
@@ -584,10 +602,12 @@ MeshContinuum::SetUniformMaterialID(int mat_id)
 void
 MeshContinuum::SetMaterialIDFromLogical(const LogicalVolume& log_vol, bool sense, int mat_id)
 {
+  const auto bounding_box = log_vol.GetBoundingBox();
+
   int num_cells_modified = 0;
   for (auto& cell : local_cells)
   {
-    if (log_vol.Inside(cell.centroid) and sense)
+    if (InsideBox(cell.centroid, bounding_box) and log_vol.Inside(cell.centroid) and sense)
     {
       cell.material_id = mat_id;
       ++num_cells_modified;
@@ -598,7 +618,7 @@ MeshContinuum::SetMaterialIDFromLogical(const LogicalVolume& log_vol, bool sense
   for (uint64_t ghost_id : ghost_ids)
   {
     auto& cell = cells[ghost_id];
-    if (log_vol.Inside(cell.centroid) and sense)
+    if (InsideBox(cell.centroid, bounding_box) and log_vol.Inside(cell.centroid) and sense)
       cell.material_id = mat_id;
   }
 
@@ -610,6 +630,108 @@ MeshContinuum::SetMaterialIDFromLogical(const LogicalVolume& log_vol, bool sense
                      << "Number of cells modified = " << global_num_cells_modified << ".";
 }
 
+void
+MeshContinuum::SetMaterialIDFromLogicalVolumes(
+  const std::vector<std::pair<const LogicalVolume*, int>>& volume_mat_ids)
+{
+  // Local cells come first so that only they are counted as modified
+  std::vector<Cell*> cell_list;
+  for (auto& cell : local_cells)
+    cell_list.push_back(&cell);
+  const size_t num_local_cells = cell_list.size();
+  for (uint64_t ghost_id : cells.GetGhostGlobalIDs())
+    cell_list.push_back(&cells[ghost_id]);
+
+  // Sort the cells by the x-coordinate of their centroids so that the cells within the x-extent
+  // of a volume's bounding box are found by binary search
+  std::vector<size_t> order(cell_list.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(),
+            order.end(),
+            [&cell_list](size_t a, size_t b)
+            { return cell_list[a]->centroid.x < cell_list[b]->centroid.x; });
+  std::vector<double> sorted_x(order.size());
+  for (size_t k = 0; k < order.size(); ++k)
+    sorted_x[k] = cell_list[order[k]]->centroid.x;
+
+  std::vector<int> new_mat_ids(cell_list.size());
+  for (size_t c = 0; c < cell_list.size(); ++c)
+    new_mat_ids[c] = cell_list[c]->material_id;
+
+  for (const auto& [log_vol, mat_id] : volume_mat_ids)
+  {
+    const auto bounding_box = log_vol->GetBoundingBox();
+    const auto begin = std::lower_bound(sorted_x.begin(), sorted_x.end(), bounding_box.first.x);
+    const auto end = std::upper_bound(begin, sorted_x.end(), bounding_box.second.x);
+    for (auto k = begin - sorted_x.begin(); k < end - sorted_x.begin(); ++k)
+    {
+      const size_t c = order[k];
+      const auto& centroid = cell_list[c]->centroid;
+      if (InsideBox(centroid, bounding_box) and log_vol->Inside(centroid))
+        new_mat_ids[c] = mat_id;
+    }
+  }
+
+  int num_cells_modified = 0;
+  for (size_t c = 0; c < cell_list.size(); ++c)
+    if (cell_list[c]->material_id != new_mat_ids[c])
+    {
+      cell_list[c]->material_id = new_mat_ids[c];
+      if (c < num_local_cells)
+        ++num_cells_modified;
+    }
+
+  int global_num_cells_modified;
+  mpi_comm.all_reduce(num_cells_modified, global_num_cells_modified, mpi::op::sum<int>());
+
+  log.Log0Verbose1() << program_timer.GetTimeString() << " Done setting material id from "
+                     << volume_mat_ids.size() << " logical volumes. "
+                     << "Number of cells modified = " << global_num_cells_modified << ".";
+}
+
+void
+MeshContinuum::SetMaterialIDFromFunction(const ScalarSpatialMaterialFunction& function)
+{
+  // Group the local and ghost cells by their current material id
+  std::map<int, std::vector<Cell*>> material_cells;
+  for (auto& cell : local_cells)
+    material_cells[cell.material_id].push_back(&cell);
+  for (uint64_t ghost_id : cells.GetGhostGlobalIDs())
+  {
+    auto& cell = cells[ghost_id];
+    material_cells[cell.material_id].push_back(&cell);
+  }
+
+  int num_cells_modified = 0;
+  std::vector<Vector3> centroids;
+  std::vector<double> values;
+  for (const auto& [mat_id, cell_list] : material_cells)
+  {
+    centroids.clear();
+    for (const auto* cell : cell_list)
+      centroids.push_back(cell->centroid);
+    function.Evaluate(mat_id, centroids, values);
+
+    for (size_t i = 0; i < cell_list.size(); ++i)
+    {
+      const auto new_mat_id = static_cast<int>(std::lround(values[i]));
+      if (new_mat_id != mat_id)
+      {
+        cell_list[i]->material_id = new_mat_id;
+        if (cell_list[i]->partition_id == static_cast<uint64_t>(mpi_comm.rank()))
+          ++num_cells_modified;
+      }
+    }
+  }
+
+  int global_num_cells_modified;
+  mpi_comm.all_reduce(num_cells_modified, global_num_cells_modified, mpi::op::sum<int>());
+
+  log.Log0Verbose1() << program_timer.GetTimeString()
+                     << " Done setting material id from function. "
+                     << "Number of cells modified = " << global_num_cells_modified << ".";
+}
+
 void
 MeshContinuum::SetBoundaryIDFromLogical(const LogicalVolume& log_vol,
                                         bool sense,
@@ -619,6 +741,8 @@ MeshContinuum::SetBoundaryIDFromLogical(const LogicalVolume& log_vol,
   auto& grid_bndry_id_map = GetBoundaryIDMap();
   uint64_t bndry_id = MakeBoundaryID(boundary_name);
 
+  const auto bounding_box = log_vol.GetBoundingBox();
+
   // Loop over cells
   int num_faces_modified = 0;
   for (auto& cell : local_cells)
@@ -627,7 +751,7 @@ MeshContinuum::SetBoundaryIDFromLogical(const LogicalVolume& log_vol,
     {
       if (face.has_neighbor)
         continue;
-      if (log_vol.Inside(face.centroid) and sense)
+      if (InsideBox(face.centroid, bounding_box) and log_vol.Inside(face.centroid) and sense)
       {
         face.neighbor_id = bndry_id;
         ++num_faces_modified;
@@ -642,6 +766,73 @@ MeshContinuum::SetBoundaryIDFromLogical(const LogicalVolume& log_vol,
     grid_bndry_id_map[bndry_id] = boundary_name;
 }
 
+void
+MeshContinuum::SetBoundaryIDFromFunction(const ScalarSpatialMaterialFunction& function,
+                                         const std::vector<std::string>& boundary_names)
+{
+  // Register the boundary names up front so that every rank makes the same id's
+  auto& grid_bndry_id_map = GetBoundaryIDMap();
+  std::vector<uint64_t> bndry_ids;
+  bndry_ids.reserve(boundary_names.size());
+  for (const auto& boundary_name : boundary_names)
+  {
+    const uint64_t bndry_id = MakeBoundaryID(boundary_name);
+    if (grid_bndry_id_map.count(bndry_id) == 0)
+      grid_bndry_id_map[bndry_id] = boundary_name;
+    bndry_ids.push_back(bndry_id);
+  }
+
+  // Group the boundary faces of the local and ghost cells by their current boundary id
+  std::map<uint64_t, std::vector<std::pair<const Cell*, CellFace*>>> boundary_faces;
+  for (auto& cell : local_cells)
+    for (auto& face : cell.faces)
+      if (not face.has_neighbor)
+        boundary_faces[face.neighbor_id].emplace_back(&cell, &face);
+  for (uint64_t ghost_id : cells.GetGhostGlobalIDs())
+  {
+    auto& cell = cells[ghost_id];
+    for (auto& face : cell.faces)
+      if (not face.has_neighbor)
+        boundary_faces[face.neighbor_id].emplace_back(&cell, &face);
+  }
+
+  int num_faces_modified = 0;
+  std::vector<Vector3> centroids;
+  std::vector<double> values;
+  for (const auto& [bndry_id, face_list] : boundary_faces)
+  {
+    centroids.clear();
+    for (const auto& cell_face : face_list)
+      centroids.push_back(cell_face.second->centroid);
+    function.Evaluate(static_cast<int>(bndry_id), centroids, values);
+
+    for (size_t i = 0; i < face_list.size(); ++i)
+    {
+      const auto index = std::lround(values[i]);
+      if (index < 0)
+        continue;
+      OpenSnLogicalErrorIf(static_cast<size_t>(index) >= bndry_ids.size(),
+                           "Boundary function value " + std::to_string(index) +
+                             " is not an index into the " + std::to_string(bndry_ids.size()) +
+                             " boundary names.");
+      const auto& [cell, face] = face_list[i];
+      if (face->neighbor_id != bndry_ids[index])
+      {
+        face->neighbor_id = bndry_ids[index];
+        if (cell->partition_id == static_cast<uint64_t>(mpi_comm.rank()))
+          ++num_faces_modified;
+      }
+    }
+  }
+
+  int global_num_faces_modified;
+  mpi_comm.all_reduce(num_faces_modified, global_num_faces_modified, mpi::op::sum<int>());
+
+  log.Log0Verbose1() << program_timer.GetTimeString()
+                     << " Done setting boundary id from function. "
+                     << "Number of faces modified = " << global_num_faces_modified << ".";
+}
+
 void
 MeshContinuum::ComputeVolumePerMaterialID() const
 {
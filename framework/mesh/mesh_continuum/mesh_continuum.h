@@ -16,6 +16,7 @@ namespace opensn
 class MPICommunicatorSet;
 class GridFaceHistogram;
 class MeshGenerator;
+class ScalarSpatialMaterialFunction;
 
 /// Encapsulates all the necessary information required to fully define a computational domain.
 class MeshContinuum
@@ -153,11 +154,35 @@ public:
   /// Sets material id's using a logical volume.
   void SetMaterialIDFromLogical(const LogicalVolume& log_vol, bool sense, int mat_id);
 
+  /**
+   * Sets material id's from a list of logical volumes and material id's in a single pass over the
+   * cells. A cell inside several of the volumes gets the material id of the last one, as if
+   * SetMaterialIDFromLogical were called for each volume in turn.
+   */
+  void SetMaterialIDFromLogicalVolumes(
+    const std::vector<std::pair<const LogicalVolume*, int>>& volume_mat_ids);
+
+  /**
+   * Sets material id's from a function of the current material id and the cell centroid. The
+   * function is evaluated in one batch per current material id and its values are rounded to
+   * the nearest integer.
+   */
+  void SetMaterialIDFromFunction(const ScalarSpatialMaterialFunction& function);
+
   /// Sets boundary id's using a logical volume.
   void SetBoundaryIDFromLogical(const LogicalVolume& log_vol,
                                 bool sense,
                                 const std::string& boundary_name);
 
+  /**
+   * Sets boundary id's from a function of the current boundary id and the face centroid. The
+   * function is evaluated in one batch per current boundary id. Its values, rounded to the
+   * nearest integer, index into the list of boundary names; negative values keep the face's
+   * current boundary id.
+   */
+  void SetBoundaryIDFromFunction(const ScalarSpatialMaterialFunction& function,
+                                 const std::vector<std::string>& boundary_names);
+
   void SetOrthoAttributes(const OrthoMeshAttributes& attrs) { ortho_attributes_ = attrs; }
 
   /// Compute volume per material id's
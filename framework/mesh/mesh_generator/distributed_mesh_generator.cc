@@ -9,6 +9,8 @@
 #include "framework/utils/utils.h"
 #include "framework/object_factory.h"
 #include "framework/runtime.h"
+#include <algorithm>
+#include <deque>
 
 namespace opensn
 {
@@ -25,11 +27,20 @@ DistributedMeshGenerator::GetInputParameters()
     "broadcast to all other locations.");
   params.SetDocGroup("doc_MeshGenerators");
 
+  params.AddOptionalParameter(
+    "max_send_buffer_size",
+    1024,
+    "Maximum size, in megabytes, of the serialized partitions that location 0 keeps in flight "
+    "while distributing the mesh. A partition larger than this is still sent, by itself.");
+  params.ConstrainParameterRange("max_send_buffer_size", AllowableRangeLowLimit::New(1));
+
   return params;
 }
 
 DistributedMeshGenerator::DistributedMeshGenerator(const InputParameters& params)
-  : MeshGenerator(params), num_parts_(opensn::mpi_comm.size())
+  : MeshGenerator(params),
+    num_parts_(opensn::mpi_comm.size()),
+    max_send_buffer_size_(params.GetParamValue<size_t>("max_send_buffer_size") * 1024 * 1024)
 {
 }
 
@@ -76,116 +87,177 @@ ByteArray
 DistributedMeshGenerator::DistributeSerializedMeshData(const std::vector<int64_t>& cell_pids,
                                                        const UnpartitionedMesh& umesh,
                                                        int num_parts)
+{
+  // Bucket the cells by partition in a single pass
+  std::vector<std::vector<uint64_t>> partition_cells(num_parts);
+  for (auto& cells : partition_cells)
+    cells.reserve(cell_pids.size() / num_parts);
+  for (uint64_t cell_global_id = 0; cell_global_id < cell_pids.size(); ++cell_global_id)
+    partition_cells[cell_pids[cell_global_id]].push_back(cell_global_id);
+
+  // Marks hold the last partition that a cell or vertex was added to. They replace per-partition
+  // sets and never need to be reset.
+  std::vector<int> cell_marks(cell_pids.size(), -1);
+  std::vector<int> vertex_marks(umesh.Vertices().size(), -1);
+
+  // Payloads are sent without blocking, so that a partition is serialized while the previous ones
+  // are in flight. Completed sends are waited for, oldest first, when the payloads in flight would
+  // exceed the memory cap.
+  struct PendingSend
+  {
+    ByteArray data;
+    mpi::Request request;
+  };
+  std::deque<PendingSend> pending_sends;
+  size_t pending_bytes = 0;
+
+  const int report_interval = std::max(1, num_parts / 10);
+  for (int pid = 1; pid < num_parts; ++pid)
+  {
+    auto serial_data =
+      SerializePartition(pid, partition_cells[pid], cell_pids, umesh, cell_marks, vertex_marks);
+    partition_cells[pid] = std::vector<uint64_t>();
+
+    while (not pending_sends.empty() and
+           pending_bytes + serial_data.Size() > max_send_buffer_size_)
+    {
+      mpi::wait(pending_sends.front().request);
+      pending_bytes -= pending_sends.front().data.Size();
+      pending_sends.pop_front();
+    }
+
+    pending_bytes += serial_data.Size();
+    pending_sends.push_back({std::move(serial_data), mpi::Request()});
+    auto& send = pending_sends.back();
+    send.request = opensn::mpi_comm.isend<std::byte>(
+      pid, pid, send.data.Data().data(), static_cast<int>(send.data.Size()));
+
+    if (pid % report_interval == 0)
+      log.Log() << program_timer.GetTimeString() << " Serialized partition " << pid << " of "
+                << num_parts;
+  }
+
+  // Location 0's own partition is serialized last so that the other locations start receiving
+  // as early as possible
+  auto loc0_data =
+    SerializePartition(0, partition_cells[0], cell_pids, umesh, cell_marks, vertex_marks);
+
+  for (auto& send : pending_sends)
+    mpi::wait(send.request);
+
+  return loc0_data;
+}
+
+ByteArray
+DistributedMeshGenerator::SerializePartition(int pid,
+                                             const std::vector<uint64_t>& local_cells,
+                                             const std::vector<int64_t>& cell_pids,
+                                             const UnpartitionedMesh& umesh,
+                                             std::vector<int>& cell_marks,
+                                             std::vector<int>& vertex_marks)
 {
   const auto& vertex_subs = umesh.GetVertextCellSubscriptions();
   const auto& raw_cells = umesh.RawCells();
   const auto& raw_vertices = umesh.Vertices();
-  ByteArray loc0_data;
 
-  for (int pid = 0; pid < num_parts; ++pid)
-  {
-    ByteArray serial_data;
+  std::vector<uint64_t> cells_needed;
+  std::vector<uint64_t> vertices_needed;
+  cells_needed.reserve(2 * local_cells.size());
 
-    std::vector<uint64_t> local_cells_needed;
-    std::set<uint64_t> cells_needed;
-    std::set<uint64_t> vertices_needed;
-    local_cells_needed.reserve(cell_pids.size() / num_parts);
+  auto add_vertices = [&](const UnpartitionedMesh::LightWeightCell& raw_cell)
+  {
+    for (uint64_t vid : raw_cell.vertex_ids)
+      if (vertex_marks[vid] != pid)
+      {
+        vertex_marks[vid] = pid;
+        vertices_needed.push_back(vid);
+      }
+  };
 
-    for (uint64_t cell_global_id = 0; cell_global_id < cell_pids.size(); ++cell_global_id)
+  for (uint64_t cell_global_id : local_cells)
+  {
+    if (cell_marks[cell_global_id] != pid)
     {
-      if (cell_pids[cell_global_id] == pid)
-      {
-        const auto& raw_cell = *raw_cells[cell_global_id];
-        local_cells_needed.push_back(cell_global_id);
-        cells_needed.emplace(cell_global_id);
+      cell_marks[cell_global_id] = pid;
+      cells_needed.push_back(cell_global_id);
+    }
+    const auto& raw_cell = *raw_cells[cell_global_id];
+    add_vertices(raw_cell);
 
-        for (uint64_t vid : raw_cell.vertex_ids)
+    // Process ghost cells
+    for (uint64_t vid : raw_cell.vertex_ids)
+      for (uint64_t ghost_gid : vertex_subs[vid])
+        if (cell_marks[ghost_gid] != pid)
         {
-          vertices_needed.emplace(vid);
-
-          // Process ghost cells
-          for (uint64_t ghost_gid : vertex_subs[vid])
-          {
-            if (ghost_gid != cell_global_id && cells_needed.find(ghost_gid) == cells_needed.end())
-            {
-              cells_needed.emplace(ghost_gid);
-              const auto& ghost_raw_cell = *raw_cells[ghost_gid];
-              // Insert ghost vertex IDs
-              for (uint64_t gvid : ghost_raw_cell.vertex_ids)
-                vertices_needed.emplace(gvid);
-            }
-          }
+          cell_marks[ghost_gid] = pid;
+          cells_needed.push_back(ghost_gid);
+          add_vertices(*raw_cells[ghost_gid]);
         }
-      }
-    }
+  }
 
-    // Basic mesh data
-    serial_data.Write<unsigned int>(umesh.Dimension());
-    serial_data.Write(static_cast<int>(umesh.Type()));
-    serial_data.Write(umesh.Extruded());
-    auto& ortho_attrs = umesh.OrthoAttributes();
-    serial_data.Write(ortho_attrs.Nx);
-    serial_data.Write(ortho_attrs.Ny);
-    serial_data.Write(ortho_attrs.Nz);
-    serial_data.Write(raw_vertices.size());
-
-    // Boundaries
-    const auto& bndry_map = umesh.BoundaryIDMap();
-    serial_data.Write(bndry_map.size());
-    for (const auto& [bid, bname] : bndry_map)
-    {
-      serial_data.Write(bid);
-      const size_t num_chars = bname.size();
-      serial_data.Write(num_chars);
-      for (size_t i = 0; i < num_chars; ++i)
-        serial_data.Write(bname.data()[i]);
-    }
+  ByteArray serial_data;
 
-    // Number of cells and vertices
-    serial_data.Write(cells_needed.size());
-    serial_data.Write(vertices_needed.size());
+  // Basic mesh data
+  serial_data.Write<unsigned int>(umesh.Dimension());
+  serial_data.Write(static_cast<int>(umesh.Type()));
+  serial_data.Write(umesh.Extruded());
+  auto& ortho_attrs = umesh.OrthoAttributes();
+  serial_data.Write(ortho_attrs.Nx);
+  serial_data.Write(ortho_attrs.Ny);
+  serial_data.Write(ortho_attrs.Nz);
+  serial_data.Write(raw_vertices.size());
 
-    // Cell data
-    for (const auto& cell_global_id : cells_needed)
-    {
-      const auto& cell = *raw_cells[cell_global_id];
-      serial_data.Write(static_cast<int>(cell_pids[cell_global_id]));
-      serial_data.Write(cell_global_id);
-      serial_data.Write(cell.type);
-      serial_data.Write(cell.sub_type);
-      serial_data.Write(cell.centroid.x);
-      serial_data.Write(cell.centroid.y);
-      serial_data.Write(cell.centroid.z);
-      serial_data.Write(cell.material_id);
-      serial_data.Write(cell.vertex_ids.size());
-      for (uint64_t vid : cell.vertex_ids)
-        serial_data.Write(vid);
+  // Boundaries
+  const auto& bndry_map = umesh.BoundaryIDMap();
+  serial_data.Write(bndry_map.size());
+  for (const auto& [bid, bname] : bndry_map)
+  {
+    serial_data.Write(bid);
+    const size_t num_chars = bname.size();
+    serial_data.Write(num_chars);
+    for (size_t i = 0; i < num_chars; ++i)
+      serial_data.Write(bname.data()[i]);
+  }
 
-      serial_data.Write(cell.faces.size());
-      for (const auto& face : cell.faces)
-      {
-        serial_data.Write(face.vertex_ids.size());
-        for (uint64_t vid : face.vertex_ids)
-          serial_data.Write(vid);
-        serial_data.Write(face.has_neighbor);
-        serial_data.Write(face.neighbor);
-      }
-    }
+  // Number of cells and vertices
+  serial_data.Write(cells_needed.size());
+  serial_data.Write(vertices_needed.size());
 
-    // Vertex data
-    for (uint64_t vid : vertices_needed)
-    {
+  // Cell data
+  for (const auto& cell_global_id : cells_needed)
+  {
+    const auto& cell = *raw_cells[cell_global_id];
+    serial_data.Write(static_cast<int>(cell_pids[cell_global_id]));
+    serial_data.Write(cell_global_id);
+    serial_data.Write(cell.type);
+    serial_data.Write(cell.sub_type);
+    serial_data.Write(cell.centroid.x);
+    serial_data.Write(cell.centroid.y);
+    serial_data.Write(cell.centroid.z);
+    serial_data.Write(cell.material_id);
+    serial_data.Write(cell.vertex_ids.size());
+    for (uint64_t vid : cell.vertex_ids)
       serial_data.Write(vid);
-      serial_data.Write(raw_vertices[vid]);
+
+    serial_data.Write(cell.faces.size());
+    for (const auto& face : cell.faces)
+    {
+      serial_data.Write(face.vertex_ids.size());
+      for (uint64_t vid : face.vertex_ids)
+        serial_data.Write(vid);
+      serial_data.Write(face.has_neighbor);
+      serial_data.Write(face.neighbor);
     }
+  }
 
-    if (pid == 0)
-      loc0_data = serial_data;
-    else
-      opensn::mpi_comm.send<std::byte>(pid, pid, serial_data.Data().data(), serial_data.Size());
+  // Vertex data
+  for (uint64_t vid : vertices_needed)
+  {
+    serial_data.Write(vid);
+    serial_data.Write(raw_vertices[vid]);
   }
 
-  return loc0_data;
+  return serial_data;
 }
 
 DistributedMeshGenerator::DistributedMeshData
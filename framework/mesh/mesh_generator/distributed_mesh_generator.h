@@ -73,8 +73,9 @@ private:
   /**
    * Serializes and distributes the mesh data to other MPI ranks.
    *
-   * The mesh data is serialized into a `ByteArray` and distributed via MPI. The partitioned
-   * mesh is sent to different ranks based on the partitioning.
+   * The cells are first bucketed by partition in a single pass. Each partition is then serialized
+   * into a `ByteArray` and sent with a non-blocking send, so that serializing the next partition
+   * overlaps with the communication. At most `max_send_buffer_size_` bytes are kept in flight.
    *
    * \param cell_pids A vector of cell partition IDs.
    * \param umesh The unpartitioned mesh object containing mesh information.
@@ -85,6 +86,25 @@ private:
                                          const UnpartitionedMesh& umesh,
                                          int num_parts);
 
+  /**
+   * Serializes the cells of a partition, the ghost cells that share a vertex with them, and all of
+   * their vertices.
+   *
+   * \param pid The partition ID.
+   * \param local_cells Global IDs of the cells in the partition.
+   * \param cell_pids A vector of cell partition IDs.
+   * \param umesh The unpartitioned mesh object containing mesh information.
+   * \param cell_marks Per cell, the last partition that the cell was added to.
+   * \param vertex_marks Per vertex, the last partition that the vertex was added to.
+   * \return The serialized partition.
+   */
+  ByteArray SerializePartition(int pid,
+                               const std::vector<uint64_t>& local_cells,
+                               const std::vector<int64_t>& cell_pids,
+                               const UnpartitionedMesh& umesh,
+                               std::vector<int>& cell_marks,
+                               std::vector<int>& vertex_marks);
+
   /**
    * Deserializes the mesh data from a `ByteArray`.
    *
@@ -110,6 +130,8 @@ private:
 private:
   /// The number of partitions for distributing the mesh.
   const int num_parts_;
+  /// Maximum number of bytes in flight while distributing the mesh.
+  const size_t max_send_buffer_size_;
 };
 
 } // namespace opensn
@@ -298,11 +298,12 @@ MeshGenerator::BroadcastPIDs(std::vector<int64_t>& cell_pids,
 }
 
 bool
-MeshGenerator::CellHasLocalScope(int location_id,
-                                 const UnpartitionedMesh::LightWeightCell& lwcell,
-                                 uint64_t cell_global_id,
-                                 const std::vector<std::set<uint64_t>>& vertex_subscriptions,
-                                 const std::vector<int64_t>& cell_partition_ids) const
+MeshGenerator::CellHasLocalScope(
+  int location_id,
+  const UnpartitionedMesh::LightWeightCell& lwcell,
+  uint64_t cell_global_id,
+  const UnpartitionedMesh::VertexCellSubscriptions& vertex_subscriptions,
+  const std::vector<int64_t>& cell_partition_ids) const
 {
   if (replicated_)
     return true;
@@ -80,7 +80,7 @@ protected:
   bool CellHasLocalScope(int location_id,
                          const UnpartitionedMesh::LightWeightCell& lwcell,
                          uint64_t cell_global_id,
-                         const std::vector<std::set<uint64_t>>& vertex_subscriptions,
+                         const UnpartitionedMesh::VertexCellSubscriptions& vertex_subscriptions,
                          const std::vector<int64_t>& cell_partition_ids) const;
 
   /// Converts a light-weight cell to a real cell.
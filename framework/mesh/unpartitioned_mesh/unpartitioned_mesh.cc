@@ -7,6 +7,8 @@
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
 #include <algorithm>
+#include <limits>
+#include <tuple>
 
 namespace opensn
 {
@@ -200,10 +202,135 @@ UnpartitionedMesh::SetOrthoAttributes(size_t nx, size_t ny, size_t nz)
   ortho_attrs_.Nz = nz;
 }
 
+void
+UnpartitionedMesh::VertexCellSubscriptions::Build(
+  const std::vector<std::shared_ptr<LightWeightCell>>& cells, size_t num_vertices)
+{
+  // The last cell counted for each vertex, so that repeated vertices of a cell count once
+  std::vector<uint64_t> last_cell(num_vertices, std::numeric_limits<uint64_t>::max());
+
+  offsets_.assign(num_vertices + 1, 0);
+  for (uint64_t c = 0; c < cells.size(); ++c)
+    for (uint64_t vid : cells[c]->vertex_ids)
+    {
+      OpenSnLogicalErrorIf(vid >= num_vertices,
+                           "Cell " + std::to_string(c) + " references vertex " +
+                             std::to_string(vid) + " but the mesh has only " +
+                             std::to_string(num_vertices) + " vertices.");
+      if (last_cell[vid] == c)
+        continue;
+      last_cell[vid] = c;
+      ++offsets_[vid + 1];
+    }
+
+  for (size_t v = 0; v < num_vertices; ++v)
+    offsets_[v + 1] += offsets_[v];
+
+  // Cells are visited in order, so the ids of each vertex end up sorted
+  std::vector<uint64_t> fill(offsets_.begin(), offsets_.end() - 1);
+  last_cell.assign(num_vertices, std::numeric_limits<uint64_t>::max());
+  cell_ids_.assign(offsets_.back(), 0);
+  for (uint64_t c = 0; c < cells.size(); ++c)
+    for (uint64_t vid : cells[c]->vertex_ids)
+    {
+      if (last_cell[vid] == c)
+        continue;
+      last_cell[vid] = c;
+      cell_ids_[fill[vid]++] = c;
+    }
+}
+
+namespace
+{
+
+/// A face identified by its sorted, unique vertex ids, which are stored in a shared buffer.
+struct FaceKey
+{
+  uint64_t hash = 0;
+  uint64_t cell_id = 0;
+  size_t face_index = 0;
+  size_t offset = 0;
+  size_t size = 0;
+};
+
+/**
+ * Fills the vertex ids, sizes and hashes of the given keys from the vertex id lists of the faces
+ * they identify. The offsets of the keys into `key_vids` are assigned here.
+ */
+void
+BuildFaceKeys(const std::vector<const std::vector<uint64_t>*>& vertex_id_lists,
+              std::vector<FaceKey>& keys,
+              std::vector<uint64_t>& key_vids)
+{
+  size_t num_key_vids = 0;
+  for (size_t k = 0; k < keys.size(); ++k)
+  {
+    keys[k].offset = num_key_vids;
+    num_key_vids += vertex_id_lists[k]->size();
+  }
+  key_vids.assign(num_key_vids, 0);
+
+  const auto num_keys = static_cast<int64_t>(keys.size());
+#ifdef OPENSN_WITH_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int64_t k = 0; k < num_keys; ++k)
+  {
+    auto& key = keys[k];
+    const auto& vids = *vertex_id_lists[k];
+    const auto begin = key_vids.begin() + static_cast<std::ptrdiff_t>(key.offset);
+    std::copy(vids.begin(), vids.end(), begin);
+    std::sort(begin, begin + static_cast<std::ptrdiff_t>(vids.size()));
+    key.size = std::unique(begin, begin + static_cast<std::ptrdiff_t>(vids.size())) - begin;
+
+    uint64_t hash = key.size;
+    for (size_t i = 0; i < key.size; ++i)
+      hash ^= key_vids[key.offset + i] + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    key.hash = hash;
+  }
+}
+
+/// Orders keys by hash, then by their vertex ids. Returns 0 for keys of the same face.
+int
+CompareFaceKeys(const FaceKey& a,
+                const std::vector<uint64_t>& a_vids,
+                const FaceKey& b,
+                const std::vector<uint64_t>& b_vids)
+{
+  if (a.hash != b.hash)
+    return a.hash < b.hash ? -1 : 1;
+  if (a.size != b.size)
+    return a.size < b.size ? -1 : 1;
+  for (size_t i = 0; i < a.size; ++i)
+  {
+    const auto va = a_vids[a.offset + i];
+    const auto vb = b_vids[b.offset + i];
+    if (va != vb)
+      return va < vb ? -1 : 1;
+  }
+  return 0;
+}
+
+/// Sorts keys such that the keys of the same face are adjacent and ordered by cell and face.
+void
+SortFaceKeys(std::vector<FaceKey>& keys, const std::vector<uint64_t>& key_vids)
+{
+  std::sort(keys.begin(),
+            keys.end(),
+            [&key_vids](const FaceKey& a, const FaceKey& b)
+            {
+              const int cmp = CompareFaceKeys(a, key_vids, b, key_vids);
+              if (cmp != 0)
+                return cmp < 0;
+              return std::tie(a.cell_id, a.face_index) < std::tie(b.cell_id, b.face_index);
+            });
+}
+
+} // namespace
+
 void
 UnpartitionedMesh::BuildMeshConnectivity()
 {
-  const size_t num_raw_cells = raw_cells_.size();
   const size_t num_raw_vertices = vertices_.size();
 
   // Reset all cell neighbors
@@ -222,134 +349,102 @@ UnpartitionedMesh::BuildMeshConnectivity()
 
   // Establish internal connectivity
   // Populate vertex subscriptions to internal cells
-  vertex_cell_subscriptions_.resize(num_raw_vertices);
+  vertex_cell_subscriptions_.Build(raw_cells_, num_raw_vertices);
+
+  log.Log() << program_timer.GetTimeString() << " Vertex cell subscriptions complete.";
+
+  // Build a key for every unconnected face. Sorting the keys places the faces with the same
+  // vertices next to each other.
+  std::vector<FaceKey> face_keys;
+  std::vector<const std::vector<uint64_t>*> face_vertex_ids;
+  face_keys.reserve(num_bndry_faces);
+  face_vertex_ids.reserve(num_bndry_faces);
+  for (uint64_t c = 0; c < raw_cells_.size(); ++c)
   {
-    uint64_t cur_cell_id = 0;
-    for (const auto& cell : raw_cells_)
+    const auto& faces = raw_cells_[c]->faces;
+    for (size_t f = 0; f < faces.size(); ++f)
     {
-      for (auto vid : cell->vertex_ids)
-        vertex_cell_subscriptions_.at(vid).insert(cur_cell_id);
-      ++cur_cell_id;
+      if (faces[f].has_neighbor)
+        continue;
+      FaceKey key;
+      key.cell_id = c;
+      key.face_index = f;
+      face_keys.push_back(key);
+      face_vertex_ids.push_back(&faces[f].vertex_ids);
     }
   }
 
-  log.Log() << program_timer.GetTimeString() << " Vertex cell subscriptions complete.";
+  std::vector<uint64_t> face_key_vids;
+  BuildFaceKeys(face_vertex_ids, face_keys, face_key_vids);
+  SortFaceKeys(face_keys, face_key_vids);
 
-  // Process raw cells
+  // Pair the faces of different cells within each run of equal keys
+  for (size_t run_begin = 0; run_begin < face_keys.size();)
   {
-    uint64_t aux_counter = 0;
-    uint64_t cur_cell_id = 0;
-    for (auto& cell : raw_cells_)
+    size_t run_end = run_begin + 1;
+    while (run_end < face_keys.size() and
+           CompareFaceKeys(
+             face_keys[run_begin], face_key_vids, face_keys[run_end], face_key_vids) == 0)
+      ++run_end;
+
+    for (size_t i = run_begin; i < run_end; ++i)
     {
-      for (auto& cur_cell_face : cell->faces)
+      auto& cur_cell_face = raw_cells_[face_keys[i].cell_id]->faces[face_keys[i].face_index];
+      if (cur_cell_face.has_neighbor)
+        continue;
+      for (size_t j = i + 1; j < run_end; ++j)
       {
-        if (cur_cell_face.has_neighbor)
+        if (face_keys[j].cell_id == face_keys[i].cell_id)
+          continue;
+        auto& adj_cell_face = raw_cells_[face_keys[j].cell_id]->faces[face_keys[j].face_index];
+        if (adj_cell_face.has_neighbor)
           continue;
-        const std::set<uint64_t> cfvids(cur_cell_face.vertex_ids.begin(),
-                                        cur_cell_face.vertex_ids.end());
-
-        std::set<size_t> cells_to_search;
-        for (uint64_t vid : cfvids)
-          for (uint64_t cell_id : vertex_cell_subscriptions_.at(vid))
-            if (cell_id != cur_cell_id)
-              cells_to_search.insert(cell_id);
-
-        for (uint64_t adj_cell_id : cells_to_search)
-        {
-          auto adj_cell = raw_cells_.at(adj_cell_id);
-
-          for (auto& adj_cell_face : adj_cell->faces)
-          {
-            if (adj_cell_face.has_neighbor)
-              continue;
-            const std::set<uint64_t> afvids(adj_cell_face.vertex_ids.begin(),
-                                            adj_cell_face.vertex_ids.end());
-
-            if (cfvids == afvids)
-            {
-              cur_cell_face.neighbor = adj_cell_id;
-              adj_cell_face.neighbor = cur_cell_id;
 
-              cur_cell_face.has_neighbor = true;
-              adj_cell_face.has_neighbor = true;
+        cur_cell_face.neighbor = face_keys[j].cell_id;
+        adj_cell_face.neighbor = face_keys[i].cell_id;
 
-              goto face_neighbor_found;
-            }
-          } // for adjacent cell face
-        }
-      face_neighbor_found:;
-      } // for face
-
-      ++cur_cell_id;
-      const double fraction_complete =
-        static_cast<double>(cur_cell_id) / static_cast<double>(num_raw_cells);
-      if (fraction_complete >= static_cast<double>(aux_counter + 1) * 0.1)
-      {
-        log.Log() << program_timer.GetTimeString() << " Surpassing cell " << cur_cell_id << " of "
-                  << num_raw_cells << " (" << (aux_counter + 1) * 10 << "%)";
-        ++aux_counter;
+        cur_cell_face.has_neighbor = true;
+        adj_cell_face.has_neighbor = true;
+        break;
       }
-    } // for cell
+    }
+    run_begin = run_end;
   }
 
   log.Log() << program_timer.GetTimeString() << " Establishing cell boundary connectivity.";
 
   // Establish boundary connectivity
-  // Make list of internal cells on the boundary
-  std::vector<std::shared_ptr<LightWeightCell>> internal_cells_on_boundary;
-  for (auto& cell : raw_cells_)
+  // Build keys for the boundary cells, which are matched to faces by all their vertices
+  std::vector<FaceKey> bndry_keys(raw_boundary_cells_.size());
+  std::vector<const std::vector<uint64_t>*> bndry_vertex_ids(raw_boundary_cells_.size());
+  for (uint64_t c = 0; c < raw_boundary_cells_.size(); ++c)
   {
-    bool cell_on_boundary = false;
-    for (auto& face : cell->faces)
-      if (not face.has_neighbor)
-      {
-        cell_on_boundary = true;
-        break;
-      }
-
-    if (cell_on_boundary)
-      internal_cells_on_boundary.push_back(cell);
+    bndry_keys[c].cell_id = c;
+    bndry_vertex_ids[c] = &raw_boundary_cells_[c]->vertex_ids;
   }
 
-  // Populate vertex subscriptions to boundary cells
-  std::vector<std::set<uint64_t>> vertex_bndry_cell_subscriptions(vertices_.size());
+  std::vector<uint64_t> bndry_key_vids;
+  BuildFaceKeys(bndry_vertex_ids, bndry_keys, bndry_key_vids);
+  SortFaceKeys(bndry_keys, bndry_key_vids);
+
+  // Process boundary cells. The first boundary cell with the face's vertices is used.
+  for (const auto& face_key : face_keys)
   {
-    uint64_t cur_cell_id = 0;
-    for (auto& cell : raw_boundary_cells_)
-    {
-      for (auto vid : cell->vertex_ids)
-        vertex_bndry_cell_subscriptions.at(vid).insert(cur_cell_id);
-      ++cur_cell_id;
-    }
+    auto& face = raw_cells_[face_key.cell_id]->faces[face_key.face_index];
+    if (face.has_neighbor)
+      continue;
+
+    const auto it = std::lower_bound(
+      bndry_keys.begin(),
+      bndry_keys.end(),
+      face_key,
+      [&](const FaceKey& bndry_key, const FaceKey& key)
+      { return CompareFaceKeys(bndry_key, bndry_key_vids, key, face_key_vids) < 0; });
+    if (it != bndry_keys.end() and
+        CompareFaceKeys(*it, bndry_key_vids, face_key, face_key_vids) == 0)
+      face.neighbor = raw_boundary_cells_[it->cell_id]->material_id;
   }
 
-  // Process boundary cells
-  for (auto& cell : internal_cells_on_boundary)
-    for (auto& face : cell->faces)
-    {
-      if (face.has_neighbor)
-        continue;
-      std::set<uint64_t> cfvids(face.vertex_ids.begin(), face.vertex_ids.end());
-
-      std::set<size_t> cells_to_search;
-      for (uint64_t vid : face.vertex_ids)
-        for (uint64_t cell_id : vertex_bndry_cell_subscriptions[vid])
-          cells_to_search.insert(cell_id);
-
-      for (uint64_t adj_cell_id : cells_to_search)
-      {
-        auto& adj_cell = raw_boundary_cells_[adj_cell_id];
-
-        std::set<uint64_t> afvids(adj_cell->vertex_ids.begin(), adj_cell->vertex_ids.end());
-
-        if (cfvids == afvids)
-        {
-          face.neighbor = adj_cell->material_id;
-          break;
-        }
-      } // for adj_cell_id
-    }   // for face
-
   num_bndry_faces = 0;
   for (const auto& cell : raw_cells_)
     for (auto& face : cell->faces)
@@ -52,6 +52,43 @@ public:
     double xmin = 0.0, xmax = 0.0, ymin = 0.0, ymax = 0.0, zmin = 0.0, zmax = 0.0;
   };
 
+  /// Vertex-to-cell adjacency in compressed sparse row form.
+  class VertexCellSubscriptions
+  {
+  public:
+    /// The ids of the cells that use one vertex, in ascending order.
+    class CellIDs
+    {
+    public:
+      CellIDs(const uint64_t* begin, const uint64_t* end) : begin_(begin), end_(end) {}
+
+      const uint64_t* begin() const { return begin_; }
+      const uint64_t* end() const { return end_; }
+      size_t size() const { return end_ - begin_; }
+      bool empty() const { return begin_ == end_; }
+
+    private:
+      const uint64_t* begin_;
+      const uint64_t* end_;
+    };
+
+    /// Builds the adjacency of the given cells to `num_vertices` vertices.
+    void Build(const std::vector<std::shared_ptr<LightWeightCell>>& cells, size_t num_vertices);
+
+    /// Returns the number of vertices.
+    size_t size() const { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+
+    /// Returns the ids of the cells that use vertex `vid`.
+    CellIDs operator[](uint64_t vid) const
+    {
+      return {cell_ids_.data() + offsets_[vid], cell_ids_.data() + offsets_[vid + 1]};
+    }
+
+  private:
+    std::vector<uint64_t> offsets_;
+    std::vector<uint64_t> cell_ids_;
+  };
+
 public:
   UnpartitionedMesh();
   ~UnpartitionedMesh();
@@ -68,7 +105,7 @@ public:
   void SetExtruded(bool extruded) { extruded_ = extruded; }
   bool Extruded() const { return extruded_; }
 
-  const std::vector<std::set<uint64_t>>& GetVertextCellSubscriptions() const
+  const VertexCellSubscriptions& GetVertextCellSubscriptions() const
   {
     return vertex_cell_subscriptions_;
   }
@@ -88,7 +125,11 @@ public:
   const std::vector<Vector3>& Vertices() const { return vertices_; }
   std::vector<Vector3>& Vertices() { return vertices_; }
 
-  /// Establishes neighbor connectivity for the light-weight mesh.
+  /**
+   * Establishes neighbor connectivity for the light-weight mesh. Faces are matched by sorting
+   * canonical keys made of their sorted vertex ids, and the vertex-to-cell adjacency is stored in
+   * compressed sparse row form.
+   */
   void BuildMeshConnectivity();
 
   /// Compute centroids for all cells.
@@ -121,7 +162,7 @@ protected:
   std::vector<Vector3> vertices_;
   std::vector<std::shared_ptr<LightWeightCell>> raw_cells_;
   std::vector<std::shared_ptr<LightWeightCell>> raw_boundary_cells_;
-  std::vector<std::set<uint64_t>> vertex_cell_subscriptions_;
+  VertexCellSubscriptions vertex_cell_subscriptions_;
 };
 
 } // namespace opensn
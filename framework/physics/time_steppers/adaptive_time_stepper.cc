@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/physics/time_steppers/adaptive_time_stepper.h"
+#include "framework/object_factory.h"
+#include <algorithm>
+#include <cmath>
+
+namespace opensn
+{
+
+OpenSnRegisterObjectInNamespace(physics, AdaptiveTimeStepper);
+
+InputParameters
+AdaptiveTimeStepper::GetInputParameters()
+{
+  InputParameters params = TimeStepper::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Timestep controller that adapts the timestep size to an estimate of the local truncation "
+    "error. Steps whose error exceeds the tolerance are rejected and retaken with a smaller "
+    "timestep.");
+  params.SetDocGroup("doc_TimeStepControllers");
+
+  params.AddOptionalParameter(
+    "tolerance", 1.0e-4, "Tolerance on the relative local truncation error of a step.");
+  params.AddOptionalParameter(
+    "dt_max", -1.0, "Maximum allowable timestep. A negative number disables this.");
+  params.AddOptionalParameter(
+    "safety_factor", 0.9, "Factor applied to the optimal timestep size predicted by the error.");
+  params.AddOptionalParameter(
+    "min_factor", 0.2, "Smallest factor by which the timestep size is reduced in one step.");
+  params.AddOptionalParameter(
+    "max_factor", 2.0, "Largest factor by which the timestep size is increased in one step.");
+  params.AddOptionalParameter("error_order",
+                              1,
+                              "Order of the error estimate, i.e. the order of the lower order "
+                              "method of the embedded pair. The local error is assumed to scale "
+                              "as dt^(error_order + 1).");
+
+  params.ConstrainParameterRange("tolerance", AllowableRangeLowLimit::New(0.0, false));
+  params.ConstrainParameterRange("safety_factor", AllowableRangeLowHighLimit::New(0.0, 1.0));
+  params.ConstrainParameterRange("min_factor", AllowableRangeLowHighLimit::New(0.0, 1.0));
+  params.ConstrainParameterRange("max_factor", AllowableRangeLowLimit::New(1.0));
+  params.ConstrainParameterRange("error_order", AllowableRangeLowLimit::New(1));
+
+  return params;
+}
+
+AdaptiveTimeStepper::AdaptiveTimeStepper(const InputParameters& params)
+  : TimeStepper(params),
+    tolerance_(params.GetParamValue<double>("tolerance")),
+    dt_max_(params.GetParamValue<double>("dt_max")),
+    safety_factor_(params.GetParamValue<double>("safety_factor")),
+    min_factor_(params.GetParamValue<double>("min_factor")),
+    max_factor_(params.GetParamValue<double>("max_factor")),
+    error_order_(params.GetParamValue<unsigned int>("error_order"))
+{
+}
+
+void
+AdaptiveTimeStepper::Advance()
+{
+  TimeStepper::Advance();
+
+  if (has_next_dt_)
+  {
+    dt_ = std::max(next_dt_, dt_min_);
+    has_next_dt_ = false;
+  }
+  if (dt_max_ > 0.0)
+    dt_ = std::min(dt_, dt_max_);
+
+  // Land exactly on the end time
+  if (time_ + dt_ > end_time_ and end_time_ - time_ > general_tolerance_)
+    dt_ = end_time_ - time_;
+}
+
+bool
+AdaptiveTimeStepper::Adapt(TimeStepStatus time_step_status)
+{
+  if (time_step_status != TimeStepStatus::FAILURE or dt_ <= dt_min_)
+    return false;
+
+  dt_ = std::max(dt_ * min_factor_, dt_min_);
+  has_next_dt_ = false;
+  ++num_rejected_;
+  return true;
+}
+
+bool
+AdaptiveTimeStepper::AcceptTimeStep(double error_estimate)
+{
+  const double factor = StepSizeFactor(error_estimate);
+
+  // Steps at the minimum timestep size are accepted regardless of their error
+  if (error_estimate <= tolerance_ or dt_ <= dt_min_)
+  {
+    next_dt_ = dt_ * factor;
+    has_next_dt_ = true;
+    return true;
+  }
+
+  dt_ = std::max(dt_ * factor, dt_min_);
+  has_next_dt_ = false;
+  ++num_rejected_;
+  return false;
+}
+
+double
+AdaptiveTimeStepper::StepSizeFactor(double error_estimate) const
+{
+  if (error_estimate <= 0.0)
+    return max_factor_;
+
+  const double exponent = 1.0 / static_cast<double>(error_order_ + 1);
+  const double factor = safety_factor_ * std::pow(tolerance_ / error_estimate, exponent);
+  return std::clamp(factor, min_factor_, max_factor_);
+}
+
+} // namespace opensn
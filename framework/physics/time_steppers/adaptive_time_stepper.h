@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "framework/physics/time_steppers/time_stepper.h"
+
+namespace opensn
+{
+
+/**
+ * Timestep controller that adapts the timestep size to an estimate of the local truncation error
+ * of every step. A step whose error exceeds the tolerance is rejected and retaken with a smaller
+ * timestep, and the timestep grows again when the error is small.
+ */
+class AdaptiveTimeStepper : public TimeStepper
+{
+public:
+  static InputParameters GetInputParameters();
+  explicit AdaptiveTimeStepper(const InputParameters& params);
+
+  void Advance() override;
+
+  bool Adapt(TimeStepStatus time_step_status) override;
+
+  bool AcceptTimeStep(double error_estimate) override;
+
+  /// Returns the number of steps rejected so far.
+  size_t NumRejectedTimeSteps() const { return num_rejected_; }
+
+private:
+  /// Returns the factor by which the timestep size is scaled for the given error estimate.
+  double StepSizeFactor(double error_estimate) const;
+
+  const double tolerance_;
+  const double dt_max_;
+  const double safety_factor_;
+  const double min_factor_;
+  const double max_factor_;
+  const unsigned int error_order_;
+
+  /// The timestep size to use after the next advance, if an accepted step has set it.
+  double next_dt_ = 0.0;
+  bool has_next_dt_ = false;
+  size_t num_rejected_ = 0;
+};
+
+} // namespace opensn
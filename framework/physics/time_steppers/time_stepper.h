@@ -71,6 +71,14 @@ public:
    */
   virtual bool Adapt(TimeStepStatus time_step_status) { return false; }
 
+  /**
+   * Informs the controller of the estimated relative local truncation error of the step that was
+   * just taken with the current timestep size. Returns true if the step is accepted. Otherwise the
+   * step must be retaken with the adapted timestep size. Controllers that do not adapt accept
+   * every step.
+   */
+  virtual bool AcceptTimeStep(double error_estimate) { return true; }
+
   /// Builds a formatted string of the time information.
   std::string StringTimeInfo(bool old_time = false) const;
 
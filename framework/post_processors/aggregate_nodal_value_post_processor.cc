@@ -2,12 +2,15 @@
 // SPDX-License-Identifier: MIT
 
 #include "framework/post_processors/aggregate_nodal_value_post_processor.h"
+#include "framework/post_processors/batched_reduction.h"
 #include "framework/object_factory.h"
 #include "framework/field_functions/field_function_grid_based.h"
 #include "framework/math/spatial_discretization/spatial_discretization.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/mesh/logical_volume/logical_volume.h"
 #include "framework/event_system/event.h"
+#include <algorithm>
+#include <limits>
 
 namespace opensn
 {
@@ -49,7 +52,8 @@ AggregateNodalValuePostProcessor::Initialize()
                        "Attempted to access invalid field"
                        "function");
 
-  const auto& grid = grid_field_function->GetSpatialDiscretization().Grid();
+  const auto& sdm = grid_field_function->GetSpatialDiscretization();
+  const auto& grid = sdm.Grid();
 
   const auto* logical_volume_ptr_ = GetLogicalVolume();
   if (logical_volume_ptr_ == nullptr)
@@ -65,37 +69,14 @@ AggregateNodalValuePostProcessor::Initialize()
         cell_local_ids_.push_back(cell.local_id);
   }
 
-  initialized_ = true;
-}
-
-void
-AggregateNodalValuePostProcessor::Execute(const Event& event_context)
-{
-  if (not initialized_)
-    Initialize();
-
-  const auto* grid_field_function = GetGridBasedFieldFunction();
-
-  OpenSnLogicalErrorIf(not grid_field_function,
-                       "Attempted to access invalid field"
-                       "function");
-
-  const auto& ref_ff = *grid_field_function;
-  const auto& sdm = ref_ff.GetSpatialDiscretization();
-  const auto& grid = sdm.Grid();
-
-  const auto& uk_man = ref_ff.GetUnknownManager();
+  // Cache the dof mapping, it does not change between executions
+  const auto& uk_man = grid_field_function->GetUnknownManager();
   const auto uid = 0;
   const auto cid = 0;
 
-  const auto field_data = ref_ff.GetGhostedFieldVector();
-  const size_t num_local_dofs =
-    ref_ff.GetSpatialDiscretization().GetNumLocalDOFs(ref_ff.GetUnknownManager());
+  const int64_t num_local_dofs = static_cast<int64_t>(sdm.GetNumLocalDOFs(uk_man));
+  num_globl_dofs_ = sdm.GetNumGlobalDOFs(uk_man);
 
-  double local_max_value = 0.0;
-  double local_min_value = 0.0;
-  double local_accumulation = 0.0;
-  bool first_local = true;
   for (const uint64_t cell_local_id : cell_local_ids_)
   {
     const auto& cell = grid.local_cells[cell_local_id];
@@ -106,61 +87,71 @@ AggregateNodalValuePostProcessor::Execute(const Event& event_context)
     {
       const int64_t imap = sdm.MapDOFLocal(cell, i, uk_man, uid, cid);
       if (imap >= 0 and imap < num_local_dofs)
-      {
-        const double field_value = field_data[imap];
-        if (first_local)
-        {
-          local_max_value = field_value;
-          local_min_value = field_value;
-          first_local = false;
-        }
-
-        local_max_value = std::max(local_max_value, field_value);
-        local_min_value = std::min(local_min_value, field_value);
-        local_accumulation += field_value;
-      }
+        node_dof_indices_.push_back(imap);
     } // for i
   }   // for cell-id
 
+  initialized_ = true;
+}
+
+void
+AggregateNodalValuePostProcessor::Execute(const Event& event_context)
+{
+  ExecuteBatch({this}, event_context);
+}
+
+void
+AggregateNodalValuePostProcessor::AddLocalReductions(BatchedReduction& reduction)
+{
+  if (not initialized_)
+    Initialize();
+
+  const auto* grid_field_function = GetGridBasedFieldFunction();
+
+  OpenSnLogicalErrorIf(not grid_field_function,
+                       "Attempted to access invalid field"
+                       "function");
+
+  // Only locally owned dofs are used, so no ghost communication is needed
+  const auto& field_data = grid_field_function->GetLocalFieldVector();
+
   if (operation_ == "max")
   {
-    double globl_max_value;
-    mpi_comm.all_reduce(local_max_value, globl_max_value, mpi::op::sum<double>());
+    // Processes without any nodes must not affect the result
+    double local_max_value = std::numeric_limits<double>::lowest();
+    for (const int64_t imap : node_dof_indices_)
+      local_max_value = std::max(local_max_value, field_data[imap]);
 
-    value_ = ParameterBlock("", globl_max_value);
+    reduction_index_ = reduction.Add(local_max_value, BatchedReduction::Operation::MAX);
   }
   else if (operation_ == "min")
   {
-    double globl_min_value;
-    mpi_comm.all_reduce(local_min_value, globl_min_value, mpi::op::min<double>());
+    double local_min_value = std::numeric_limits<double>::max();
+    for (const int64_t imap : node_dof_indices_)
+      local_min_value = std::min(local_min_value, field_data[imap]);
 
-    value_ = ParameterBlock("", globl_min_value);
+    reduction_index_ = reduction.Add(local_min_value, BatchedReduction::Operation::MIN);
   }
   else if (operation_ == "avg")
   {
-    double globl_accumulation;
-    mpi_comm.all_reduce(local_accumulation, globl_accumulation, mpi::op::sum<double>());
+    double local_accumulation = 0.0;
+    for (const int64_t imap : node_dof_indices_)
+      local_accumulation += field_data[imap];
 
-    const size_t num_globl_dofs =
-      ref_ff.GetSpatialDiscretization().GetNumGlobalDOFs(ref_ff.GetUnknownManager());
-    value_ = ParameterBlock("", globl_accumulation / double(num_globl_dofs));
+    reduction_index_ = reduction.Add(local_accumulation, BatchedReduction::Operation::SUM);
   }
   else
     OpenSnLogicalError("Unsupported operation type \"" + operation_ + "\".");
+}
 
-  const int event_code = event_context.Code();
-  if (event_code == Event::SolverInitialized or event_code == Event::SolverAdvanced)
-  {
-    const auto& event_params = event_context.Parameters();
-
-    if (event_params.Has("timestep_index") and event_params.Has("time"))
-    {
-      const size_t index = event_params.GetParamValue<size_t>("timestep_index");
-      const double time = event_params.GetParamValue<double>("time");
-      TimeHistoryEntry entry{index, time, value_};
-      time_history_.push_back(std::move(entry));
-    }
-  }
+void
+AggregateNodalValuePostProcessor::ApplyReductions(const BatchedReduction& reduction)
+{
+  const double globl_value = reduction.Value(reduction_index_);
+  if (operation_ == "avg")
+    value_ = ParameterBlock("", globl_value / double(num_globl_dofs_));
+  else
+    value_ = ParameterBlock("", globl_value);
 }
 
 } // namespace opensn
@@ -25,9 +25,19 @@ public:
 protected:
   void Initialize();
 
+  bool SupportsBatchedReduction() const override { return true; }
+  void AddLocalReductions(BatchedReduction& reduction) override;
+  void ApplyReductions(const BatchedReduction& reduction) override;
+
   const std::string operation_;
   bool initialized_ = false;
   std::vector<uint64_t> cell_local_ids_;
+
+  /// Locally owned dof indices of the nodes of the selected cells.
+  std::vector<int64_t> node_dof_indices_;
+  size_t num_globl_dofs_ = 0;
+
+  size_t reduction_index_ = 0;
 };
 
 } // namespace opensn
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "framework/post_processors/batched_reduction.h"
+#include "framework/logging/log_exceptions.h"
+#include <algorithm>
+
+namespace opensn
+{
+
+namespace
+{
+
+/**
+ * User-defined reduction over (value, operation) pairs. The pairs are reduced as a single MPI
+ * datatype so that MPI can never split a value from its operation when it segments the buffer.
+ */
+void
+ReduceEntries(void* in, void* inout, int* len, MPI_Datatype*)
+{
+  const auto* in_entries = static_cast<const double*>(in);
+  auto* inout_entries = static_cast<double*>(inout);
+  for (int i = 0; i < *len; ++i)
+  {
+    const double value = in_entries[2 * i];
+    double& result = inout_entries[2 * i];
+    const auto operation = static_cast<BatchedReduction::Operation>(inout_entries[2 * i + 1]);
+    if (operation == BatchedReduction::Operation::SUM)
+      result += value;
+    else if (operation == BatchedReduction::Operation::MIN)
+      result = std::min(result, value);
+    else
+      result = std::max(result, value);
+  }
+}
+
+} // namespace
+
+size_t
+BatchedReduction::Add(double local_value, Operation operation)
+{
+  entries_.push_back(local_value);
+  entries_.push_back(static_cast<double>(operation));
+  return Size() - 1;
+}
+
+void
+BatchedReduction::Execute(const mpi::Communicator& comm)
+{
+  if (entries_.empty())
+    return;
+
+  // The datatype and operation are created once and live until MPI is finalized
+  static MPI_Datatype entry_type = []
+  {
+    MPI_Datatype type;
+    MPI_Type_contiguous(2, MPI_DOUBLE, &type);
+    MPI_Type_commit(&type);
+    return type;
+  }();
+  static MPI_Op reduce_op = []
+  {
+    MPI_Op op;
+    MPI_Op_create(&ReduceEntries, 1, &op);
+    return op;
+  }();
+
+  MPI_Allreduce(
+    MPI_IN_PLACE, entries_.data(), static_cast<int>(Size()), entry_type, reduce_op, comm);
+}
+
+double
+BatchedReduction::Value(size_t index) const
+{
+  OpenSnLogicalErrorIf(index >= Size(), "Invalid batched reduction index.");
+  return entries_[2 * index];
+}
+
+} // namespace opensn
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "mpicpp-lite/mpicpp-lite.h"
+#include <cstddef>
+#include <vector>
+
+namespace mpi = mpicpp_lite;
+
+namespace opensn
+{
+
+/**
+ * Collects local scalar values that need a global reduction and reduces all of them with a single
+ * MPI_Allreduce. Every value carries its own reduction operation, so sums, minimums and maximums
+ * can be mixed in the same batch. All processes must add the same values in the same order.
+ */
+class BatchedReduction
+{
+public:
+  enum class Operation : int
+  {
+    SUM = 0,
+    MIN = 1,
+    MAX = 2
+  };
+
+  /// Adds a local value to the batch and returns the index with which to retrieve its result.
+  size_t Add(double local_value, Operation operation);
+
+  /// Reduces all values of the batch across the communicator.
+  void Execute(const mpi::Communicator& comm);
+
+  /// Returns the value at the given index. After Execute, this is the globally reduced value.
+  double Value(size_t index) const;
+
+  /// Returns the number of values in the batch.
+  size_t Size() const { return entries_.size() / 2; }
+
+private:
+  /// Interleaved (value, operation) pairs
+  std::vector<double> entries_;
+};
+
+} // namespace opensn
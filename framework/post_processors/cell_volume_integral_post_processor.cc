@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "framework/post_processors/cell_volume_integral_post_processor.h"
+#include "framework/post_processors/batched_reduction.h"
 #include "framework/event_system/event.h"
 #include "framework/field_functions/field_function_grid_based.h"
 #include "framework/math/spatial_discretization/spatial_discretization.h"
@@ -51,7 +52,8 @@ CellVolumeIntegralPostProcessor::Initialize()
                        "Attempted to access invalid field"
                        "function");
 
-  const auto& grid = grid_field_function->GetSpatialDiscretization().Grid();
+  const auto& sdm = grid_field_function->GetSpatialDiscretization();
+  const auto& grid = sdm.Grid();
 
   const auto* logical_volume_ptr_ = GetLogicalVolume();
   if (logical_volume_ptr_ == nullptr)
@@ -67,11 +69,49 @@ CellVolumeIntegralPostProcessor::Initialize()
         cell_local_ids_.push_back(cell.local_id);
   }
 
+  // The quadrature data does not change between executions, so the integral of each shape
+  // function is computed once here
+  const auto& uk_man = grid_field_function->GetUnknownManager();
+  const auto uid = 0;
+  const auto cid = 0;
+
+  auto coord = sdm.GetSpatialWeightingFunction();
+
+  local_volume_ = 0.0;
+  for (const uint64_t cell_local_id : cell_local_ids_)
+  {
+    const auto& cell = grid.local_cells[cell_local_id];
+    const auto& cell_mapping = sdm.GetCellMapping(cell);
+    const size_t num_nodes = cell_mapping.NumNodes();
+    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+
+    for (size_t j = 0; j < num_nodes; ++j)
+    {
+      // phi_h = sum_j b_j phi_j, so int phi_h dV = sum_j phi_j int b_j dV
+      double weight = 0.0;
+      for (const size_t qp : fe_vol_data.QuadraturePointIndices())
+        weight +=
+          fe_vol_data.ShapeValue(j, qp) * coord(fe_vol_data.QPointXYZ(qp)) * fe_vol_data.JxW(qp);
+
+      node_dof_indices_.push_back(sdm.MapDOFLocal(cell, j, uk_man, uid, cid));
+      node_weights_.push_back(weight);
+    } // for j
+
+    for (const size_t qp : fe_vol_data.QuadraturePointIndices())
+      local_volume_ += coord(fe_vol_data.QPointXYZ(qp)) * fe_vol_data.JxW(qp);
+  } // for cell-id
+
   initialized_ = true;
 }
 
 void
 CellVolumeIntegralPostProcessor::Execute(const Event& event_context)
+{
+  ExecuteBatch({this}, event_context);
+}
+
+void
+CellVolumeIntegralPostProcessor::AddLocalReductions(BatchedReduction& reduction)
 {
   if (not initialized_)
     Initialize();
@@ -82,71 +122,29 @@ CellVolumeIntegralPostProcessor::Execute(const Event& event_context)
                        "Attempted to access invalid field"
                        "function");
 
-  const auto& ref_ff = *grid_field_function;
-  const auto& sdm = ref_ff.GetSpatialDiscretization();
-  const auto& grid = sdm.Grid();
-
-  const auto& uk_man = ref_ff.GetUnknownManager();
-  const auto uid = 0;
-  const auto cid = 0;
-
-  const auto field_data = ref_ff.GetGhostedFieldVector();
-
-  auto coord = sdm.GetSpatialWeightingFunction();
+  const auto& field_data = grid_field_function->GetGhostedFieldData();
 
   double local_integral = 0.0;
-  double local_volume = 0.0;
-  for (const uint64_t cell_local_id : cell_local_ids_)
-  {
-    const auto& cell = grid.local_cells[cell_local_id];
-    const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const size_t num_nodes = cell_mapping.NumNodes();
-    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+  const size_t num_nodes = node_dof_indices_.size();
+  for (size_t n = 0; n < num_nodes; ++n)
+    local_integral += node_weights_[n] * field_data[node_dof_indices_[n]];
 
-    std::vector<double> node_dof_values(num_nodes, 0.0);
-    for (size_t i = 0; i < num_nodes; ++i)
-    {
-      const int64_t imap = sdm.MapDOFLocal(cell, i, uk_man, uid, cid);
-      node_dof_values[i] = field_data[imap];
-    } // for i
+  integral_index_ = reduction.Add(local_integral, BatchedReduction::Operation::SUM);
+  if (compute_volume_average_)
+    volume_index_ = reduction.Add(local_volume_, BatchedReduction::Operation::SUM);
+}
 
-    for (const size_t qp : fe_vol_data.QuadraturePointIndices())
-    {
-      // phi_h = sum_j b_j phi_j
-      double ff_value = 0.0;
-      for (size_t j = 0; j < num_nodes; ++j)
-        ff_value += fe_vol_data.ShapeValue(j, qp) * node_dof_values[j];
-
-      local_integral += ff_value * coord(fe_vol_data.QPointXYZ(qp)) * fe_vol_data.JxW(qp);
-      local_volume += coord(fe_vol_data.QPointXYZ(qp)) * fe_vol_data.JxW(qp);
-    } // for qp
-  }   // for cell-id
-
-  double globl_integral;
-  mpi_comm.all_reduce(local_integral, globl_integral, mpi::op::sum<double>());
+void
+CellVolumeIntegralPostProcessor::ApplyReductions(const BatchedReduction& reduction)
+{
+  const double globl_integral = reduction.Value(integral_index_);
   if (not compute_volume_average_)
     value_ = ParameterBlock("", globl_integral);
   else
   {
-    double globl_volume;
-    mpi_comm.all_reduce(local_volume, globl_volume, mpi::op::sum<double>());
-
+    const double globl_volume = reduction.Value(volume_index_);
     value_ = ParameterBlock("", globl_integral / globl_volume);
   }
-
-  const int event_code = event_context.Code();
-  if (event_code == Event::SolverInitialized or event_code == Event::SolverAdvanced)
-  {
-    const auto& event_params = event_context.Parameters();
-
-    if (event_params.Has("timestep_index") and event_params.Has("time"))
-    {
-      const size_t index = event_params.GetParamValue<size_t>("timestep_index");
-      const double time = event_params.GetParamValue<double>("time");
-      TimeHistoryEntry entry{index, time, value_};
-      time_history_.push_back(std::move(entry));
-    }
-  }
 }
 
 } // namespace opensn
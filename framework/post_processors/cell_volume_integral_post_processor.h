@@ -25,9 +25,25 @@ public:
 protected:
   void Initialize();
 
+  bool SupportsBatchedReduction() const override { return true; }
+  void AddLocalReductions(BatchedReduction& reduction) override;
+  void ApplyReductions(const BatchedReduction& reduction) override;
+
   const bool compute_volume_average_;
   bool initialized_ = false;
   std::vector<uint64_t> cell_local_ids_;
+
+  /**
+   * Cached integration data. For each node of the selected cells this holds the local dof index
+   * and the integral of the node's shape function over the cell (including the spatial weighting),
+   * so the integral of the field function reduces to a dot product.
+   */
+  std::vector<int64_t> node_dof_indices_;
+  std::vector<double> node_weights_;
+  double local_volume_ = 0.0;
+
+  size_t integral_index_ = 0;
+  size_t volume_index_ = 0;
 };
 
 } // namespace opensn
@@ -2,16 +2,51 @@
 // SPDX-License-Identifier: MIT
 
 #include "framework/post_processors/post_processor.h"
+#include "framework/post_processors/batched_reduction.h"
 #include "framework/event_system/physics_event_publisher.h"
 #include "framework/event_system/event_subscriber.h"
 #include "framework/event_system/event.h"
 #include "framework/logging/log.h"
 #include "framework/object_factory.h"
+#include "framework/runtime.h"
 #include <inttypes.h>
 
 namespace opensn
 {
 
+namespace
+{
+
+/**
+ * A single subscriber that executes all post-processors supporting batched reductions, so that
+ * their reductions for an event are fused.
+ */
+class BatchedPostProcessorExecutor : public EventSubscriber
+{
+public:
+  void AddPostProcessor(const std::shared_ptr<PostProcessor>& pp_ptr)
+  {
+    post_processors_.push_back(pp_ptr);
+  }
+
+  void ReceiveEventUpdate(const Event& event) override
+  {
+    std::vector<PostProcessor*> pp_list;
+    for (const auto& pp_wptr : post_processors_)
+      if (auto pp_ptr = pp_wptr.lock())
+        if (pp_ptr->ExecutesOn(event))
+          pp_list.push_back(pp_ptr.get());
+
+    if (not pp_list.empty())
+      PostProcessor::ExecuteBatch(pp_list, event);
+  }
+
+private:
+  std::vector<std::weak_ptr<PostProcessor>> post_processors_;
+};
+
+} // namespace
+
 InputParameters
 PostProcessor::GetInputParameters()
 {
@@ -130,33 +165,95 @@ PostProcessor::PushOntoStack(std::shared_ptr<Object>& new_object)
 
   OpenSnLogicalErrorIf(not new_subscriber, "Failure to cast PostProcessor to EventSubscriber");
 
+  // Post-processors with batched reductions are executed together by a shared subscriber
+  if (pp_ptr->SupportsBatchedReduction())
+  {
+    static auto batched_executor = std::make_shared<BatchedPostProcessorExecutor>();
+    batched_executor->AddPostProcessor(pp_ptr);
+    new_subscriber = batched_executor;
+  }
+
   auto& publisher = PhysicsEventPublisher::GetInstance();
   publisher.AddSubscriber(new_subscriber);
 }
 
 void
 PostProcessor::ReceiveEventUpdate(const Event& event)
+{
+  if (ExecutesOn(event))
+  {
+    Execute(event);
+    if (log.GetVerbosity() >= 1)
+      log.Log0Verbose1() << "Post processor \"" << Name()
+                         << "\" executed on "
+                            "event \""
+                         << event.Name() << "\".";
+  }
+}
+
+bool
+PostProcessor::ExecutesOn(const Event& event) const
 {
   auto it = std::find(
     subscribed_events_for_execution_.begin(), subscribed_events_for_execution_.end(), event.Name());
 
-  if (it != subscribed_events_for_execution_.end())
+  if (it == subscribed_events_for_execution_.end())
+    return false;
+
+  if (event.IsSolverEvent() and not solvername_filter_.empty())
   {
-    if (event.IsSolverEvent() and not solvername_filter_.empty())
+    if (event.Parameters().GetParamValue<std::string>("solver_name") != solvername_filter_)
+      return false;
+  }
+
+  return true;
+}
+
+void
+PostProcessor::ExecuteBatch(const std::vector<PostProcessor*>& pp_list, const Event& event)
+{
+  BatchedReduction reduction;
+  for (auto* pp : pp_list)
+  {
+    if (pp->SupportsBatchedReduction())
+      pp->AddLocalReductions(reduction);
+    else
+      pp->Execute(event);
+  }
+
+  reduction.Execute(mpi_comm);
+
+  for (auto* pp : pp_list)
+  {
+    if (pp->SupportsBatchedReduction())
     {
-      if (event.Parameters().GetParamValue<std::string>("solver_name") != solvername_filter_)
-        return;
+      pp->ApplyReductions(reduction);
+      pp->RecordTimeHistory(event);
     }
-
-    Execute(event);
     if (log.GetVerbosity() >= 1)
-      log.Log0Verbose1() << "Post processor \"" << Name()
-                         << "\" executed on "
-                            "event \""
+      log.Log0Verbose1() << "Post processor \"" << pp->Name() << "\" executed on event \""
                          << event.Name() << "\".";
   }
 }
 
+void
+PostProcessor::RecordTimeHistory(const Event& event)
+{
+  const int event_code = event.Code();
+  if (event_code == Event::SolverInitialized or event_code == Event::SolverAdvanced)
+  {
+    const auto& event_params = event.Parameters();
+
+    if (event_params.Has("timestep_index") and event_params.Has("time"))
+    {
+      const size_t index = event_params.GetParamValue<size_t>("timestep_index");
+      const double time = event_params.GetParamValue<double>("time");
+      TimeHistoryEntry entry{index, time, value_};
+      time_history_.push_back(std::move(entry));
+    }
+  }
+}
+
 const ParameterBlock&
 PostProcessor::GetValue() const
 {
@@ -8,6 +8,7 @@
 
 namespace opensn
 {
+class BatchedReduction;
 
 enum class PPType : int
 {
@@ -61,6 +62,15 @@ public:
 
   virtual void Execute(const Event& event_context) = 0;
 
+  /// Returns true if the post-processor is subscribed to execute on the given event.
+  bool ExecutesOn(const Event& event) const;
+
+  /**
+   * Executes a list of post-processors on an event. The global reductions of all post-processors
+   * that support batched reductions are fused into a single collective operation.
+   */
+  static void ExecuteBatch(const std::vector<PostProcessor*>& pp_list, const Event& event);
+
   /// Gets the scalar value currently stored for the post-processor.
   virtual const ParameterBlock& GetValue() const;
   virtual const std::vector<TimeHistoryEntry>& GetTimeHistory() const;
@@ -91,6 +101,22 @@ protected:
   /// Sets the post-processor's generic type.
   void SetType(PPType type);
 
+  /**
+   * Returns true if the post-processor computes its value from global reductions that can be
+   * batched with those of other post-processors. Such post-processors implement
+   * AddLocalReductions and ApplyReductions instead of doing their own communication.
+   */
+  virtual bool SupportsBatchedReduction() const { return false; }
+
+  /// Adds the local contributions of the post-processor to a batched reduction.
+  virtual void AddLocalReductions(BatchedReduction& reduction) {}
+
+  /// Sets the value of the post-processor from a globally reduced batch.
+  virtual void ApplyReductions(const BatchedReduction& reduction) {}
+
+  /// Appends the current value to the time history if the event carries time step information.
+  void RecordTimeHistory(const Event& event);
+
   const std::string name_;
   std::vector<std::string> subscribed_events_for_execution_;
   std::vector<std::string> subscribed_events_for_printing_;
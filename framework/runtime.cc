@@ -34,6 +34,7 @@ std::vector<std::shared_ptr<FieldFunctionInterpolation>> field_func_interpolatio
 std::vector<std::shared_ptr<UnpartitionedMesh>> unpartitionedmesh_stack;
 std::vector<std::shared_ptr<Material>> material_stack;
 std::vector<std::shared_ptr<MultiGroupXS>> multigroup_xs_stack;
+std::vector<std::shared_ptr<TemperatureDependentXS>> temperature_dependent_xs_stack;
 std::vector<std::shared_ptr<FieldFunction>> field_function_stack;
 std::vector<std::shared_ptr<AngularQuadrature>> angular_quadrature_stack;
 std::vector<std::shared_ptr<Object>> object_stack;
@@ -72,6 +73,7 @@ Finalize()
   unpartitionedmesh_stack.clear();
   material_stack.clear();
   multigroup_xs_stack.clear();
+  temperature_dependent_xs_stack.clear();
   function_stack.clear();
   object_stack.clear();
 
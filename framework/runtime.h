@@ -26,6 +26,7 @@ class UnpartitionedMesh;
 class Solver;
 class Material;
 class MultiGroupXS;
+class TemperatureDependentXS;
 class FieldFunction;
 class Function;
 class AngularQuadrature;
@@ -53,6 +54,7 @@ extern std::vector<std::shared_ptr<UnpartitionedMesh>> unpartitionedmesh_stack;
 
 extern std::vector<std::shared_ptr<Material>> material_stack;
 extern std::vector<std::shared_ptr<MultiGroupXS>> multigroup_xs_stack;
+extern std::vector<std::shared_ptr<TemperatureDependentXS>> temperature_dependent_xs_stack;
 extern std::vector<std::shared_ptr<FieldFunction>> field_function_stack;
 
 extern std::vector<std::shared_ptr<AngularQuadrature>> angular_quadrature_stack;
@@ -117,7 +117,7 @@ H5CreateGroup(hid_t id, const std::string& name)
 
 template <typename T>
 bool
-H5WriteDataset1D(hid_t id, const std::string& name, std::vector<T> data)
+H5WriteDataset1D(hid_t id, const std::string& name, const std::vector<T>& data)
 {
   bool retval = false;
 
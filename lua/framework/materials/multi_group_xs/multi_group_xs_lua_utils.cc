@@ -4,6 +4,7 @@
 #include "lua/framework//materials/multi_group_xs/multi_group_xs_lua_utils.h"
 #include "lua/framework/console/console.h"
 #include "framework/materials/multi_group_xs/multi_group_xs.h"
+#include "framework/materials/multi_group_xs/temperature_dependent_xs.h"
 #include "framework/materials/material.h"
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
@@ -22,6 +23,7 @@ RegisterLuaFunctionInNamespace(XSMakeScaled, xs, MakeScaled);
 RegisterLuaFunctionInNamespace(XSSetScalingFactor, xs, SetScalingFactor);
 RegisterLuaFunctionInNamespace(XSGet, xs, Get);
 RegisterLuaFunctionInNamespace(XSExportToOpenSnFormat, xs, ExportToOpenSnFormat);
+RegisterLuaFunctionInNamespace(XSCreateTemperatureDependent, xs, CreateTemperatureDependent);
 
 RegisterLuaConstant(SINGLE_VALUE, Varying(0));
 RegisterLuaConstant(FROM_ARRAY, Varying(1));
@@ -409,4 +411,30 @@ XSExportToOpenSnFormat(lua_State* L)
   return LuaReturn(L);
 }
 
+int
+XSCreateTemperatureDependent(lua_State* L)
+{
+  const std::string fname = "xs.CreateTemperatureDependent";
+  LuaCheckArgs<std::string>(L, fname);
+
+  const auto file_name = LuaArg<std::string>(L, 1);
+  const auto dataset_name = LuaArgOptional<std::string>(L, 2, "set1");
+  const auto interpolation_name = LuaArgOptional<std::string>(L, 3, "linear");
+  const auto resolution = LuaArgOptional<double>(L, 4, 1.0);
+
+  TemperatureInterpolation interpolation = TemperatureInterpolation::LINEAR;
+  if (interpolation_name == "sqrt")
+    interpolation = TemperatureInterpolation::SQRT_T;
+  else if (interpolation_name != "linear")
+    OpenSnInvalidArgument("Unknown temperature interpolation \"" + interpolation_name + "\" in " +
+                          fname + ". Expected \"linear\" or \"sqrt\".");
+
+  auto txs =
+    std::make_shared<TemperatureDependentXS>(file_name, dataset_name, interpolation, resolution);
+  opensn::temperature_dependent_xs_stack.push_back(txs);
+
+  const size_t index = opensn::temperature_dependent_xs_stack.size() - 1;
+  return LuaReturn(L, index);
+}
+
 } // namespace opensnlua
@@ -212,4 +212,25 @@ int XSGet(lua_State* L);
  */
 int XSExportToOpenSnFormat(lua_State* L);
 
+/**
+ * Creates temperature-dependent cross sections from all temperature datasets of an OpenMC
+ * cross-section library. The cross sections are interpolated between the tabulated temperatures
+ * and are assigned to cells with lbs.SetCellTemperatures.
+ *
+ * \param FileName string The OpenMC MGXS library file.
+ * \param DatasetName string The name of the dataset within the library. [Default="set1"]
+ * \param Interpolation string Temperature interpolation scheme, "linear" or "sqrt".
+ *                             [Default="linear"]
+ * \param Resolution double Temperature quantum (in K) on which interpolated cross sections are
+ *                          cached. [Default=1.0]
+ *
+ * \code
+ * txs = xs.CreateTemperatureDependent("uo2.h5", "set1", "sqrt", 1.0)
+ * \endcode
+ * \return Returns a handle to the temperature-dependent cross sections.
+ *
+ * \ingroup LuaTransportXSs
+ */
+int XSCreateTemperatureDependent(lua_State* L);
+
 } // namespace opensnlua
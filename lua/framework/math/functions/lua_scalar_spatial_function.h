@@ -15,8 +15,12 @@ public:
   explicit LuaScalarSpatialFunction(const opensn::InputParameters& params);
   double Evaluate(const opensn::Vector3& xyz) const override;
 
+  void Evaluate(const std::vector<opensn::Vector3>& xyz,
+                std::vector<double>& values) const override;
+
 private:
   const std::string lua_function_name_;
+  const bool batched_;
 };
 
 } // namespace opensnlua
@@ -19,12 +19,18 @@ LuaScalarSpatialMaterialFunction::GetInputParameters()
 {
   InputParameters params = ScalarSpatialMaterialFunction::GetInputParameters();
   params.AddRequiredParameter<std::string>("lua_function_name", "Name of the lua function");
+  params.AddOptionalParameter("batched",
+                              false,
+                              "If true, batches of points are evaluated with a single call to the "
+                              "lua function. The function is then passed an array of points and "
+                              "must return an array with one value per point.");
   return params;
 }
 
 LuaScalarSpatialMaterialFunction::LuaScalarSpatialMaterialFunction(const InputParameters& params)
   : ScalarSpatialMaterialFunction(params),
-    lua_function_name_(params.GetParamValue<std::string>("lua_function_name"))
+    lua_function_name_(params.GetParamValue<std::string>("lua_function_name")),
+    batched_(params.GetParamValue<bool>("batched"))
 {
 }
 
@@ -35,4 +41,25 @@ LuaScalarSpatialMaterialFunction::Evaluate(int mat_id, const opensn::Vector3& xy
   return LuaCall<double>(L, lua_function_name_, mat_id, xyz);
 }
 
+void
+LuaScalarSpatialMaterialFunction::Evaluate(int mat_id,
+                                           const std::vector<opensn::Vector3>& xyz,
+                                           std::vector<double>& values) const
+{
+  if (not batched_)
+  {
+    ScalarSpatialMaterialFunction::Evaluate(mat_id, xyz, values);
+    return;
+  }
+
+  lua_State* L = console.GetConsoleState();
+  values = LuaCall<std::vector<double>>(L, lua_function_name_, mat_id, xyz);
+
+  // Check return value
+  OpenSnLogicalErrorIf(values.size() != xyz.size(),
+                       "Call to lua function " + lua_function_name_ +
+                         " returned a vector of size " + std::to_string(values.size()) +
+                         " for a batch of " + std::to_string(xyz.size()) + " points.");
+}
+
 } // namespace opensnlua
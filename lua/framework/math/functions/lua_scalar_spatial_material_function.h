@@ -15,8 +15,13 @@ public:
   explicit LuaScalarSpatialMaterialFunction(const opensn::InputParameters& params);
   double Evaluate(int mat_id, const opensn::Vector3& xyz) const override;
 
+  void Evaluate(int mat_id,
+                const std::vector<opensn::Vector3>& xyz,
+                std::vector<double>& values) const override;
+
 private:
   const std::string lua_function_name_;
+  const bool batched_;
 };
 
 } // namespace opensnlua
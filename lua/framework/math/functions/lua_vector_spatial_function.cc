@@ -19,12 +19,19 @@ LuaVectorSpatialFunction::GetInputParameters()
 {
   InputParameters params = VectorSpatialFunction::GetInputParameters();
   params.AddRequiredParameter<std::string>("lua_function_name", "Name of the lua function");
+  params.AddOptionalParameter("batched",
+                              false,
+                              "If true, batches of points are evaluated with a single call to the "
+                              "lua function. The function is then passed an array of points and "
+                              "must return an array with the components of each point, stored "
+                              "point by point.");
   return params;
 }
 
 LuaVectorSpatialFunction::LuaVectorSpatialFunction(const opensn::InputParameters& params)
   : opensn::VectorSpatialFunction(params),
-    lua_function_name_(params.GetParamValue<std::string>("lua_function_name"))
+    lua_function_name_(params.GetParamValue<std::string>("lua_function_name")),
+    batched_(params.GetParamValue<bool>("batched"))
 {
 }
 
@@ -44,4 +51,25 @@ LuaVectorSpatialFunction::Evaluate(const opensn::Vector3& xyz, int num_component
   return lua_return;
 }
 
+void
+LuaVectorSpatialFunction::Evaluate(const std::vector<opensn::Vector3>& xyz,
+                                   int num_components,
+                                   std::vector<double>& values) const
+{
+  if (not batched_)
+  {
+    VectorSpatialFunction::Evaluate(xyz, num_components, values);
+    return;
+  }
+
+  lua_State* L = console.GetConsoleState();
+  values = LuaCall<std::vector<double>>(L, lua_function_name_, xyz);
+
+  // Check return value
+  OpenSnLogicalErrorIf(values.size() != xyz.size() * num_components,
+                       "Call to lua function " + lua_function_name_ +
+                         " returned a vector of size " + std::to_string(values.size()) +
+                         " for a batch of " + std::to_string(xyz.size()) + " points.");
+}
+
 } // namespace opensnlua
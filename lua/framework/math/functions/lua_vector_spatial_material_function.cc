@@ -19,12 +19,19 @@ LuaVectorSpatialMaterialFunction::GetInputParameters()
 {
   InputParameters params = VectorSpatialMaterialFunction::GetInputParameters();
   params.AddRequiredParameter<std::string>("lua_function_name", "Name of the lua function");
+  params.AddOptionalParameter("batched",
+                              false,
+                              "If true, batches of points are evaluated with a single call to the "
+                              "lua function. The function is then passed an array of points and "
+                              "must return an array with the components of each point, stored "
+                              "point by point.");
   return params;
 }
 
 LuaVectorSpatialMaterialFunction::LuaVectorSpatialMaterialFunction(const InputParameters& params)
   : opensn::VectorSpatialMaterialFunction(params),
-    lua_function_name_(params.GetParamValue<std::string>("lua_function_name"))
+    lua_function_name_(params.GetParamValue<std::string>("lua_function_name")),
+    batched_(params.GetParamValue<bool>("batched"))
 {
 }
 
@@ -47,4 +54,26 @@ LuaVectorSpatialMaterialFunction::Evaluate(const opensn::Vector3& xyz,
   return lua_return;
 }
 
+void
+LuaVectorSpatialMaterialFunction::Evaluate(const std::vector<opensn::Vector3>& xyz,
+                                           int mat_id,
+                                           int num_components,
+                                           std::vector<double>& values) const
+{
+  if (not batched_)
+  {
+    VectorSpatialMaterialFunction::Evaluate(xyz, mat_id, num_components, values);
+    return;
+  }
+
+  lua_State* L = console.GetConsoleState();
+  values = LuaCall<std::vector<double>>(L, lua_function_name_, xyz, mat_id);
+
+  // Check return value
+  OpenSnLogicalErrorIf(values.size() != xyz.size() * num_components,
+                       "Call to lua function " + lua_function_name_ +
+                         " returned a vector of size " + std::to_string(values.size()) +
+                         " for a batch of " + std::to_string(xyz.size()) + " points.");
+}
+
 } // namespace opensnlua
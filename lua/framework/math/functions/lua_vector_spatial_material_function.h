@@ -18,8 +18,14 @@ public:
   std::vector<double>
   Evaluate(const opensn::Vector3& xyz, int mat_id, int num_components) const override;
 
+  void Evaluate(const std::vector<opensn::Vector3>& xyz,
+                int mat_id,
+                int num_components,
+                std::vector<double>& values) const override;
+
 private:
   const std::string lua_function_name_;
+  const bool batched_;
 };
 
 } // namespace opensnlua
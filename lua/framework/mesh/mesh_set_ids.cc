@@ -8,6 +8,7 @@
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
 #include "framework/mesh/logical_volume/logical_volume.h"
+#include "framework/math/functions/scalar_spatial_material_function.h"
 
 namespace opensnlua
 {
@@ -16,6 +17,9 @@ RegisterLuaFunctionInNamespace(MeshSetUniformMaterialID, mesh, SetUniformMateria
 RegisterLuaFunctionInNamespace(MeshSetMaterialIDFromLogicalVolume,
                                mesh,
                                SetMaterialIDFromLogicalVolume);
+RegisterLuaFunctionInNamespace(MeshSetMaterialIDFromLogicalVolumes,
+                               mesh,
+                               SetMaterialIDFromLogicalVolumes);
 RegisterLuaFunctionInNamespace(MeshSetBoundaryIDFromLogicalVolume,
                                mesh,
                                SetBoundaryIDFromLogicalVolume);
@@ -61,10 +65,54 @@ MeshSetMaterialIDFromLogicalVolume(lua_State* L)
   return LuaReturn(L);
 }
 
+int
+MeshSetMaterialIDFromLogicalVolumes(lua_State* L)
+{
+  const std::string fname = "mesh.SetMaterialIDFromLogicalVolumes";
+  LuaCheckArgs<std::vector<size_t>, std::vector<int>>(L, fname);
+
+  const auto volume_handles = LuaArg<std::vector<size_t>>(L, 1);
+  const auto mat_ids = LuaArg<std::vector<int>>(L, 2);
+  OpenSnInvalidArgumentIf(volume_handles.size() != mat_ids.size(),
+                          "The number of logical volumes (" +
+                            std::to_string(volume_handles.size()) +
+                            ") must match the number of material ids (" +
+                            std::to_string(mat_ids.size()) + ").");
+
+  std::vector<std::pair<const LogicalVolume*, int>> volume_mat_ids;
+  volume_mat_ids.reserve(volume_handles.size());
+  for (size_t v = 0; v < volume_handles.size(); ++v)
+    volume_mat_ids.emplace_back(
+      &opensn::GetStackItem<LogicalVolume>(opensn::object_stack, volume_handles[v], fname),
+      mat_ids[v]);
+
+  opensn::log.Log0Verbose1() << program_timer.GetTimeString()
+                             << " Setting material id from logical volumes.";
+  std::shared_ptr<MeshContinuum> mesh = GetCurrentMesh();
+  mesh->SetMaterialIDFromLogicalVolumes(volume_mat_ids);
+
+  return LuaReturn(L);
+}
+
 int
 MeshSetMaterialIDFromLuaFunction(lua_State* L)
 {
   const std::string fname = "mesh.SetMaterialIDFromLuaFunction";
+
+  // A function handle is evaluated in batches by the mesh
+  if (lua_gettop(L) >= 1 and lua_type(L, 1) == LUA_TNUMBER)
+  {
+    const auto function_handle = LuaArg<size_t>(L, 1);
+    const auto& function = opensn::GetStackItem<ScalarSpatialMaterialFunction>(
+      opensn::object_stack, function_handle, fname);
+
+    opensn::log.Log0Verbose1() << program_timer.GetTimeString()
+                               << " Setting material id from function.";
+    GetCurrentMesh()->SetMaterialIDFromFunction(function);
+
+    return LuaReturn(L);
+  }
+
   LuaCheckArgs<std::string>(L, fname);
 
   opensn::log.Log0Verbose1() << program_timer.GetTimeString()
@@ -113,6 +161,23 @@ int
 MeshSetBoundaryIDFromLuaFunction(lua_State* L)
 {
   const std::string fname = "mesh.SetBoundaryIDFromFunction";
+
+  // A function handle is evaluated in batches by the mesh
+  if (lua_gettop(L) >= 1 and lua_type(L, 1) == LUA_TNUMBER)
+  {
+    LuaCheckArgs<size_t, std::vector<std::string>>(L, fname);
+    const auto function_handle = LuaArg<size_t>(L, 1);
+    const auto boundary_names = LuaArg<std::vector<std::string>>(L, 2);
+    const auto& function = opensn::GetStackItem<ScalarSpatialMaterialFunction>(
+      opensn::object_stack, function_handle, fname);
+
+    opensn::log.Log0Verbose1() << program_timer.GetTimeString()
+                               << " Setting boundary id from function.";
+    GetCurrentMesh()->SetBoundaryIDFromFunction(function, boundary_names);
+
+    return LuaReturn(L);
+  }
+
   LuaCheckArgs<std::string>(L, fname);
 
   OpenSnLogicalErrorIf(opensn::mpi_comm.size() != 1, "Can for now only be used in serial.");
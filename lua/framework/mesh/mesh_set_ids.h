@@ -21,12 +21,23 @@ int MeshSetUniformMaterialID(lua_State* L);
  *   --stuff
  * end
  * \endcode
+ *
+ * Instead of a lua function name, the argument may be a handle to a `ScalarSpatialMaterialFunction`
+ * of the current material id and the centroid, such as an `ExpressionScalarSpatialMaterialFunction`
+ * or a batched `LuaScalarSpatialMaterialFunction`. It is then evaluated in batches of cells.
  */
 int MeshSetMaterialIDFromLuaFunction(lua_State* L);
 
 /// Set specified material IDs using a LogicalVolume
 int MeshSetMaterialIDFromLogicalVolume(lua_State* L);
 
+/**
+ * Sets material IDs from an array of LogicalVolume handles and an array of material IDs, one per
+ * volume, in a single pass over the cells. Cells inside several volumes get the material ID of
+ * the last one.
+ */
+int MeshSetMaterialIDFromLogicalVolumes(lua_State* L);
+
 /**
  * Sets boundary id's using a lua function. The lua function is called for each boundary face
  * with 7 arguments, the face's centroid x,y,z values, the face's normal x,y,z values and the
@@ -38,6 +49,12 @@ int MeshSetMaterialIDFromLogicalVolume(lua_State* L);
  * --stuff
  * end
  * \endcode
+ *
+ * Alternatively, the first argument can be the handle of a ScalarSpatialMaterialFunction
+ * followed by a list of boundary names. The function is then evaluated in batches with the
+ * face's current boundary id as its material ID and the face centroid as its location. Its
+ * value is a zero-based index into the list of boundary names; negative values keep the
+ * current boundary id. This form also runs in parallel.
  */
 int MeshSetBoundaryIDFromLuaFunction(lua_State* L);
 
@@ -43,4 +43,17 @@ int ExportFieldFunctionToVTK(lua_State* L);
  */
 int ExportMultiFieldFunctionToVTK(lua_State* L);
 
+/**
+ * Exports all the field functions in a list to a single parallel HDF5 file with an XDMF index.
+ * The mesh is written by the first export with a base name; every export appends a time step.
+ *
+ * \param listFFHandles table Global handles to the field functions
+ * \param BaseName char Base name for the exported `.h5` and `.xmf` files.
+ * \param Time double Optional. Time of the step. Defaults to the step index.
+ * \param SinglePrecision bool Optional. Stores the values as 32-bit floats. Default: false.
+ *
+ * \ingroup LuaFieldFunc
+ */
+int ExportMultiFieldFunctionToXDMF(lua_State* L);
+
 } // namespace opensnlua
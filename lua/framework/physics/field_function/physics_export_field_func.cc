@@ -15,6 +15,7 @@ namespace opensnlua
 
 RegisterLuaFunctionInNamespace(ExportFieldFunctionToVTK, fieldfunc, ExportToVTK);
 RegisterLuaFunctionInNamespace(ExportMultiFieldFunctionToVTK, fieldfunc, ExportToVTKMulti);
+RegisterLuaFunctionInNamespace(ExportMultiFieldFunctionToXDMF, fieldfunc, ExportToXDMF);
 
 int
 ExportFieldFunctionToVTK(lua_State* L)
@@ -62,4 +63,34 @@ ExportMultiFieldFunctionToVTK(lua_State* L)
   return LuaReturn(L);
 }
 
+int
+ExportMultiFieldFunctionToXDMF(lua_State* L)
+{
+  const std::string fname = "fieldfunc.ExportToXDMF";
+  LuaCheckArgs<std::vector<size_t>, std::string>(L, fname);
+
+  auto ff_handles = LuaArg<std::vector<size_t>>(L, 1);
+  auto base_name = LuaArg<std::string>(L, 2);
+  std::optional<double> time;
+  if (lua_gettop(L) >= 3)
+    time = LuaArg<double>(L, 3);
+  auto single_precision = LuaArgOptional<bool>(L, 4, false);
+
+  FieldFunctionGridBased::FFList ffs;
+  ffs.reserve(ff_handles.size());
+  for (std::size_t i = 0; i < ff_handles.size(); ++i)
+  {
+    std::shared_ptr<FieldFunction> ff_base =
+      opensn::GetStackItemPtr(opensn::field_function_stack, ff_handles[i], fname);
+    auto ff = std::dynamic_pointer_cast<FieldFunctionGridBased>(ff_base);
+    OpenSnLogicalErrorIf(not ff, "Only grid-based field functions can be exported");
+
+    ffs.push_back(ff);
+  }
+
+  FieldFunctionGridBased::ExportMultipleToXDMF(base_name, ffs, time, single_precision);
+
+  return LuaReturn(L);
+}
+
 } // namespace opensnlua
@@ -81,8 +81,7 @@ ExecutePostProcessors(const InputParameters& params)
                           ">. Only ARRAY<STRING> or ARRAY<INTEGER> is allowed.");
 
   Event blank_event("ManualExecutation");
-  for (auto& pp : pp_list)
-    pp->Execute(blank_event);
+  PostProcessor::ExecuteBatch(pp_list, blank_event);
 
   return ParameterBlock{};
 }
@@ -3,6 +3,8 @@
 
 #include "lua/framework/console/console.h"
 #include "lua/framework/math/functions/lua_scalar_spatial_material_function.h"
+#include "lua/framework/lua.h"
+#include "framework/math/functions/expression_scalar_spatial_material_function.h"
 #include "framework/parameters/input_parameters.h"
 #include "framework/runtime.h"
 #include "framework/physics/solver.h"
@@ -17,11 +19,33 @@ namespace opensnlua
 namespace
 {
 
-std::shared_ptr<LuaScalarSpatialMaterialFunction>
-CreateFunction(const std::string& function_name)
+/**
+ * Creates the coefficient function with the given name. If the lua global with this name is a
+ * string or a number, it is compiled as an expression of `mat_id`, `x`, `y` and `z`. Otherwise
+ * it must be a lua function.
+ */
+std::shared_ptr<opensn::ScalarSpatialMaterialFunction>
+CreateFunction(const std::string& function_name, bool batched)
 {
+  lua_State* L = console.GetConsoleState();
+  lua_getglobal(L, function_name.c_str());
+  const int type = lua_type(L, -1);
+  const std::string expression =
+    (type == LUA_TSTRING or type == LUA_TNUMBER) ? lua_tostring(L, -1) : "";
+  lua_pop(L, 1);
+
+  if (not expression.empty())
+  {
+    opensn::ParameterBlock blk;
+    blk.AddParameter("expression", expression);
+    auto params = opensn::ExpressionScalarSpatialMaterialFunction::GetInputParameters();
+    params.AssignParameters(blk);
+    return std::make_shared<opensn::ExpressionScalarSpatialMaterialFunction>(params);
+  }
+
   opensn::ParameterBlock blk;
   blk.AddParameter("lua_function_name", function_name);
+  blk.AddParameter("batched", batched);
   opensn::InputParameters params = LuaScalarSpatialMaterialFunction::GetInputParameters();
   params.AssignParameters(blk);
   return std::make_shared<LuaScalarSpatialMaterialFunction>(params);
@@ -38,14 +62,15 @@ CFEMSetOptions(const opensn::InputParameters& params)
 
   params.RequireParameter("arg0");
   params.RequireParameter("arg1");
+  const auto batched_functions = params.GetParamValue<bool>("arg2");
 
-  auto d_coef_function = CreateFunction("D_coef");
+  auto d_coef_function = CreateFunction("D_coef", batched_functions);
   opensn::function_stack.push_back(d_coef_function);
 
-  auto q_ext_function = CreateFunction("Q_ext");
+  auto q_ext_function = CreateFunction("Q_ext", batched_functions);
   opensn::function_stack.push_back(q_ext_function);
 
-  auto sigma_a_function = CreateFunction("Sigma_a");
+  auto sigma_a_function = CreateFunction("Sigma_a", batched_functions);
   opensn::function_stack.push_back(sigma_a_function);
 
   const size_t handle = params.GetParamValue<size_t>("arg0");
@@ -72,14 +97,15 @@ DFEMSetOptions(const opensn::InputParameters& params)
 
   params.RequireParameter("arg0");
   params.RequireParameter("arg1");
+  const auto batched_functions = params.GetParamValue<bool>("arg2");
 
-  auto d_coef_function = CreateFunction("D_coef");
+  auto d_coef_function = CreateFunction("D_coef", batched_functions);
   opensn::function_stack.push_back(d_coef_function);
 
-  auto q_ext_function = CreateFunction("Q_ext");
+  auto q_ext_function = CreateFunction("Q_ext", batched_functions);
   opensn::function_stack.push_back(q_ext_function);
 
-  auto sigma_a_function = CreateFunction("Sigma_a");
+  auto sigma_a_function = CreateFunction("Sigma_a", batched_functions);
   opensn::function_stack.push_back(sigma_a_function);
 
   const size_t handle = params.GetParamValue<size_t>("arg0");
@@ -106,14 +132,15 @@ FVSetOptions(const opensn::InputParameters& params)
 
   params.RequireParameter("arg0");
   params.RequireParameter("arg1");
+  const auto batched_functions = params.GetParamValue<bool>("arg2");
 
-  auto d_coef_function = CreateFunction("D_coef");
+  auto d_coef_function = CreateFunction("D_coef", batched_functions);
   opensn::function_stack.push_back(d_coef_function);
 
-  auto q_ext_function = CreateFunction("Q_ext");
+  auto q_ext_function = CreateFunction("Q_ext", batched_functions);
   opensn::function_stack.push_back(q_ext_function);
 
-  auto sigma_a_function = CreateFunction("Sigma_a");
+  auto sigma_a_function = CreateFunction("Sigma_a", batched_functions);
   opensn::function_stack.push_back(sigma_a_function);
 
   const size_t handle = params.GetParamValue<size_t>("arg0");
@@ -166,6 +193,13 @@ GetSyntax_SetOptions()
   params.AddRequiredParameter<size_t>("arg0", "Handle to a `CFEMSolver` object.");
   params.AddRequiredParameterBlock("arg1", "Block of parameters for `OptionsBlock`");
   params.LinkParameterToBlock("arg1", "OptionsBlock");
+  params.AddOptionalParameter("arg2",
+                              false,
+                              "If true, the lua functions `D_coef`, `Q_ext` and `Sigma_a` are "
+                              "called once per batch of points with an array of points, and "
+                              "must return an array with one value per point. Coefficients "
+                              "given as expression strings instead of lua functions are always "
+                              "evaluated in batches.");
   return params;
 }
 
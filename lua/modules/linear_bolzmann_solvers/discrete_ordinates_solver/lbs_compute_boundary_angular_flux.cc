@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "lua/modules/linear_bolzmann_solvers/discrete_ordinates_solver/lbs_do_lua_utils.h"
+#include "lua/framework/console/console.h"
+#include "framework/runtime.h"
+#include "framework/math/quadratures/angular/angular_quadrature.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/lbs_discrete_ordinates_solver.h"
+
+namespace opensnlua
+{
+
+RegisterLuaFunctionInNamespace(ComputeBoundaryAngularFlux, lbs, ComputeBoundaryAngularFlux);
+
+namespace
+{
+
+struct LuaBoundaryAngularFlux
+{
+  opensn::Vector3 omega;
+  double weight;
+  std::vector<double> psi;
+};
+
+void
+LuaPush(lua_State* L, const LuaBoundaryAngularFlux& data)
+{
+  lua_newtable(L);
+  LuaPushTableKey(L, "omega", data.omega);
+  LuaPushTableKey(L, "weight", data.weight);
+  LuaPushTableKey(L, "psi", data.psi);
+}
+
+} // namespace
+
+int
+ComputeBoundaryAngularFlux(lua_State* L)
+{
+  const auto fname = "lbs.ComputeBoundaryAngularFlux";
+  LuaCheckArgs<size_t, int, std::string>(L, fname);
+
+  // Get the solver
+  const auto solver_handle = LuaArg<size_t>(L, 1);
+  const auto& solver = opensn::GetStackItem<opensn::DiscreteOrdinatesSolver>(
+    opensn::object_stack, solver_handle, fname);
+
+  const auto groupset_id = LuaArg<int>(L, 2);
+  const auto boundary_name = LuaArg<std::string>(L, 3);
+  const auto boundary_id =
+    opensn::DiscreteOrdinatesSolver::supported_boundary_names.at(boundary_name);
+
+  // Compute the angular flux
+  const auto psi = solver.ComputeBoundaryAngularFlux(groupset_id, boundary_id);
+
+  const auto& quadrature = solver.Groupsets().at(groupset_id).quadrature;
+  const auto num_gs_angles = quadrature->omegas.size();
+  const auto num_gs_groups = psi.size() / num_gs_angles;
+
+  std::vector<LuaBoundaryAngularFlux> ret_val(num_gs_angles);
+  for (size_t n = 0; n < num_gs_angles; ++n)
+    ret_val[n] = {quadrature->omegas[n],
+                  quadrature->weights[n],
+                  {psi.begin() + n * num_gs_groups, psi.begin() + (n + 1) * num_gs_groups}};
+  return LuaReturn(L, ret_val);
+}
+
+} // namespace opensnlua
@@ -32,4 +32,20 @@ int LBSComputeBalance(lua_State* L);
  */
 int ComputeLeakage(lua_State* L);
 
+/**
+ * Returns the surface-integrated angular flux on a boundary, tallied during the last sweep of a
+ * groupset. Requires the `tally_boundary_angular_flux` option.
+ *
+ * \param SolverIndex int Handle to the solver.
+ * \param GroupsetIndex int Index of the groupset.
+ * \param BoundaryName string One of the standard boundary names used in OpenSn:
+ *      xmax, xmin, ymax, ymin, zmax, zmin
+ *
+ * \return An array with one entry per groupset direction. Each entry is a table with the
+ *      fields `omega`, `weight` and `psi`, the last holding one value per groupset group.
+ *
+ * \ingroup LBSLuaFunctions
+ */
+int ComputeBoundaryAngularFlux(lua_State* L);
+
 } // namespace opensnlua
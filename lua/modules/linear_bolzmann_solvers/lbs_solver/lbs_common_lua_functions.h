@@ -164,6 +164,42 @@ int LBSReadFluxMoments(lua_State* L);
  */
 int LBSComputeFissionRate(lua_State* L);
 
+/**
+ * Computes and returns the prompt neutron generation time of the flux shape, i.e. the ratio of
+ * the total neutron density to the total fission production. Both are integrated with a unit
+ * weight function.
+ *
+ * \param SolverIndex int Handle to the solver maintaining the information.
+ * \param OldNewOption string "NEW" or "OLD". Selects the flux used as the shape.
+ *
+ * \return double The generation time.
+ *
+ * \ingroup LBSLuaFunctions
+ */
+int LBSComputeGenerationTime(lua_State* L);
+
+/**
+ * Sets the temperature of each local cell and assigns it the cross sections of its material
+ * interpolated at that temperature. The temperatures are evaluated at the cell centroids. Cells
+ * whose material has no temperature-dependent cross sections keep those of their material. The
+ * solver must be initialized. Diffusion acceleration owned by a k-eigenvalue executor is only
+ * rebuilt when the executor is initialized again.
+ *
+ * \param SolverIndex int Handle to the solver maintaining the information.
+ * \param MaterialXS table Map of material ids to handles of temperature-dependent cross sections
+ *                         created with xs.CreateTemperatureDependent.
+ * \param Function int Handle to a scalar spatial material function giving the temperature (in K).
+ *
+ * \code
+ * txs = xs.CreateTemperatureDependent("uo2.h5")
+ * temperature = opensn.ExpressionScalarSpatialMaterialFunction.Create({ expression = "600 + 100*x" })
+ * lbs.SetCellTemperatures(phys, { [0] = txs }, temperature)
+ * \endcode
+ *
+ * \ingroup LBSLuaFunctions
+ */
+int LBSSetCellTemperatures(lua_State* L);
+
 /**
  * Initializes or reinitializes the materials. This normally happens
  * automatically during solver initialization but if the user wants to
@@ -13,6 +13,7 @@ namespace opensnlua
 {
 
 RegisterLuaFunctionInNamespace(LBSComputeFissionRate, lbs, ComputeFissionRate);
+RegisterLuaFunctionInNamespace(LBSComputeGenerationTime, lbs, ComputeGenerationTime);
 
 int
 LBSComputeFissionRate(lua_State* L)
@@ -32,4 +33,22 @@ LBSComputeFissionRate(lua_State* L)
   return LuaReturn(L, fission_rate);
 }
 
+int
+LBSComputeGenerationTime(lua_State* L)
+{
+  const std::string fname = "lbs.ComputeGenerationTime";
+  LuaCheckArgs<size_t, std::string>(L, fname);
+
+  // Get pointer to solver
+  const auto solver_handle = LuaArg<size_t>(L, 1);
+  auto& lbs_solver =
+    opensn::GetStackItem<opensn::LBSSolver>(opensn::object_stack, solver_handle, fname);
+
+  const auto nature = LuaArg<std::string>(L, 2);
+  const auto& phi = nature == "OLD" ? lbs_solver.PhiOldLocal() : lbs_solver.PhiNewLocal();
+
+  const double generation_time = lbs_solver.ComputeGenerationTime(phi);
+  return LuaReturn(L, generation_time);
+}
+
 } // namespace opensnlua
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "lua/modules/linear_bolzmann_solvers/lbs_solver/lbs_common_lua_functions.h"
+#include "lua/framework/lua.h"
+#include "lua/framework/console/console.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "framework/materials/multi_group_xs/temperature_dependent_xs.h"
+#include "framework/math/functions/scalar_spatial_material_function.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/runtime.h"
+
+using namespace opensn;
+
+namespace opensnlua
+{
+
+RegisterLuaFunctionInNamespace(LBSSetCellTemperatures, lbs, SetCellTemperatures);
+
+int
+LBSSetCellTemperatures(lua_State* L)
+{
+  const std::string fname = "lbs.SetCellTemperatures";
+  LuaCheckArgs<size_t, std::map<int, size_t>, size_t>(L, fname);
+
+  // Get pointer to solver
+  const auto solver_handle = LuaArg<size_t>(L, 1);
+  auto& lbs_solver =
+    opensn::GetStackItem<opensn::LBSSolver>(opensn::object_stack, solver_handle, fname);
+
+  // Get the temperature-dependent cross sections of each material
+  const auto matid_to_txs_handle = LuaArg<std::map<int, size_t>>(L, 2);
+  std::map<int, std::shared_ptr<TemperatureDependentXS>> matid_to_txs_map;
+  for (const auto& [mat_id, txs_handle] : matid_to_txs_handle)
+    matid_to_txs_map[mat_id] =
+      opensn::GetStackItemPtr(opensn::temperature_dependent_xs_stack, txs_handle, fname);
+
+  const auto function_handle = LuaArg<size_t>(L, 3);
+  const auto& function = opensn::GetStackItem<ScalarSpatialMaterialFunction>(
+    opensn::object_stack, function_handle, fname);
+
+  // Evaluate the temperatures at the cell centroids, batched per material
+  const auto& grid = lbs_solver.Grid();
+  std::map<int, std::vector<uint64_t>> matid_to_local_ids;
+  for (const auto& cell : grid.local_cells)
+    matid_to_local_ids[cell.material_id].push_back(cell.local_id);
+
+  std::vector<double> cell_temperatures(grid.local_cells.size(), 0.0);
+  std::vector<Vector3> centroids;
+  std::vector<double> temperatures;
+  for (const auto& [mat_id, local_ids] : matid_to_local_ids)
+  {
+    centroids.clear();
+    for (const auto local_id : local_ids)
+      centroids.push_back(grid.local_cells[local_id].centroid);
+
+    function.Evaluate(mat_id, centroids, temperatures);
+    for (size_t i = 0; i < local_ids.size(); ++i)
+      cell_temperatures[local_ids[i]] = temperatures[i];
+  }
+
+  lbs_solver.SetCellTemperatures(matid_to_txs_map, cell_temperatures);
+
+  return LuaReturn(L);
+}
+
+} // namespace opensnlua
@@ -28,7 +28,7 @@ GetSyntax_SetParam()
 
   params.AddRequiredParameter<double>("arg2", "Value to set to the parameter pointed to by arg1");
 
-  params.ConstrainParameterRange("arg1", AllowableRangeList::New({"rho"}));
+  params.ConstrainParameterRange("arg1", AllowableRangeList::New({"rho", "gen_time"}));
 
   return params;
 }
@@ -50,6 +50,12 @@ SetParam(const InputParameters& params)
                             "If arg1 is \"rho\" then arg2 must be of type FLOAT");
     solver.SetRho(value_param.GetValue<double>());
   }
+  else if (param_name == "gen_time")
+  {
+    OpenSnInvalidArgumentIf(value_param.Type() != ParameterBlockType::FLOAT,
+                            "If arg1 is \"gen_time\" then arg2 must be of type FLOAT");
+    solver.SetGenerationTime(value_param.GetValue<double>());
+  }
   else
     OpenSnInvalidArgument("Invalid property name \"" + param_name);
 
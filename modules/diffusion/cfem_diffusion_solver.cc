@@ -9,6 +9,7 @@
 #include "framework/math/functions/scalar_spatial_material_function.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/math/spatial_discretization/finite_element/piecewise_linear/piecewise_linear_continuous.h"
+#include <algorithm>
 
 namespace opensn
 {
@@ -18,7 +19,13 @@ OpenSnRegisterSyntaxBlockInNamespace(diffusion,
                                      CFEMBoundaryOptionsBlock,
                                      CFEMDiffusionSolver::BoundaryOptionsBlock);
 
-CFEMDiffusionSolver::CFEMDiffusionSolver(const std::string& name) : DiffusionSolverBase(name)
+CFEMDiffusionSolver::CFEMDiffusionSolver(const std::string& name)
+  : DiffusionSolverBase(name),
+    matrix_free_(false),
+    matrix_free_preconditioner_("gamg"),
+    A_shell_(nullptr),
+    x_ghosted_(nullptr),
+    y_ghosted_(nullptr)
 {
 }
 
@@ -28,6 +35,22 @@ CFEMDiffusionSolver::GetInputParameters()
   InputParameters params = Solver::GetInputParameters();
   params.AddOptionalParameter<double>("residual_tolerance", 1.0e-2, "Solver relative tolerance");
   params.AddOptionalParameter<int>("max_iters", 500, "Solver relative tolerance");
+  params.AddOptionalParameter<bool>(
+    "matrix_free",
+    false,
+    "If true, the system operator is applied cell by cell from the unit cell matrices and the "
+    "cell coefficients instead of being assembled into a global matrix. Only this solver has a "
+    "matrix-free operator: the DFEM diffusion solver and the diffusion acceleration (DSA) solvers "
+    "of the transport solvers always assemble their matrices.");
+  params.AddOptionalParameter<std::string>(
+    "matrix_free_preconditioner",
+    "gamg",
+    "Preconditioner used with the matrix-free operator. \"gamg\" still assembles the full "
+    "global matrix for the preconditioner, so it saves no matrix memory; only the operator "
+    "applications are matrix-free. \"jacobi\" takes the diagonal from the unit cell matrices and "
+    "assembles no global matrix at all.");
+  params.ConstrainParameterRange("matrix_free_preconditioner",
+                                 AllowableRangeList::New({"gamg", "jacobi"}));
   return params;
 }
 
@@ -49,12 +72,20 @@ CFEMDiffusionSolver::BoundaryOptionsBlock()
 }
 
 CFEMDiffusionSolver::CFEMDiffusionSolver(const InputParameters& params)
-  : DiffusionSolverBase(params)
+  : DiffusionSolverBase(params),
+    matrix_free_(params.GetParamValue<bool>("matrix_free")),
+    matrix_free_preconditioner_(params.GetParamValue<std::string>("matrix_free_preconditioner")),
+    A_shell_(nullptr),
+    x_ghosted_(nullptr),
+    y_ghosted_(nullptr)
 {
 }
 
 CFEMDiffusionSolver::~CFEMDiffusionSolver()
 {
+  MatDestroy(&A_shell_);
+  VecDestroy(&x_ghosted_);
+  VecDestroy(&y_ghosted_);
 }
 
 void
@@ -270,19 +301,263 @@ CFEMDiffusionSolver::Initialize()
   const auto n = static_cast<int64_t>(num_local_dofs_);
   const auto N = static_cast<int64_t>(num_global_dofs_);
 
-  A_ = CreateSquareMatrix(n, N);
   x_ = CreateVector(n, N);
   b_ = CreateVector(n, N);
 
-  std::vector<int64_t> nodal_nnz_in_diag;
-  std::vector<int64_t> nodal_nnz_off_diag;
-  sdm.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, OneDofPerNode);
+  // The assembled matrix is only needed when it is the operator or the preconditioner
+  if (not matrix_free_ or matrix_free_preconditioner_ == "gamg")
+  {
+    A_ = CreateSquareMatrix(n, N);
+
+    std::vector<int64_t> nodal_nnz_in_diag;
+    std::vector<int64_t> nodal_nnz_off_diag;
+    sdm.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, OneDofPerNode);
+
+    InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
+  }
 
-  InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
+  if (matrix_free_)
+    InitMatrixFreeOperator();
 
   InitFieldFunctions();
 }
 
+void
+CFEMDiffusionSolver::InitMatrixFreeOperator()
+{
+  const auto& grid = *grid_ptr_;
+  const auto& sdm = *sdm_ptr_;
+  const auto& OneDofPerNode = sdm.UNITARY_UNKNOWN_MANAGER;
+
+  const auto n = static_cast<int64_t>(num_local_dofs_);
+  const auto N = static_cast<int64_t>(num_global_dofs_);
+
+  const auto ghost_dof_indices = sdm.GetGhostDOFIndices(OneDofPerNode);
+  const auto num_ghosts = static_cast<int64_t>(ghost_dof_indices.size());
+  x_ghosted_ = CreateVectorWithGhosts(n, N, num_ghosts, ghost_dof_indices);
+  y_ghosted_ = CreateVectorWithGhosts(n, N, num_ghosts, ghost_dof_indices);
+
+  // Unit cell matrices. Only the integrals the operator needs are computed.
+  const size_t num_local_cells = grid.local_cells.size();
+  unit_cell_matrices_.assign(num_local_cells, UnitCellMatrices{});
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& cell_mapping = sdm.GetCellMapping(cell);
+    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+    const size_t num_nodes = cell_mapping.NumNodes();
+    const size_t num_faces = cell.faces.size();
+
+    auto& unit_matrices = unit_cell_matrices_[cell.local_id];
+    auto& K = unit_matrices.intV_gradshapeI_gradshapeJ;
+    auto& M = unit_matrices.intV_shapeI_shapeJ;
+    K = DenseMatrix<double>(num_nodes, num_nodes, 0.0);
+    M = DenseMatrix<double>(num_nodes, num_nodes, 0.0);
+    for (size_t i = 0; i < num_nodes; ++i)
+      for (size_t j = 0; j < num_nodes; ++j)
+        for (size_t qp : fe_vol_data.QuadraturePointIndices())
+        {
+          K(i, j) += fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) *
+                     fe_vol_data.JxW(qp);
+          M(i, j) +=
+            fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp) * fe_vol_data.JxW(qp);
+        }
+
+    // Surface mass matrices, only needed on Robin boundaries
+    unit_matrices.intS_shapeI_shapeJ.resize(num_faces);
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+      const auto& face = cell.faces[f];
+      if (face.has_neighbor or boundaries_[face.neighbor_id].type != BoundaryType::Robin)
+        continue;
+
+      const auto fe_srf_data = cell_mapping.MakeSurfaceFiniteElementData(f);
+      auto& S = unit_matrices.intS_shapeI_shapeJ[f];
+      S = DenseMatrix<double>(num_nodes, num_nodes, 0.0);
+      for (size_t i = 0; i < num_nodes; ++i)
+        for (size_t j = 0; j < num_nodes; ++j)
+          for (size_t qp : fe_srf_data.QuadraturePointIndices())
+            S(i, j) += fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(j, qp) *
+                       fe_srf_data.JxW(qp);
+    }
+  }
+
+  // Cell dof maps. The coefficients and boundary data are set during assembly.
+  cell_dof_offsets_.assign(num_local_cells + 1, 0);
+  for (const auto& cell : grid.local_cells)
+    cell_dof_offsets_[cell.local_id + 1] =
+      cell_dof_offsets_[cell.local_id] + sdm.GetCellMapping(cell).NumNodes();
+  cell_dofs_.resize(cell_dof_offsets_.back());
+  cell_dirichlet_nodes_.assign(cell_dof_offsets_.back(), 0);
+  for (const auto& cell : grid.local_cells)
+  {
+    const size_t num_nodes = sdm.GetCellMapping(cell).NumNodes();
+    for (size_t i = 0; i < num_nodes; ++i)
+      cell_dofs_[cell_dof_offsets_[cell.local_id] + i] = sdm.MapDOFLocal(cell, i);
+  }
+  cell_coefficients_.assign(num_local_cells, {0.0, 0.0});
+  cell_robin_faces_.assign(num_local_cells, {});
+
+  MatCreateShell(opensn::mpi_comm, n, n, N, N, this, &A_shell_);
+  MatShellSetOperation(A_shell_, MATOP_MULT, (void (*)())MatrixFreeMult);
+  MatShellSetOperation(A_shell_, MATOP_GET_DIAGONAL, (void (*)())MatrixFreeGetDiagonal);
+}
+
+void
+CFEMDiffusionSolver::ApplyCellOperator(size_t cell_local_id,
+                                       const double* x,
+                                       double* y,
+                                       std::vector<double>& x_cell,
+                                       std::vector<double>& y_cell) const
+{
+  const size_t offset = cell_dof_offsets_[cell_local_id];
+  const size_t num_nodes = cell_dof_offsets_[cell_local_id + 1] - offset;
+  const int64_t* dofs = &cell_dofs_[offset];
+  const char* dirichlet = &cell_dirichlet_nodes_[offset];
+  const auto& unit_matrices = unit_cell_matrices_[cell_local_id];
+
+  // Dirichlet columns are removed from the operator
+  for (size_t j = 0; j < num_nodes; ++j)
+    x_cell[j] = dirichlet[j] ? 0.0 : x[dofs[j]];
+
+  const auto variable = variable_coefficient_matrices_.find(cell_local_id);
+  if (variable != variable_coefficient_matrices_.end())
+  {
+    const auto& Acell = variable->second;
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      double yi = 0.0;
+      for (size_t j = 0; j < num_nodes; ++j)
+        yi += Acell(i, j) * x_cell[j];
+      y_cell[i] = yi;
+    }
+  }
+  else
+  {
+    const auto& [D, sigma_a] = cell_coefficients_[cell_local_id];
+    const auto& K = unit_matrices.intV_gradshapeI_gradshapeJ;
+    const auto& M = unit_matrices.intV_shapeI_shapeJ;
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      double yi = 0.0;
+      for (size_t j = 0; j < num_nodes; ++j)
+        yi += (D * K(i, j) + sigma_a * M(i, j)) * x_cell[j];
+      y_cell[i] = yi;
+    }
+  }
+
+  for (const auto& [f, a_over_b] : cell_robin_faces_[cell_local_id])
+  {
+    const auto& S = unit_matrices.intS_shapeI_shapeJ[f];
+    for (size_t i = 0; i < num_nodes; ++i)
+      for (size_t j = 0; j < num_nodes; ++j)
+        y_cell[i] += a_over_b * S(i, j) * x_cell[j];
+  }
+
+  // Dirichlet rows hold the identity, once per cell sharing the node
+  for (size_t i = 0; i < num_nodes; ++i)
+    y[dofs[i]] += dirichlet[i] ? x[dofs[i]] : y_cell[i];
+}
+
+PetscErrorCode
+CFEMDiffusionSolver::MatrixFreeMult(Mat A, Vec x, Vec y)
+{
+  CFEMDiffusionSolver* solver;
+  MatShellGetContext(A, &solver);
+
+  // Make the off-process entries of x available locally
+  VecCopy(x, solver->x_ghosted_);
+  CommunicateGhostEntries(solver->x_ghosted_);
+
+  Vec x_local, y_local;
+  VecGhostGetLocalForm(solver->x_ghosted_, &x_local);
+  VecGhostGetLocalForm(solver->y_ghosted_, &y_local);
+  VecSet(y_local, 0.0);
+
+  const double* x_raw;
+  double* y_raw;
+  VecGetArrayRead(x_local, &x_raw);
+  VecGetArray(y_local, &y_raw);
+
+  std::vector<double> x_cell, y_cell;
+  const auto num_cells = solver->cell_dof_offsets_.size() - 1;
+  for (size_t c = 0; c < num_cells; ++c)
+  {
+    const size_t num_nodes = solver->cell_dof_offsets_[c + 1] - solver->cell_dof_offsets_[c];
+    if (x_cell.size() < num_nodes)
+    {
+      x_cell.resize(num_nodes);
+      y_cell.resize(num_nodes);
+    }
+    solver->ApplyCellOperator(c, x_raw, y_raw, x_cell, y_cell);
+  }
+
+  VecRestoreArrayRead(x_local, &x_raw);
+  VecRestoreArray(y_local, &y_raw);
+  VecGhostRestoreLocalForm(solver->x_ghosted_, &x_local);
+  VecGhostRestoreLocalForm(solver->y_ghosted_, &y_local);
+
+  // Accumulate contributions to ghost entries on their owning processes
+  VecGhostUpdateBegin(solver->y_ghosted_, ADD_VALUES, SCATTER_REVERSE);
+  VecGhostUpdateEnd(solver->y_ghosted_, ADD_VALUES, SCATTER_REVERSE);
+  VecCopy(solver->y_ghosted_, y);
+
+  return 0;
+}
+
+PetscErrorCode
+CFEMDiffusionSolver::MatrixFreeGetDiagonal(Mat A, Vec diag)
+{
+  CFEMDiffusionSolver* solver;
+  MatShellGetContext(A, &solver);
+
+  Vec y_local;
+  VecGhostGetLocalForm(solver->y_ghosted_, &y_local);
+  VecSet(y_local, 0.0);
+
+  double* y_raw;
+  VecGetArray(y_local, &y_raw);
+
+  const auto num_cells = solver->cell_dof_offsets_.size() - 1;
+  for (size_t c = 0; c < num_cells; ++c)
+  {
+    const size_t offset = solver->cell_dof_offsets_[c];
+    const size_t num_nodes = solver->cell_dof_offsets_[c + 1] - offset;
+    const int64_t* dofs = &solver->cell_dofs_[offset];
+    const char* dirichlet = &solver->cell_dirichlet_nodes_[offset];
+    const auto& unit_matrices = solver->unit_cell_matrices_[c];
+    const auto& [D, sigma_a] = solver->cell_coefficients_[c];
+    const auto variable = solver->variable_coefficient_matrices_.find(c);
+
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      if (dirichlet[i])
+      {
+        y_raw[dofs[i]] += 1.0;
+        continue;
+      }
+
+      double aii = 0.0;
+      if (variable != solver->variable_coefficient_matrices_.end())
+        aii = variable->second(i, i);
+      else
+        aii = D * unit_matrices.intV_gradshapeI_gradshapeJ(i, i) +
+              sigma_a * unit_matrices.intV_shapeI_shapeJ(i, i);
+      for (const auto& [f, a_over_b] : solver->cell_robin_faces_[c])
+        aii += a_over_b * unit_matrices.intS_shapeI_shapeJ[f](i, i);
+      y_raw[dofs[i]] += aii;
+    }
+  }
+
+  VecRestoreArray(y_local, &y_raw);
+  VecGhostRestoreLocalForm(solver->y_ghosted_, &y_local);
+
+  VecGhostUpdateBegin(solver->y_ghosted_, ADD_VALUES, SCATTER_REVERSE);
+  VecGhostUpdateEnd(solver->y_ghosted_, ADD_VALUES, SCATTER_REVERSE);
+  VecCopy(solver->y_ghosted_, diag);
+
+  return 0;
+}
+
 void
 CFEMDiffusionSolver::Execute()
 {
@@ -293,6 +568,9 @@ CFEMDiffusionSolver::Execute()
 
   // Assemble the system
   log.Log() << "Assembling system: ";
+  Timer assembly_timer;
+  const bool assemble_matrix = (A_ != nullptr);
+  std::vector<double> d_coef_qp, sigma_a_qp, q_ext_qp;
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
@@ -303,6 +581,11 @@ CFEMDiffusionSolver::Execute()
     DenseMatrix<double> Acell(num_nodes, num_nodes, 0.0);
     Vector<double> cell_rhs(num_nodes, 0.0);
 
+    // Evaluate the coefficients at all quadrature points of the cell at once
+    d_coef_function_->Evaluate(imat, fe_vol_data.QPointsXYZ(), d_coef_qp);
+    sigma_a_function_->Evaluate(imat, fe_vol_data.QPointsXYZ(), sigma_a_qp);
+    q_ext_function_->Evaluate(imat, fe_vol_data.QPointsXYZ(), q_ext_qp);
+
     for (size_t i = 0; i < num_nodes; ++i)
     {
       for (size_t j = 0; j < num_nodes; ++j)
@@ -310,19 +593,34 @@ CFEMDiffusionSolver::Execute()
         double entry_aij = 0.0;
         for (size_t qp : fe_vol_data.QuadraturePointIndices())
         {
-          entry_aij += (d_coef_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) +
-                        sigma_a_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp)) *
-                       fe_vol_data.JxW(qp);
+          entry_aij +=
+            (d_coef_qp[qp] * fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) +
+             sigma_a_qp[qp] * fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp)) *
+            fe_vol_data.JxW(qp);
         } // for qp
         Acell(i, j) = entry_aij;
       } // for j
       for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        cell_rhs(i) += q_ext_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                       fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
+        cell_rhs(i) += q_ext_qp[qp] * fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
     } // for i
 
+    // The matrix-free operator applies the unit cell matrices with the cell coefficients, unless
+    // the coefficients vary within the cell
+    if (matrix_free_)
+    {
+      const auto is_uniform = [](const std::vector<double>& values)
+      {
+        return std::all_of(
+          values.begin(), values.end(), [&values](double v) { return v == values.front(); });
+      };
+      variable_coefficient_matrices_.erase(cell.local_id);
+      if (is_uniform(d_coef_qp) and is_uniform(sigma_a_qp))
+        cell_coefficients_[cell.local_id] = {d_coef_qp.front(), sigma_a_qp.front()};
+      else
+        variable_coefficient_matrices_[cell.local_id] = Acell;
+      cell_robin_faces_[cell.local_id].clear();
+    }
+
     // Flag nodes for being on a boundary
     std::vector<int> dirichlet_count(num_nodes, 0);
     std::vector<double> dirichlet_value(num_nodes, 0.0);
@@ -379,6 +677,8 @@ CFEMDiffusionSolver::Execute()
             } // for fj
           }   // end true Robin
         }     // for fi
+        if (matrix_free_ and std::fabs(aval) > 1.0e-8)
+          cell_robin_faces_[cell.local_id].emplace_back(f, aval / bval);
       }       // if Robin
 
       // Dirichlet boundary
@@ -404,12 +704,17 @@ CFEMDiffusionSolver::Execute()
     for (size_t i = 0; i < num_nodes; ++i)
       imap[i] = sdm.MapDOF(cell, i);
 
+    if (matrix_free_)
+      for (size_t i = 0; i < num_nodes; ++i)
+        cell_dirichlet_nodes_[cell_dof_offsets_[cell.local_id] + i] = dirichlet_count[i] > 0;
+
     // Assembly into system
     for (size_t i = 0; i < num_nodes; ++i)
     {
       if (dirichlet_count[i] > 0) // if Dirichlet boundary node
       {
-        MatSetValue(A_, imap[i], imap[i], 1.0, ADD_VALUES);
+        if (assemble_matrix)
+          MatSetValue(A_, imap[i], imap[i], 1.0, ADD_VALUES);
         // because we use CFEM, a given node is common to several faces
         const double aux = dirichlet_value[i] / dirichlet_count[i];
         VecSetValue(b_, imap[i], aux, ADD_VALUES);
@@ -419,7 +724,10 @@ CFEMDiffusionSolver::Execute()
         for (size_t j = 0; j < num_nodes; ++j)
         {
           if (dirichlet_count[j] == 0) // not related to a dirichlet node
-            MatSetValue(A_, imap[i], imap[j], Acell(i, j), ADD_VALUES);
+          {
+            if (assemble_matrix)
+              MatSetValue(A_, imap[i], imap[j], Acell(i, j), ADD_VALUES);
+          }
           else
           {
             const double aux = dirichlet_value[j] / dirichlet_count[j];
@@ -433,26 +741,45 @@ CFEMDiffusionSolver::Execute()
 
   log.Log() << "Global assembly";
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  if (assemble_matrix)
+  {
+    MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  }
   VecAssemblyBegin(b_);
   VecAssemblyEnd(b_);
 
   log.Log() << "Done global assembly";
+  log.Log0Verbose1() << "Assembly time: " << assembly_timer.GetTime() / 1000.0 << " s";
+  if (assemble_matrix)
+  {
+    MatInfo info;
+    MatGetInfo(A_, MAT_GLOBAL_SUM, &info);
+    log.Log0Verbose1() << "Assembled matrix memory: " << info.memory / 1.0e6 << " MB";
+  }
 
   // Create Krylov Solver
   log.Log() << "Solving: ";
+  Mat A_op = matrix_free_ ? A_shell_ : A_;
+  Mat A_pc = (A_ != nullptr) ? A_ : A_shell_;
+  const std::string pc_type =
+    (matrix_free_ and matrix_free_preconditioner_ == "jacobi") ? PCJACOBI : PCGAMG;
   auto petsc_solver =
-    CreateCommonKrylovSolverSetup(A_,
+    CreateCommonKrylovSolverSetup(A_pc,
                                   Name(),
                                   KSPCG,
-                                  PCGAMG,
+                                  pc_type,
                                   0.0,
                                   basic_options_("residual_tolerance").FloatValue(),
                                   basic_options_("max_iters").IntegerValue());
+  KSPSetOperators(petsc_solver.ksp, A_op, A_pc);
 
   // Solve
+  Timer solve_timer;
   KSPSolve(petsc_solver.ksp, b_, x_);
+  log.Log0Verbose1() << "Solve time: " << solve_timer.GetTime() / 1000.0 << " s";
+
+  KSPDestroy(&petsc_solver.ksp);
 
   UpdateFieldFunctions();
 
@@ -7,6 +7,7 @@
 #include "framework/mesh/mesh.h"
 #include "framework/physics/solver.h"
 #include "framework/math/petsc_utils/petsc_utils.h"
+#include "framework/math/spatial_discretization/finite_element/unit_cell_matrices.h"
 #include "framework/utils/timer.h"
 #include <map>
 
@@ -38,6 +39,60 @@ public:
   void Execute() override;
 
 private:
+  /**
+   * Creates the matrix-free operator, which is applied cell by cell from the unit cell matrices
+   * and the cell coefficients.
+   */
+  void InitMatrixFreeOperator();
+
+  /**
+   * Computes y += A_c x for one local cell, with the Dirichlet rows and columns of the cell
+   * removed. `x_cell` and `y_cell` are work vectors holding at least as many values as the cell
+   * has nodes.
+   */
+  void ApplyCellOperator(size_t cell_local_id,
+                         const double* x,
+                         double* y,
+                         std::vector<double>& x_cell,
+                         std::vector<double>& y_cell) const;
+
+  /// MatShell callback computing y = A x from the unit cell matrices.
+  static PetscErrorCode MatrixFreeMult(Mat A, Vec x, Vec y);
+
+  /// MatShell callback computing the diagonal of A from the unit cell matrices.
+  static PetscErrorCode MatrixFreeGetDiagonal(Mat A, Vec diag);
+
+  /// When true, the system operator is applied matrix-free.
+  bool matrix_free_;
+  /**
+   * Preconditioner used with the matrix-free operator, either "gamg" or "jacobi". With "gamg" the
+   * global matrix is still assembled for the preconditioner.
+   */
+  std::string matrix_free_preconditioner_;
+
+  /// Matrix-free operator
+  Mat A_shell_;
+  /// Ghosted work vectors for the matrix-free operator
+  Vec x_ghosted_;
+  Vec y_ghosted_;
+  /// Integrals of the shape functions of every local cell, without coefficients
+  std::vector<UnitCellMatrices> unit_cell_matrices_;
+  /// Diffusion coefficient and absorption cross section of every local cell
+  std::vector<std::pair<double, double>> cell_coefficients_;
+  /**
+   * Volume matrices of the local cells whose coefficients vary within the cell, which cannot be
+   * applied from the unit cell matrices.
+   */
+  std::map<size_t, DenseMatrix<double>> variable_coefficient_matrices_;
+  /// Robin faces of every local cell, with the ratio a/b of their boundary condition
+  std::vector<std::vector<std::pair<size_t, double>>> cell_robin_faces_;
+  /// Offset of each local cell's nodes into cell_dofs_ and cell_dirichlet_nodes_
+  std::vector<size_t> cell_dof_offsets_;
+  /// Local (ghost-inclusive) dof index of each local cell's nodes
+  std::vector<int64_t> cell_dofs_;
+  /// Whether each local cell's nodes lie on a Dirichlet boundary
+  std::vector<char> cell_dirichlet_nodes_;
+
   std::shared_ptr<ScalarSpatialMaterialFunction> d_coef_function_;
   std::shared_ptr<ScalarSpatialMaterialFunction> sigma_a_function_;
   std::shared_ptr<ScalarSpatialMaterialFunction> q_ext_function_;
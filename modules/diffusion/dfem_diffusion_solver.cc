@@ -294,6 +294,7 @@ DFEMDiffusionSolver::Execute()
 
   log.Log() << "Assembling system: ";
 
+  std::vector<double> d_coef_qp, sigma_a_qp, q_ext_qp, d_coef_neigh_qp;
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
@@ -303,6 +304,11 @@ DFEMDiffusionSolver::Execute()
 
     const auto imat = cell.material_id;
 
+    // Evaluate the coefficients at all quadrature points of the cell at once
+    d_coef_function_->Evaluate(imat, fe_vol_data.QPointsXYZ(), d_coef_qp);
+    sigma_a_function_->Evaluate(imat, fe_vol_data.QPointsXYZ(), sigma_a_qp);
+    q_ext_function_->Evaluate(imat, fe_vol_data.QPointsXYZ(), q_ext_qp);
+
     // Assemble volumetric terms
     for (size_t i = 0; i < num_nodes; ++i)
     {
@@ -314,18 +320,16 @@ DFEMDiffusionSolver::Execute()
         double entry_aij = 0.0;
         for (size_t qp : fe_vol_data.QuadraturePointIndices())
         {
-          entry_aij += (d_coef_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) +
-                        sigma_a_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                          fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp)) *
-                       fe_vol_data.JxW(qp);
+          entry_aij +=
+            (d_coef_qp[qp] * fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) +
+             sigma_a_qp[qp] * fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp)) *
+            fe_vol_data.JxW(qp);
         } // for qp
         MatSetValue(A_, imap, jmap, entry_aij, ADD_VALUES);
       } // for j
       double entry_rhs_i = 0.0;
       for (size_t qp : fe_vol_data.QuadraturePointIndices())
-        entry_rhs_i += q_ext_function_->Evaluate(imat, fe_vol_data.QPointXYZ(qp)) *
-                       fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
+        entry_rhs_i += q_ext_qp[qp] * fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
       VecSetValue(b_, imap, entry_rhs_i, ADD_VALUES);
     } // for i
 
@@ -337,6 +341,7 @@ DFEMDiffusionSolver::Execute()
       const auto& n_f = face.normal;
       const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
       const auto fe_srf_data = cell_mapping.MakeSurfaceFiniteElementData(f);
+      d_coef_function_->Evaluate(imat, fe_srf_data.QPointsXYZ(), d_coef_qp);
 
       const double hm = HPerpendicular(cell, f);
 
@@ -350,6 +355,7 @@ DFEMDiffusionSolver::Execute()
         const double hp_neigh = HPerpendicular(adj_cell, acf);
 
         const auto imat_neigh = adj_cell.material_id;
+        d_coef_function_->Evaluate(imat_neigh, fe_srf_data.QPointsXYZ(), d_coef_neigh_qp);
 
         // Compute Ckappa IP
         double Ckappa = 1.0;
@@ -377,12 +383,9 @@ DFEMDiffusionSolver::Execute()
 
             double aij = 0.0;
             for (size_t qp : fe_srf_data.QuadraturePointIndices())
-              aij +=
-                Ckappa *
-                (d_coef_function_->Evaluate(imat, fe_srf_data.QPointXYZ(qp)) / hm +
-                 d_coef_function_->Evaluate(imat_neigh, fe_srf_data.QPointXYZ(qp)) / hp_neigh) /
-                2.0 * fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(jm, qp) *
-                fe_srf_data.JxW(qp);
+              aij += Ckappa * (d_coef_qp[qp] / hm + d_coef_neigh_qp[qp] / hp_neigh) / 2.0 *
+                     fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(jm, qp) *
+                     fe_srf_data.JxW(qp);
 
             MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
             MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
@@ -412,9 +415,8 @@ DFEMDiffusionSolver::Execute()
 
             Vector3 vec_aij;
             for (size_t qp : fe_srf_data.QuadraturePointIndices())
-              vec_aij += d_coef_function_->Evaluate(imat, fe_srf_data.QPointXYZ(qp)) *
-                         fe_srf_data.ShapeValue(jm, qp) * fe_srf_data.ShapeGrad(i, qp) *
-                         fe_srf_data.JxW(qp);
+              vec_aij += d_coef_qp[qp] * fe_srf_data.ShapeValue(jm, qp) *
+                         fe_srf_data.ShapeGrad(i, qp) * fe_srf_data.JxW(qp);
             const double aij = -0.5 * n_f.Dot(vec_aij);
 
             MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
@@ -438,9 +440,8 @@ DFEMDiffusionSolver::Execute()
 
             Vector3 vec_aij;
             for (size_t qp : fe_srf_data.QuadraturePointIndices())
-              vec_aij += d_coef_function_->Evaluate(imat, fe_srf_data.QPointXYZ(qp)) *
-                         fe_srf_data.ShapeValue(im, qp) * fe_srf_data.ShapeGrad(j, qp) *
-                         fe_srf_data.JxW(qp);
+              vec_aij += d_coef_qp[qp] * fe_srf_data.ShapeValue(im, qp) *
+                         fe_srf_data.ShapeGrad(j, qp) * fe_srf_data.JxW(qp);
             const double aij = -0.5 * n_f.Dot(vec_aij);
 
             MatSetValue(A_, immap, jmap, aij, ADD_VALUES);
@@ -526,9 +527,8 @@ DFEMDiffusionSolver::Execute()
 
               double aij = 0.0;
               for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                aij += Ckappa * d_coef_function_->Evaluate(imat, fe_srf_data.QPointXYZ(qp)) / hm *
-                       fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(jm, qp) *
-                       fe_srf_data.JxW(qp);
+                aij += Ckappa * d_coef_qp[qp] / hm * fe_srf_data.ShapeValue(i, qp) *
+                       fe_srf_data.ShapeValue(jm, qp) * fe_srf_data.JxW(qp);
               double aij_bc_value = aij * bc_value;
 
               MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
@@ -553,8 +553,7 @@ DFEMDiffusionSolver::Execute()
               for (size_t qp : fe_srf_data.QuadraturePointIndices())
                 vec_aij += (fe_srf_data.ShapeValue(j, qp) * fe_srf_data.ShapeGrad(i, qp) +
                             fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeGrad(j, qp)) *
-                           fe_srf_data.JxW(qp) *
-                           d_coef_function_->Evaluate(imat, fe_srf_data.QPointXYZ(qp));
+                           fe_srf_data.JxW(qp) * d_coef_qp[qp];
 
               const double aij = -n_f.Dot(vec_aij);
               double aij_bc_value = aij * bc_value;
@@ -9,6 +9,7 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/math/spatial_discretization/finite_volume/finite_volume.h"
 #include "framework/math/functions/scalar_spatial_material_function.h"
+#include <map>
 
 namespace opensn
 {
@@ -289,17 +290,46 @@ FVDiffusionSolver::Execute()
   // P ~ Present cell
   // N ~ Neighbor cell
   log.Log() << "Assembling system: ";
+
+  // Evaluate the coefficients at the centroids of all local cells, one batch per material
+  const size_t num_local_cells = grid.local_cells.size();
+  std::vector<double> cell_sigma_a(num_local_cells);
+  std::vector<double> cell_q_ext(num_local_cells);
+  std::vector<double> cell_d_coef(num_local_cells);
+  {
+    std::map<int, std::vector<uint64_t>> material_cells;
+    for (const auto& cell : grid.local_cells)
+      material_cells[cell.material_id].push_back(cell.local_id);
+
+    std::vector<Vector3> centroids;
+    std::vector<double> sigma_a, q_ext, d_coef;
+    for (const auto& [mat_id, local_ids] : material_cells)
+    {
+      centroids.clear();
+      for (const auto local_id : local_ids)
+        centroids.push_back(grid.local_cells[local_id].centroid);
+
+      sigma_a_function_->Evaluate(mat_id, centroids, sigma_a);
+      q_ext_function_->Evaluate(mat_id, centroids, q_ext);
+      d_coef_function_->Evaluate(mat_id, centroids, d_coef);
+      for (size_t c = 0; c < local_ids.size(); ++c)
+      {
+        cell_sigma_a[local_ids[c]] = sigma_a[c];
+        cell_q_ext[local_ids[c]] = q_ext[c];
+        cell_d_coef[local_ids[c]] = d_coef[c];
+      }
+    }
+  }
+
   for (const auto& cell_P : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell_P);
     const double volume_P = cell_mapping.CellVolume(); // Volume of present cell
     const auto& x_cc_P = cell_P.centroid;
 
-    const auto imat = cell_P.material_id;
-
-    const double sigma_a = sigma_a_function_->Evaluate(imat, x_cc_P);
-    const double q_ext = q_ext_function_->Evaluate(imat, x_cc_P);
-    const double D_P = d_coef_function_->Evaluate(imat, x_cc_P);
+    const double sigma_a = cell_sigma_a[cell_P.local_id];
+    const double q_ext = cell_q_ext[cell_P.local_id];
+    const double D_P = cell_d_coef[cell_P.local_id];
 
     const int64_t imap = sdm.MapDOF(cell_P, 0);
     MatSetValue(A_, imap, imap, sigma_a * volume_P, ADD_VALUES);
@@ -320,7 +350,9 @@ FVDiffusionSolver::Execute()
         const auto& x_cc_N = cell_N.centroid;
         const auto x_PN = x_cc_N - x_cc_P;
 
-        const double D_N = d_coef_function_->Evaluate(jmat, x_cc_N);
+        const double D_N = grid.IsCellLocal(cell_N.global_id)
+                             ? cell_d_coef[cell_N.local_id]
+                             : d_coef_function_->Evaluate(jmat, x_cc_N);
 
         const double w = x_PF.Norm() / x_PN.Norm();
         const double D_f = 1.0 / (w / D_P + (1.0 - w) / D_N);
@@ -170,6 +170,9 @@ MGDiffusionSolver::~MGDiffusionSolver()
     VecDestroy(&x_[num_groups_]);
     MatDestroy(&A_[num_groups_]);
   }
+
+  for (auto& petsc_solver : petsc_solvers_)
+    KSPDestroy(&petsc_solver.ksp);
 }
 
 void
@@ -322,10 +325,6 @@ MGDiffusionSolver::Initialize()
   const auto n = static_cast<int64_t>(num_local_dofs_);
   const auto N = static_cast<int64_t>(num_global_dofs_);
 
-  std::vector<int64_t> nodal_nnz_in_diag;
-  std::vector<int64_t> nodal_nnz_off_diag;
-  sdm.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, OneDofPerNode);
-
   unsigned int i_two_grid = do_two_grid_ ? 1 : 0;
   //  std::cout << "i_two_grid = " << i_two_grid << std::endl;
 
@@ -343,8 +342,8 @@ MGDiffusionSolver::Initialize()
     VecSet(x_[g], 0.0);
     bext_[g] = CreateVector(n, N);
 
+    // Preallocated from the COO pattern during assembly
     A_[g] = CreateSquareMatrix(n, N);
-    InitMatrixSparsity(A_[g], nodal_nnz_in_diag, nodal_nnz_off_diag);
   }
   // initialize b
   VecDuplicate(bext_.front(), &b_);
@@ -363,7 +362,6 @@ MGDiffusionSolver::Initialize()
   if (do_two_grid_)
   {
     A_[num_groups_] = CreateSquareMatrix(n, N);
-    InitMatrixSparsity(A_[num_groups_], nodal_nnz_in_diag, nodal_nnz_off_diag);
     VecDuplicate(x_.front(), &x_[num_groups_]); // jcr needed?
     //    x[num_groups] = CreateVectorWithGhosts(n,N,
     //                                                        static_cast<int64_t>(ghost_dof_indices.size()),
@@ -732,6 +730,26 @@ MGDiffusionSolver::AssembleAbext()
   // Assemble the system
   unsigned int i_two_grid = do_two_grid_ ? 1 : 0;
 
+  // The COO pattern is the same for every group and only needs to be built once
+  const bool build_coo_pattern = coo_rows_.empty();
+  size_t num_coo_entries = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    const size_t num_nodes = sdm.GetCellMapping(cell).NumNodes();
+    num_coo_entries += num_nodes * num_nodes;
+  }
+  if (build_coo_pattern)
+  {
+    coo_rows_.reserve(num_coo_entries);
+    coo_cols_.reserve(num_coo_entries);
+  }
+  std::vector<std::vector<double>> coo_vals(num_groups_ + i_two_grid);
+  for (auto& vals : coo_vals)
+    vals.reserve(num_coo_entries);
+
+  for (uint g = 0; g < num_groups_; ++g)
+    VecSet(bext_[g], 0.0);
+
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
@@ -865,10 +883,18 @@ MGDiffusionSolver::AssembleAbext()
       for (size_t i = 0; i < num_nodes; ++i)
         VecSetValue(bext_[g], imap[i], rhs_cell[g](i), ADD_VALUES);
 
+    if (build_coo_pattern)
+      for (size_t i = 0; i < num_nodes; ++i)
+        for (size_t j = 0; j < num_nodes; ++j)
+        {
+          coo_rows_.push_back(imap[i]);
+          coo_cols_.push_back(imap[j]);
+        }
+
     for (uint g = 0; g < num_groups_ + i_two_grid; ++g)
       for (size_t i = 0; i < num_nodes; ++i)
         for (size_t j = 0; j < num_nodes; ++j)
-          MatSetValue(A_[g], imap[i], imap[j], Acell[g](i, j), ADD_VALUES);
+          coo_vals[g].push_back(Acell[g](i, j));
 
   } // for cell
 
@@ -879,10 +905,18 @@ MGDiffusionSolver::AssembleAbext()
     VecAssemblyBegin(bext_[g]);
     VecAssemblyEnd(bext_[g]);
   }
+  // Duplicate (row, col) pairs are summed by MatSetValuesCOO, which also assembles the matrix
   for (uint g = 0; g < num_groups_ + i_two_grid; ++g)
   {
-    MatAssemblyBegin(A_[g], MAT_FINAL_ASSEMBLY);
-    MatAssemblyEnd(A_[g], MAT_FINAL_ASSEMBLY);
+    if (build_coo_pattern)
+    {
+      // PETSc may reorder the index arrays it is given
+      auto rows = coo_rows_;
+      auto cols = coo_cols_;
+      MatSetPreallocationCOO(
+        A_[g], static_cast<PetscCount>(rows.size()), rows.data(), cols.data());
+    }
+    MatSetValuesCOO(A_[g], coo_vals[g].data(), INSERT_VALUES);
   }
 
   //  PetscViewer viewer;
@@ -905,19 +939,10 @@ MGDiffusionSolver::Execute()
 {
   log.Log() << "\nExecuting CFEM Multigroup Diffusion solver";
 
-  // Create Krylov Solver
-  // setup KSP once for all
-  petsc_solver_ = CreateCommonKrylovSolverSetup(A_.front(),
-                                                Name(),
-                                                KSPCG,
-                                                PCGAMG,
-                                                0.0,
-                                                basic_options_("residual_tolerance").FloatValue(),
-                                                basic_options_("max_inner_iters").IntegerValue());
-
-  KSPSetApplicationContext(petsc_solver_.ksp, (void*)&my_app_context_);
-  KSPMonitorCancel(petsc_solver_.ksp);
-  KSPMonitorSet(petsc_solver_.ksp, &MGKSPMonitor, nullptr, nullptr);
+  // Create Krylov solvers. One KSP per group is kept so that each group's preconditioner is set
+  // up once per matrix assembly rather than each time the operator changes.
+  if (petsc_solvers_.empty())
+    InitializeGroupSolvers();
 
   int64_t iverbose = basic_options_("verbose_level").IntegerValue();
   my_app_context_.verbose = iverbose > 1 ? PETSC_TRUE : PETSC_FALSE;
@@ -989,10 +1014,46 @@ MGDiffusionSolver::Execute()
       std::cout << "\nThermal iterations NOT converged for fixed-source problem" << std::endl;
   }
 
+  if (iverbose > 0)
+    PrintSolverTimings();
+
   UpdateFieldFunctions();
   log.Log() << "Done solving multi-group diffusion";
 }
 
+void
+MGDiffusionSolver::InitializeGroupSolvers()
+{
+  const auto num_solvers = A_.size();
+  petsc_solvers_.resize(num_solvers);
+  pc_setup_times_.assign(num_solvers, 0.0);
+  solve_times_.assign(num_solvers, 0.0);
+  num_solves_.assign(num_solvers, 0);
+
+  for (size_t g = 0; g < num_solvers; ++g)
+  {
+    auto& petsc_solver = petsc_solvers_[g];
+    petsc_solver =
+      CreateCommonKrylovSolverSetup(A_[g],
+                                    Name(),
+                                    KSPCG,
+                                    PCGAMG,
+                                    0.0,
+                                    basic_options_("residual_tolerance").FloatValue(),
+                                    basic_options_("max_inner_iters").IntegerValue());
+
+    KSPSetApplicationContext(petsc_solver.ksp, (void*)&my_app_context_);
+    KSPMonitorCancel(petsc_solver.ksp);
+    KSPMonitorSet(petsc_solver.ksp, &MGKSPMonitor, nullptr, nullptr);
+
+    // The operators of a KSP never change, so the preconditioner built here is reused by every
+    // subsequent solve of this group.
+    Timer timer;
+    KSPSetUp(petsc_solver.ksp);
+    pc_setup_times_[g] += timer.GetTime();
+  }
+}
+
 void
 MGDiffusionSolver::AssembleRhs(unsigned int g, int64_t iverbose)
 {
@@ -1054,8 +1115,10 @@ MGDiffusionSolver::SolveOneGroupProblem(const unsigned int g, const int64_t verb
   if (verbose > 1)
     log.Log() << "Solving group: " << g;
 
-  KSPSetOperators(petsc_solver_.ksp, A_[g], A_[g]);
-  KSPSolve(petsc_solver_.ksp, b_, x_[g]);
+  Timer timer;
+  KSPSolve(petsc_solvers_[g].ksp, b_, x_[g]);
+  solve_times_[g] += timer.GetTime();
+  ++num_solves_[g];
 
   // this is required to compute the inscattering RHS correctly in parallel
   CommunicateGhostEntries(x_[g]);
@@ -1064,6 +1127,20 @@ MGDiffusionSolver::SolveOneGroupProblem(const unsigned int g, const int64_t verb
     log.Log() << "Done solving group " << g;
 }
 
+void
+MGDiffusionSolver::PrintSolverTimings() const
+{
+  std::stringstream outstr;
+  outstr << "\nMultigroup diffusion solver timings (setup/solve in seconds)\n";
+  for (size_t g = 0; g < petsc_solvers_.size(); ++g)
+  {
+    outstr << "  " << ((g == num_groups_) ? std::string("two-grid") : "group " + std::to_string(g))
+           << ": setup " << std::setprecision(4) << pc_setup_times_[g] / 1000.0 << ", solve "
+           << solve_times_[g] / 1000.0 << " (" << num_solves_[g] << " solves)\n";
+  }
+  log.Log() << outstr.str();
+}
+
 void
 MGDiffusionSolver::AssembleRhsTwoGrid(int64_t iverbose)
 {
@@ -73,7 +73,9 @@ private:
   void ComputeTwoGridVolumeFractions();
   void AssembleRhs(unsigned int g, int64_t iverbose);
   void AssembleRhsTwoGrid(int64_t iverbose);
+  void InitializeGroupSolvers();
   void SolveOneGroupProblem(unsigned int g, int64_t iverbose);
+  void PrintSolverTimings() const;
   void UpdateFluxWithTwoGrid(int64_t iverbose);
 
   using BoundaryInfo = std::pair<BoundaryType, std::array<std::vector<double>, 3>>;
@@ -92,6 +94,10 @@ private:
 
   /// linear system matrix for each group
   std::vector<Mat> A_;
+  /// COO row and column indices of the cell contributions, shared by all group matrices. These
+  /// are built on the first assembly; later assemblies only update the values.
+  std::vector<int64_t> coo_rows_;
+  std::vector<int64_t> coo_cols_;
   /// external source vector for each group
   std::vector<Vec> bext_;
   /// solution vector for each group
@@ -104,8 +110,15 @@ private:
   /// actual rhs vector for the linear system A[g] x[g] = b
   Vec b_;
 
-  PETScSolverSetup petsc_solver_;
+  /// Krylov solver for each group, such that each preconditioner is only set up once
+  std::vector<PETScSolverSetup> petsc_solvers_;
   KSPAppContext my_app_context_;
+  /// Accumulated preconditioner setup time for each group (in ms)
+  std::vector<double> pc_setup_times_;
+  /// Accumulated solve time for each group (in ms)
+  std::vector<double> solve_times_;
+  /// Number of solves performed for each group
+  std::vector<size_t> num_solves_;
 
   std::vector<std::vector<double>> VF_;
 
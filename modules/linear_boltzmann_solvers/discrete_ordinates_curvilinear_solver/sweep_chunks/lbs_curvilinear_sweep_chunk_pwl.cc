@@ -109,7 +109,7 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
     std::vector<double> face_mu_values(cell_num_faces);
 
     const auto& rho = densities_[cell.local_id];
-    const auto& sigma_t = xs_.at(cell.material_id)->SigmaTotal();
+    const auto& sigma_t = cell_transport_view.XS().SigmaTotal();
 
     // Get cell matrices
     const auto& G = unit_cell_matrices_[cell_local_id].intV_shapeI_gradshapeJ;
@@ -305,6 +305,8 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
         }
       }
 
+      Accumulate(cell, direction_num, gs_ss_begin, gs_ss_size, b);
+
       // For outgoing, non-boundary faces, copy angular flux to fluds and
       // accumulate outflow
       int out_face_counter = -1;
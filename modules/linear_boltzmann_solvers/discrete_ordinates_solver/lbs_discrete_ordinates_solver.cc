@@ -21,11 +21,13 @@
 #include "framework/math/quadratures/angular/product_quadrature.h"
 #include "framework/logging/log.h"
 #include "framework/logging/log_exceptions.h"
+#include "framework/mpi/mpi_utils.h"
 #include "framework/utils/timer.h"
 #include "framework/utils/utils.h"
 #include "framework/object_factory.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
+#include <algorithm>
 #include <iomanip>
 
 namespace opensn
@@ -57,14 +59,34 @@ DiscreteOrdinatesSolver::GetInputParameters()
 
   params.ConstrainParameterRange("sweep_type", AllowableRangeList::New({"AAH", "CBC"}));
 
+  params.AddOptionalParameter("num_sweep_threads",
+                              1,
+                              "Number of threads sweeping the cells of an angle set. With more "
+                              "than one thread, the cells of each level of the local sweep "
+                              "ordering are swept concurrently. Requires the AAH sweep type. "
+                              "Builds without OpenMP support sweep with a single thread.");
+
+  params.ConstrainParameterRange("num_sweep_threads", AllowableRangeLowLimit::New(1));
+
   return params;
 }
 
 DiscreteOrdinatesSolver::DiscreteOrdinatesSolver(const InputParameters& params)
   : LBSSolver(params),
     verbose_sweep_angles_(params.GetParamVectorValue<size_t>("directions_sweep_order_to_print")),
-    sweep_type_(params.GetParamValue<std::string>("sweep_type"))
+    sweep_type_(params.GetParamValue<std::string>("sweep_type")),
+    num_sweep_threads_(params.GetParamValue<int>("num_sweep_threads"))
 {
+  OpenSnInvalidArgumentIf(num_sweep_threads_ > 1 and sweep_type_ != "AAH",
+                          "num_sweep_threads > 1 requires sweep_type \"AAH\".");
+#ifndef OPENSN_WITH_OPENMP
+  if (num_sweep_threads_ > 1)
+  {
+    log.Log0Warning() << "num_sweep_threads > 1 requires OpenSn to be built with OpenMP "
+                         "(OPENSN_WITH_OPENMP). Sweeping with a single thread.";
+    num_sweep_threads_ = 1;
+  }
+#endif
 }
 
 DiscreteOrdinatesSolver::~DiscreteOrdinatesSolver()
@@ -127,6 +149,41 @@ DiscreteOrdinatesSolver::Initialize()
     InitWGDSA(groupset);
     InitTGDSA(groupset);
   }
+
+  // Set up the boundary tallies, replacing those of a previous initialization
+  for (auto& [gs_id, accumulators] : sweep_accumulators_)
+  {
+    for (const auto& tally : leakage_tallies_)
+      accumulators.erase(std::remove(accumulators.begin(), accumulators.end(), tally),
+                         accumulators.end());
+    for (const auto& tally : angular_flux_tallies_)
+      accumulators.erase(std::remove(accumulators.begin(), accumulators.end(), tally),
+                         accumulators.end());
+  }
+  leakage_tallies_.clear();
+  angular_flux_tallies_.clear();
+  const auto boundary_ids = grid_ptr_->GetDomainUniqueBoundaryIDs();
+  if (options_.tally_leakage)
+  {
+    for (const auto& groupset : groupsets_)
+    {
+      auto tally = std::make_shared<BoundaryLeakageTally>(
+        *grid_ptr_, *discretization_, unit_cell_matrices_, groupset, boundary_ids);
+      AddSweepAccumulator(groupset.id, tally);
+      leakage_tallies_.push_back(tally);
+    }
+  }
+  if (options_.tally_boundary_angular_flux)
+  {
+    for (const auto& groupset : groupsets_)
+    {
+      auto tally = std::make_shared<BoundaryAngularFluxTally>(
+        *grid_ptr_, *discretization_, unit_cell_matrices_, groupset, boundary_ids);
+      AddSweepAccumulator(groupset.id, tally);
+      angular_flux_tallies_.push_back(tally);
+    }
+  }
+
   InitializeSolverSchemes();
 }
 
@@ -148,6 +205,9 @@ DiscreteOrdinatesSolver::InitializeWGSSolvers()
       options_.verbose_inner_iterations,
       sweep_chunk);
 
+    for (const auto& accumulator : sweep_accumulators_[groupset.id])
+      sweep_chunk->AddAccumulator(accumulator);
+
     if (groupset.iterative_method == LinearSolver::IterativeMethod::CLASSIC_RICHARDSON)
       wgs_solvers_.push_back(std::make_shared<ClassicRichardson>(sweep_wgs_context_ptr));
     else
@@ -155,6 +215,25 @@ DiscreteOrdinatesSolver::InitializeWGSSolvers()
   }
 }
 
+void
+DiscreteOrdinatesSolver::AddSweepAccumulator(unsigned int groupset_id,
+                                             std::shared_ptr<SweepAccumulator> accumulator)
+{
+  OpenSnInvalidArgumentIf(groupset_id >= groupsets_.size(), "Invalid groupset id.");
+  OpenSnInvalidArgumentIf(not accumulator, "Null sweep accumulator.");
+
+  // Accumulators added after initialization also go to the current sweep chunk
+  if (groupset_id < wgs_solvers_.size())
+  {
+    auto sweep_context =
+      std::dynamic_pointer_cast<SweepWGSContext>(wgs_solvers_[groupset_id]->GetContext());
+    OpenSnLogicalErrorIf(not sweep_context, "Failed to cast SweepWGSContext");
+    sweep_context->sweep_chunk->AddAccumulator(accumulator);
+  }
+
+  sweep_accumulators_[groupset_id].push_back(std::move(accumulator));
+}
+
 void
 DiscreteOrdinatesSolver::ReorientAdjointSolution()
 {
@@ -418,9 +497,12 @@ DiscreteOrdinatesSolver::ComputeLeakage(const unsigned int groupset_id,
   // Perform checks
   OpenSnInvalidArgumentIf(groupset_id < 0 or groupset_id >= groupsets_.size(),
                           "Invalid groupset id.");
-  OpenSnLogicalErrorIf(not options_.save_angular_flux,
-                       "The option `save_angular_flux` must be set to `true` in order "
-                       "to compute outgoing currents.");
+  OpenSnLogicalErrorIf(not options_.save_angular_flux and leakage_tallies_.empty(),
+                       "The option `save_angular_flux` or `tally_leakage` must be set to `true` "
+                       "in order to compute outgoing currents.");
+
+  if (not leakage_tallies_.empty())
+    return leakage_tallies_.at(groupset_id)->GetLeakage({boundary_id}).at(boundary_id);
 
   const auto& sdm = *discretization_;
   const auto& groupset = groupsets_.at(groupset_id);
@@ -486,9 +568,9 @@ DiscreteOrdinatesSolver::ComputeLeakage(const std::vector<uint64_t>& boundary_id
   CALI_CXX_MARK_SCOPE("DiscreteOrdinatesSolver::ComputeLeakage");
 
   // Perform checks
-  OpenSnLogicalErrorIf(not options_.save_angular_flux,
-                       "The option `save_angular_flux` must be set to `true` in order "
-                       "to compute outgoing currents.");
+  OpenSnLogicalErrorIf(not options_.save_angular_flux and leakage_tallies_.empty(),
+                       "The option `save_angular_flux` or `tally_leakage` must be set to `true` "
+                       "in order to compute outgoing currents.");
 
   const auto unique_bids = grid_ptr_->GetDomainUniqueBoundaryIDs();
   for (const auto& bid : boundary_ids)
@@ -498,6 +580,23 @@ DiscreteOrdinatesSolver::ComputeLeakage(const std::vector<uint64_t>& boundary_id
                             "Boundary ID " + std::to_string(bid) + "not found on grid.");
   }
 
+  // Use the leakage tallied during the last sweeps when available
+  if (not leakage_tallies_.empty())
+  {
+    std::map<uint64_t, std::vector<double>> global_leakage;
+    for (const auto& bid : boundary_ids)
+      global_leakage[bid].assign(num_groups_, 0.0);
+
+    for (const auto& groupset : groupsets_)
+    {
+      const auto first_gs_group = groupset.groups.front().id;
+      const auto gs_leakage = leakage_tallies_.at(groupset.id)->GetLeakage(boundary_ids);
+      for (const auto& [bid, vals] : gs_leakage)
+        std::copy(vals.begin(), vals.end(), global_leakage[bid].begin() + first_gs_group);
+    }
+    return global_leakage;
+  }
+
   // Initialize local mapping
   std::map<uint64_t, std::vector<double>> local_leakage;
   for (const auto& bid : boundary_ids)
@@ -577,6 +676,23 @@ DiscreteOrdinatesSolver::ComputeLeakage(const std::vector<uint64_t>& boundary_id
   return global_leakage;
 }
 
+std::vector<double>
+DiscreteOrdinatesSolver::ComputeBoundaryAngularFlux(const unsigned int groupset_id,
+                                                    const uint64_t boundary_id) const
+{
+  OpenSnInvalidArgumentIf(groupset_id >= groupsets_.size(), "Invalid groupset id.");
+  OpenSnLogicalErrorIf(angular_flux_tallies_.empty(),
+                       "The option `tally_boundary_angular_flux` must be set to `true` in order "
+                       "to compute boundary angular fluxes.");
+
+  const auto unique_bids = grid_ptr_->GetDomainUniqueBoundaryIDs();
+  OpenSnInvalidArgumentIf(std::find(unique_bids.begin(), unique_bids.end(), boundary_id) ==
+                            unique_bids.end(),
+                          "Boundary ID " + std::to_string(boundary_id) + " not found on grid.");
+
+  return angular_flux_tallies_.at(groupset_id)->GetAngularFlux(boundary_id);
+}
+
 void
 DiscreteOrdinatesSolver::InitializeSweepDataStructures()
 {
@@ -606,17 +722,27 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
     // Creating an AAH SPDS can be an expensive operation. We break it up into multiple phases so
     // so that we can distribute the work across MPI ranks:
     // 1) Initialize the SPDS for each angleset. This is done by all ranks.
-    // 2) For each SPDS, generate the feedback arc set (FAS) for the global sweep graph. Angelsets
+    // 2) For each SPDS that allows cycles, gather the location dependencies on the rank that owns
+    //    the SPDS and generate the feedback arc set (FAS) for the global sweep graph there. SPDS
     //    are distributed as evenly as possible across MPI ranks.
-    // 3) Gather the FAS for each SPDS on all ranks.
-    // 4) Build the global sweep task dependency graph (TDG) for each SPDS.
+    // 3) Gather the FAS for each SPDS on all ranks and apply it.
+    // 4) Level the global sweep graph of each SPDS. Each rank only exchanges levels with its
+    //    neighbors in the graph, so that no rank stores the full global sweep graph.
 
-    // Initalize SPDS. All ranks initialize a SPDS for each angleset.
+    // Initalize SPDS. All ranks initialize a SPDS for each angleset. The SPDS list is ordered by
+    // groupset so that it is the same on all ranks.
     log.Log0Verbose1() << program_timer.GetTimeString() << " Initializing AAH SPDS.";
-    for (const auto& [quadrature, info] : quadrature_unq_so_grouping_map_)
+    std::vector<std::shared_ptr<AAH_SPDS>> aah_spds_list;
+    std::vector<bool> spds_allow_cycles;
+    for (const auto& groupset : groupsets_)
     {
+      const auto& quadrature = groupset.quadrature;
+      if (quadrature_spds_map_.count(quadrature) > 0)
+        continue;
+
+      auto& spds_list = quadrature_spds_map_[quadrature];
       int id = 0;
-      const auto& unique_so_groupings = info.first;
+      const auto& unique_so_groupings = quadrature_unq_so_grouping_map_[quadrature].first;
       for (const auto& so_grouping : unique_so_groupings)
       {
         if (so_grouping.empty())
@@ -626,49 +752,80 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
         const auto& omega = quadrature->omegas[master_dir_id];
         const auto new_swp_order = std::make_shared<AAH_SPDS>(
           id, omega, *this->grid_ptr_, quadrature_allow_cycles_map_[quadrature]);
-        quadrature_spds_map_[quadrature].push_back(new_swp_order);
+        spds_list.push_back(new_swp_order);
+        aah_spds_list.push_back(new_swp_order);
+        spds_allow_cycles.push_back(quadrature_allow_cycles_map_[quadrature]);
         ++id;
       }
     }
+    const int num_spds = static_cast<int>(aah_spds_list.size());
+    const int num_locations = opensn::mpi_comm.size();
+    const int location_id = opensn::mpi_comm.rank();
+
+    // Send the location dependencies of each SPDS that allows cycles to the rank that owns it.
+    // The SPDS are identified by their index in the SPDS list.
+    log.Log0Verbose1() << program_timer.GetTimeString() << " Gather location dependencies.";
+    std::map<int, std::vector<int>> dependencies_to_send;
+    for (int k = 0; k < num_spds; ++k)
+    {
+      if (not spds_allow_cycles[k])
+        continue;
+
+      const auto& location_dependencies = aah_spds_list[k]->LocationDependencies();
+      auto& buffer = dependencies_to_send[k % num_locations];
+      buffer.push_back(k);
+      buffer.push_back(static_cast<int>(location_dependencies.size()));
+      buffer.insert(buffer.end(), location_dependencies.begin(), location_dependencies.end());
+    }
+    const auto received_dependencies = MapAllToAll(dependencies_to_send);
 
-    // Generate the global sweep FAS for each SPDS. This is an expensive operation. It is
+    // Generate the global sweep FAS for each owned SPDS. This is an expensive operation. It is
     // distributed via MPI so that multiple MPI ranks can compute the FAS for one or more SPDS
     // independently.
     log.Log0Verbose1() << program_timer.GetTimeString() << " Build global sweep FAS for each SPDS.";
-    for (const auto& quadrature : quadrature_spds_map_)
     {
-      for (const auto& spds : quadrature.second)
+      std::map<int, std::vector<std::vector<int>>> global_dependencies;
+      for (const auto& [locJ, buffer] : received_dependencies)
       {
-        auto aah_spds = std::static_pointer_cast<AAH_SPDS>(spds);
-        auto id = aah_spds->Id();
-        if (opensn::mpi_comm.rank() == (id % opensn::mpi_comm.size()))
-          aah_spds->BuildGlobalSweepFAS();
+        size_t offset = 0;
+        while (offset < buffer.size())
+        {
+          const int k = buffer[offset++];
+          const int num_dependencies = buffer[offset++];
+          auto& spds_dependencies = global_dependencies[k];
+          spds_dependencies.resize(num_locations);
+          spds_dependencies[locJ].assign(buffer.begin() + offset,
+                                         buffer.begin() + offset + num_dependencies);
+          offset += num_dependencies;
+        }
       }
+
+      for (int k = location_id; k < num_spds; k += num_locations)
+        if (spds_allow_cycles[k])
+        {
+          auto& spds_dependencies = global_dependencies[k];
+          spds_dependencies.resize(num_locations);
+          aah_spds_list[k]->BuildGlobalSweepFAS(spds_dependencies);
+        }
     }
 
     // Communicate the FAS for each SPDS to all ranks.
     log.Log0Verbose1() << program_timer.GetTimeString() << " Gather FAS for each SPDS.";
     std::vector<int> local_edges_to_remove;
-    for (const auto& quadrature : quadrature_spds_map_)
+    for (int k = location_id; k < num_spds; k += num_locations)
     {
-      for (const auto& spds : quadrature.second)
-      {
-        auto aah_spds = std::static_pointer_cast<AAH_SPDS>(spds);
-        auto id = aah_spds->Id();
-        if ((id % opensn::mpi_comm.size()) == opensn::mpi_comm.rank())
-        {
-          auto edges_to_remove = aah_spds->GlobalSweepFAS();
-          local_edges_to_remove.push_back(id);
-          local_edges_to_remove.push_back(static_cast<int>(edges_to_remove.size()));
-          local_edges_to_remove.insert(
-            local_edges_to_remove.end(), edges_to_remove.begin(), edges_to_remove.end());
-        }
-      }
+      auto edges_to_remove = aah_spds_list[k]->GlobalSweepFAS();
+      if (edges_to_remove.empty())
+        continue;
+      local_edges_to_remove.push_back(k);
+      local_edges_to_remove.push_back(static_cast<int>(edges_to_remove.size()));
+      local_edges_to_remove.insert(
+        local_edges_to_remove.end(), edges_to_remove.begin(), edges_to_remove.end());
     }
 
     int local_size = static_cast<int>(local_edges_to_remove.size());
-    std::vector<int> receive_counts(opensn::mpi_comm.size(), 0);
-    std::vector<int> displacements(opensn::mpi_comm.size(), 0);
+    std::vector<int> receive_counts(num_locations, 0);
+    std::vector<int> displacements(num_locations, 0);
     mpi_comm.all_gather(local_size, receive_counts);
 
     int total_size = 0;
@@ -686,31 +843,19 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
     int offset = 0;
     while (offset < global_edges_to_remove.size())
     {
-      int spds_id = global_edges_to_remove[offset++];
+      int k = global_edges_to_remove[offset++];
       int num_edges = global_edges_to_remove[offset++];
-      std::vector<int> edges;
-      for (auto i = 0; i < num_edges; ++i)
-        edges.emplace_back(global_edges_to_remove[offset++]);
+      std::vector<int> edges(global_edges_to_remove.begin() + offset,
+                             global_edges_to_remove.begin() + offset + num_edges);
+      offset += num_edges;
 
-      for (const auto& quadrature : quadrature_spds_map_)
-      {
-        for (const auto& spds : quadrature.second)
-        {
-          auto aah_spds = std::static_pointer_cast<AAH_SPDS>(spds);
-          if (aah_spds->Id() == spds_id)
-          {
-            aah_spds->SetGlobalSweepFAS(edges);
-            break;
-          }
-        }
-      }
+      aah_spds_list[k]->SetGlobalSweepFAS(edges);
+      aah_spds_list[k]->ApplyGlobalSweepFAS();
     }
 
-    // Build TDG for each SPDS on all ranks.
-    log.Log0Verbose1() << program_timer.GetTimeString() << " Build global sweep TDGs.";
-    for (const auto& quadrature : quadrature_spds_map_)
-      for (const auto& spds : quadrature.second)
-        std::static_pointer_cast<AAH_SPDS>(spds)->BuildGlobalSweepTDG();
+    // Level the global sweep graph of each SPDS on all ranks.
+    log.Log0Verbose1() << program_timer.GetTimeString() << " Level global sweep graphs.";
+    AAH_SPDS::BuildGlobalSweepLevels(aah_spds_list);
 
     // Print ghosted sweep graph if requested
     if (not verbose_sweep_angles_.empty())
@@ -763,7 +908,7 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
       {
         quadrature_fluds_commondata_map_[quadrature].push_back(
           std::make_unique<AAH_FLUDSCommonData>(
-            grid_nodal_mappings_, *spds, *grid_face_histogram_));
+            grid_nodal_mappings_, *spds, *grid_face_histogram_, num_sweep_threads_ > 1));
       }
     }
   }
@@ -1070,7 +1215,8 @@ DiscreteOrdinatesSolver::SetSweepChunk(LBSGroupset& groupset)
                                                        groupset,
                                                        matid_to_xs_map_,
                                                        num_moments_,
-                                                       max_cell_dof_count_);
+                                                       max_cell_dof_count_,
+                                                       num_sweep_threads_);
 
     return sweep_chunk;
   }
@@ -5,6 +5,8 @@
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_tallies/boundary_leakage_tally.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_tallies/boundary_angular_flux_tally.h"
 
 namespace opensn
 {
@@ -38,7 +40,15 @@ public:
   void ComputeBalance();
 
   /**
-   * Computes the angular flux based leakage from boundary surfaces.
+   * Adds a quantity to be accumulated during every sweep of a groupset, e.g. one of the sweep
+   * tallies. The accumulator is kept across re-initializations of the within-groupset solvers.
+   */
+  void AddSweepAccumulator(unsigned int groupset_id, std::shared_ptr<SweepAccumulator> accumulator);
+
+  /**
+   * Computes the angular flux based leakage from boundary surfaces. The leakage is tallied during
+   * the sweep when the `tally_leakage` option is set and computed from the stored angular flux
+   * otherwise.
    * \param groupset_id The groupset for which to compute the leakage.
    * \param boundary_id The boundary id for which to perform the integration.
    *
@@ -47,7 +57,9 @@ public:
   std::vector<double> ComputeLeakage(unsigned int groupset_id, uint64_t boundary_id) const;
 
   /**
-   * Computes the group-wise angular flux-based leakage from the specified boundaries.
+   * Computes the group-wise angular flux-based leakage from the specified boundaries. The leakage
+   * is tallied during the sweep when the `tally_leakage` option is set and computed from the
+   * stored angular flux otherwise.
    *
    * \param boundary_ids The boundary ids to compute leakages on.
    * \return A map of boundary ids to group-wise leakages.
@@ -55,6 +67,18 @@ public:
   std::map<uint64_t, std::vector<double>>
   ComputeLeakage(const std::vector<uint64_t>& boundary_ids) const;
 
+  /**
+   * Returns the surface integral of the angular flux over a boundary, tallied during the last
+   * sweep of a groupset. Requires the `tally_boundary_angular_flux` option.
+   *
+   * \param groupset_id The groupset for which to return the angular flux.
+   * \param boundary_id The boundary id over which the angular flux is integrated.
+   * \return The integrals, with the value for groupset direction `n` and groupset group `gsg`
+   *         at index `n * G + gsg`, where `G` is the number of groups of the groupset.
+   */
+  std::vector<double> ComputeBoundaryAngularFlux(unsigned int groupset_id,
+                                                 uint64_t boundary_id) const;
+
 protected:
   explicit DiscreteOrdinatesSolver(const std::string& name);
 
@@ -94,8 +118,17 @@ protected:
   std::map<std::shared_ptr<AngularQuadrature>, std::vector<std::unique_ptr<FLUDSCommonData>>>
     quadrature_fluds_commondata_map_;
 
+  /// Accumulators that are added to the sweep chunk of each groupset.
+  std::map<unsigned int, std::vector<std::shared_ptr<SweepAccumulator>>> sweep_accumulators_;
+  /// Per groupset leakage tallies, used when the `tally_leakage` option is set.
+  std::vector<std::shared_ptr<BoundaryLeakageTally>> leakage_tallies_;
+  /// Per groupset angular flux tallies, used when the `tally_boundary_angular_flux` option is set.
+  std::vector<std::shared_ptr<BoundaryAngularFluxTally>> angular_flux_tallies_;
+
   std::vector<size_t> verbose_sweep_angles_;
   const std::string sweep_type_;
+  /// Number of threads sweeping the cells of each angle set.
+  int num_sweep_threads_ = 1;
 
 public:
   static InputParameters GetInputParameters();
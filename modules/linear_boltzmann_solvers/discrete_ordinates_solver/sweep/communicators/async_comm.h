@@ -24,11 +24,12 @@ public:
 
   virtual ~AsynchronousCommunicator() = default;
 
-  virtual std::vector<double>& InitGetDownwindMessageData(int location_id,
-                                                          uint64_t cell_global_id,
-                                                          unsigned int face_id,
-                                                          size_t angle_set_id,
-                                                          size_t data_size)
+  /**
+   * Returns the storage into which the angular flux leaving a local cell through a non-local face
+   * is written, and queues it for sending.
+   */
+  virtual double*
+  InitGetDownwindMessageData(uint64_t cell_local_id, unsigned int face_id, size_t data_size)
   {
     OpenSnLogicalError("Method not implemented");
   }
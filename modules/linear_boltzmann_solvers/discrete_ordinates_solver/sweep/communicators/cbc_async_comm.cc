@@ -9,22 +9,36 @@
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
+#include <algorithm>
 
 namespace opensn
 {
 
-std::vector<double>&
-CBC_ASynchronousCommunicator::InitGetDownwindMessageData(int location_id,
-                                                         uint64_t cell_global_id,
+CBC_ASynchronousCommunicator::CBC_ASynchronousCommunicator(size_t angle_set_id,
+                                                           FLUDS& fluds,
+                                                           const MPICommunicatorSet& comm_set)
+  : AsynchronousCommunicator(fluds, comm_set),
+    angle_set_id_(angle_set_id),
+    cbc_fluds_(dynamic_cast<CBC_FLUDS&>(fluds)),
+    pending_slots_(fluds.GetSPDS().LocationSuccessors().size())
+{
+}
+
+double*
+CBC_ASynchronousCommunicator::InitGetDownwindMessageData(uint64_t cell_local_id,
                                                          unsigned int face_id,
-                                                         size_t angle_set_id,
                                                          size_t data_size)
 {
-  MessageKey key{location_id, cell_global_id, face_id};
-  std::vector<double>& data = outgoing_message_queue_[key];
-  if (data.empty())
-    data.assign(data_size, 0.0);
-  return data;
+  const auto& common_data = cbc_fluds_.CommonData();
+  const auto& [deplocI, slot] = common_data.GetNonLocalFaceSlot(cell_local_id, face_id);
+  const auto& slot_node_offsets = common_data.OutgoingSlotNodeOffsets()[deplocI];
+  OpenSnLogicalErrorIf(cbc_fluds_.SlotOffset(slot_node_offsets, slot + 1) -
+                           cbc_fluds_.SlotOffset(slot_node_offsets, slot) - 1 !=
+                         data_size,
+                       "Downwind message size does not match the precomputed slot size.");
+
+  pending_slots_[deplocI].push_back(slot);
+  return cbc_fluds_.GetNonLocalDownwindData(deplocI, slot);
 }
 
 bool
@@ -32,60 +46,49 @@ CBC_ASynchronousCommunicator::SendData()
 {
   CALI_CXX_MARK_SCOPE("CBC_ASynchronousCommunicator::SendData");
 
-  // First we convert any new outgoing messages from the queue into
-  // buffer messages. We aggregate these messages per location-id
-  // they need to be sent to
-  if (not outgoing_message_queue_.empty())
-  {
-    std::map<int, BufferItem> locI_buffer_map;
-
-    for (const auto& [msg_key, data] : outgoing_message_queue_)
-    {
-      const int locI = std::get<0>(msg_key);
-      const uint64_t cell_global_id = std::get<1>(msg_key);
-      const unsigned int face_id = std::get<2>(msg_key);
-      const size_t data_size = data.size();
-
-      BufferItem& buffer_item = locI_buffer_map[locI];
-      buffer_item.destination = locI;
-      auto& buffer_array = buffer_item.data_array;
-      buffer_array.Write(cell_global_id);
-      buffer_array.Write(face_id);
-      buffer_array.Write(data_size);
-      for (const double value : data) // actual psi_data
-        buffer_array.Write(value);
-    }
-
-    for (auto& [locI, buffer] : locI_buffer_map)
-      send_buffer_.push_back(std::move(buffer));
+  const auto& location_successors = fluds_.GetSPDS().LocationSuccessors();
+  const auto& outgoing_slot_node_offsets = cbc_fluds_.CommonData().OutgoingSlotNodeOffsets();
+  const auto tag = static_cast<int>(angle_set_id_);
 
-    outgoing_message_queue_.clear();
-  } // if there are outgoing messages
-
-  // Now we attempt to flush items in the send buffer
-  bool all_messages_sent = true;
-  for (auto& buffer_item : send_buffer_)
+  // Send each run of consecutive slots written since the last call as one message, directly
+  // from the send buffer
+  for (size_t i = 0; i < pending_slots_.size(); ++i)
   {
-    if (not buffer_item.send_initiated)
+    auto& slots = pending_slots_[i];
+    if (slots.empty())
+      continue;
+    std::sort(slots.begin(), slots.end());
+
+    const int locJ = location_successors[i];
+    auto& comm = comm_set_.LocICommunicator(locJ);
+    const auto dest = comm_set_.MapIonJ(locJ, locJ);
+    const auto& buffer = cbc_fluds_.DeplocIOutgoingPsi()[i];
+    const auto& slot_node_offsets = outgoing_slot_node_offsets[i];
+
+    size_t k = 0;
+    while (k < slots.size())
     {
-      const int locJ = buffer_item.destination;
-      auto& comm = comm_set_.LocICommunicator(locJ);
-      auto dest = comm_set_.MapIonJ(locJ, locJ);
-      auto tag = static_cast<int>(angle_set_id_);
-      buffer_item.mpi_request = comm.isend(dest, tag, buffer_item.data_array.Data());
-      buffer_item.send_initiated = true;
+      size_t k_end = k + 1;
+      while (k_end < slots.size() and slots[k_end] == slots[k_end - 1] + 1)
+        ++k_end;
+
+      const auto begin = cbc_fluds_.SlotOffset(slot_node_offsets, slots[k]);
+      const auto end = cbc_fluds_.SlotOffset(slot_node_offsets, slots[k_end - 1] + 1);
+      send_requests_.push_back(
+        comm.isend(dest, tag, &buffer[begin], static_cast<int>(end - begin)));
+      k = k_end;
     }
+    slots.clear();
+  }
 
-    if (not buffer_item.completed)
-    {
-      if (mpi::test(buffer_item.mpi_request))
-        buffer_item.completed = true;
-      else
-        all_messages_sent = false;
-    }
-  } // for item in buffer
+  // Drop the requests that have completed
+  send_requests_.erase(
+    std::remove_if(send_requests_.begin(),
+                   send_requests_.end(),
+                   [](const mpi::Request& request) { return mpi::test(request); }),
+    send_requests_.end());
 
-  return all_messages_sent;
+  return send_requests_.empty();
 }
 
 std::vector<uint64_t>
@@ -93,43 +96,39 @@ CBC_ASynchronousCommunicator::ReceiveData()
 {
   CALI_CXX_MARK_SCOPE("CBC_ASynchronousCommunicator::ReceiveData");
 
-  using CellFaceKey = std::pair<uint64_t, unsigned int>; // cell_gid + face_id
-  std::map<CellFaceKey, std::vector<double>> received_messages;
+  const auto& common_data = cbc_fluds_.CommonData();
+  const auto& location_dependencies = fluds_.GetSPDS().LocationDependencies();
+  const auto tag = static_cast<int>(angle_set_id_);
+
   std::vector<uint64_t> cells_who_received_data;
-  auto& location_dependencies = fluds_.GetSPDS().LocationDependencies();
-  for (int locJ : location_dependencies)
+  for (size_t i = 0; i < location_dependencies.size(); ++i)
   {
+    const int locJ = location_dependencies[i];
     auto& comm = comm_set_.LocICommunicator(opensn::mpi_comm.rank());
     auto source_rank = comm_set_.MapIonJ(locJ, opensn::mpi_comm.rank());
-    auto tag = static_cast<int>(angle_set_id_);
+    auto& buffer = cbc_fluds_.PrelocIOutgoingPsi()[i];
+    const auto& slot_node_offsets = common_data.IncomingSlotNodeOffsets()[i];
+    const auto& slot_cells = common_data.IncomingSlotCells()[i];
+
     mpi::Status status;
-    if (comm.iprobe(source_rank, tag, status))
+    while (comm.iprobe(source_rank, tag, status))
     {
-      int num_items = status.get_count<std::byte>();
-      std::vector<std::byte> recv_buffer(num_items);
-      comm.recv(source_rank, status.tag(), recv_buffer.data(), num_items);
-      ByteArray data_array(recv_buffer);
-
-      while (not data_array.EndOfBuffer())
-      {
-        const uint64_t cell_global_id = data_array.Read<uint64_t>();
-        const auto face_id = data_array.Read<unsigned int>();
-        const size_t data_size = data_array.Read<size_t>();
-
-        std::vector<double> psi_data;
-        psi_data.reserve(data_size);
-        for (size_t k = 0; k < data_size; ++k)
-          psi_data.push_back(data_array.Read<double>());
-
-        received_messages[{cell_global_id, face_id}] = std::move(psi_data);
-        cells_who_received_data.push_back(
-          fluds_.GetSPDS().Grid().MapCellGlobalID2LocalID(cell_global_id));
-      } // while not at end of buffer
-    }   // Process each message embedded in buffer
+      const int num_values = status.get_count<double>();
+      if (receive_buffer_.size() < static_cast<size_t>(num_values))
+        receive_buffer_.resize(num_values);
+      comm.recv(source_rank, status.tag(), receive_buffer_.data(), num_values);
+
+      // The message is a run of consecutive slots, starting with the index of the first one
+      auto slot = static_cast<size_t>(receive_buffer_[0]);
+      const auto begin = cbc_fluds_.SlotOffset(slot_node_offsets, slot);
+      const auto end = begin + num_values;
+      std::copy_n(receive_buffer_.begin(), num_values, buffer.begin() + begin);
+
+      for (; cbc_fluds_.SlotOffset(slot_node_offsets, slot) < end; ++slot)
+        cells_who_received_data.push_back(slot_cells[slot]);
+    }
   }
 
-  cbc_fluds_.DeplocsOutgoingMessages().merge(received_messages);
-
   return cells_who_received_data;
 }
 
@@ -5,9 +5,7 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/communicators/async_comm.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/cbc_fluds.h"
-#include "framework/data_types/byte_array.h"
 #include "mpicpp-lite/mpicpp-lite.h"
-#include <map>
 #include <vector>
 #include <cstdint>
 #include <cstddef>
@@ -18,26 +16,24 @@ namespace opensn
 {
 
 class MPICommunicatorSet;
-class ByteArray;
 class CBC_FLUDS;
 
+/**
+ * Asynchronous communicator for cell-by-cell sweeps. Outgoing angular fluxes are written by the
+ * sweep chunk directly into the send buffers of the FLUDS, at the slots precomputed by
+ * CBC_FLUDSCommonData. Each run of consecutive slots written since the last send is sent as a
+ * single message straight from the send buffer, and received messages are copied in one block to
+ * the same slots of the receive buffer.
+ */
 class CBC_ASynchronousCommunicator : public AsynchronousCommunicator
 {
 public:
   explicit CBC_ASynchronousCommunicator(size_t angle_set_id,
                                         FLUDS& fluds,
-                                        const MPICommunicatorSet& comm_set)
-    : AsynchronousCommunicator(fluds, comm_set),
-      angle_set_id_(angle_set_id),
-      cbc_fluds_(dynamic_cast<CBC_FLUDS&>(fluds))
-  {
-  }
+                                        const MPICommunicatorSet& comm_set);
 
-  std::vector<double>& InitGetDownwindMessageData(int location_id,
-                                                  uint64_t cell_global_id,
-                                                  unsigned int face_id,
-                                                  size_t angle_set_id,
-                                                  size_t data_size) override;
+  double*
+  InitGetDownwindMessageData(uint64_t cell_local_id, unsigned int face_id, size_t data_size) override;
 
   bool SendData();
 
@@ -45,27 +41,21 @@ public:
 
   void Reset()
   {
-    outgoing_message_queue_.clear();
-    send_buffer_.clear();
+    for (auto& slots : pending_slots_)
+      slots.clear();
+    send_requests_.clear();
   }
 
 protected:
   const size_t angle_set_id_;
   CBC_FLUDS& cbc_fluds_;
 
-  // location_id, cell_global_id, face_id
-  using MessageKey = std::tuple<int, uint64_t, unsigned int>;
-  std::map<MessageKey, std::vector<double>> outgoing_message_queue_;
-
-  struct BufferItem
-  {
-    int destination = 0;
-    mpi::Request mpi_request;
-    bool send_initiated = false;
-    bool completed = false;
-    ByteArray data_array;
-  };
-  std::vector<BufferItem> send_buffer_;
+  /// Slots written since the last send, for each location successor
+  std::vector<std::vector<size_t>> pending_slots_;
+  /// Send requests that have not completed
+  std::vector<mpi::Request> send_requests_;
+  /// Staging buffer for incoming messages
+  std::vector<double> receive_buffer_;
 };
 
 } // namespace opensn
@@ -146,6 +146,18 @@ AAH_FLUDS::NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n)
   }
 }
 
+int
+AAH_FLUDS::NLIncomingFaceOffset(size_t cell_so_index) const
+{
+  return common_data_.so_cell_nonlocal_inco_face_offsets_[cell_so_index];
+}
+
+int
+AAH_FLUDS::NLOutgoingFaceOffset(size_t cell_so_index) const
+{
+  return common_data_.so_cell_nonlocal_outb_face_offsets_[cell_so_index];
+}
+
 size_t
 AAH_FLUDS::GetPrelocIFaceDOFCount(int prelocI) const
 {
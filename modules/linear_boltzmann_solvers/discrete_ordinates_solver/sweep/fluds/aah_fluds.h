@@ -63,6 +63,18 @@ public:
    */
   double* NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n);
 
+  /**
+   * Given a sweep ordering index, returns the non-local incoming face counter of the cell's first
+   * non-local incoming face.
+   */
+  int NLIncomingFaceOffset(size_t cell_so_index) const;
+
+  /**
+   * Given a sweep ordering index, returns the non-local outgoing face counter of the cell's first
+   * non-local outgoing face.
+   */
+  int NLOutgoingFaceOffset(size_t cell_so_index) const;
+
   size_t GetPrelocIFaceDOFCount(int prelocI) const;
   size_t GetDelayedPrelocIFaceDOFCount(int prelocI) const;
   size_t GetDeplocIFaceDOFCount(int deplocI) const;
@@ -6,6 +6,7 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/mesh/mesh_continuum/grid_face_histogram.h"
 #include "framework/logging/log.h"
+#include "framework/logging/log_exceptions.h"
 #include "framework/runtime.h"
 #include "caliper/cali.h"
 #include <algorithm>
@@ -15,11 +16,20 @@ namespace opensn
 
 using LockBox = std::vector<std::pair<int, short>>;
 
+namespace
+{
+/// Lock-box cell index of an open slot.
+constexpr int free_slot = -1;
+/// Lock-box cell index of a slot released during the current level.
+constexpr int released_slot = -2;
+} // namespace
+
 AAH_FLUDSCommonData::AAH_FLUDSCommonData(
   const std::vector<CellFaceNodalMapping>& grid_nodal_mappings,
   const SPDS& spds,
-  const GridFaceHistogram& grid_face_histogram)
-  : FLUDSCommonData(spds, grid_nodal_mappings)
+  const GridFaceHistogram& grid_face_histogram,
+  bool level_synchronous_slots)
+  : FLUDSCommonData(spds, grid_nodal_mappings), level_synchronous_slots_(level_synchronous_slots)
 {
   this->InitializeAlphaElements(spds, grid_face_histogram);
   this->InitializeBetaElements(spds);
@@ -59,10 +69,23 @@ AAH_FLUDSCommonData::InitializeAlphaElements(const SPDS& spds,
   LockBox delayed_lock_box;
   std::set<int> location_boundary_dependency_set;
 
+  // With level-synchronous slots, released slots are held until the end of the level
+  std::vector<size_t> level_ends;
+  if (level_synchronous_slots_)
+  {
+    for (const auto& level : spds.LevelizedLocalSubgrid())
+      level_ends.push_back((level_ends.empty() ? 0 : level_ends.back()) + level.size());
+    OpenSnLogicalErrorIf((level_ends.empty() ? 0 : level_ends.back()) != spls.size(),
+                         "Level-synchronous slots require a levelized local subgrid.");
+  }
+
   // csoi = cell sweep order index
   so_cell_inco_face_face_category_.reserve(spls.size());
   so_cell_outb_face_slot_indices_.reserve(spls.size());
   so_cell_outb_face_face_category_.reserve(spls.size());
+  so_cell_nonlocal_inco_face_offsets_.reserve(spls.size());
+  so_cell_nonlocal_outb_face_offsets_.reserve(spls.size());
+  int num_nonlocal_inco_faces = 0;
   for (auto csoi = 0; csoi < spls.size(); ++csoi)
   {
     auto cell_local_id = spls[csoi];
@@ -70,8 +93,26 @@ AAH_FLUDSCommonData::InitializeAlphaElements(const SPDS& spds,
 
     local_so_cell_mapping[cell.local_id] = csoi; // Set mapping
 
+    so_cell_nonlocal_inco_face_offsets_.push_back(num_nonlocal_inco_faces);
+    so_cell_nonlocal_outb_face_offsets_.push_back(
+      static_cast<int>(nonlocal_outb_face_deplocI_slot_.size()));
+    for (auto f = 0; f < cell.faces.size(); ++f)
+    {
+      const CellFace& face = cell.faces[f];
+      if (spds.CellFaceOrientations()[cell.local_id][f] == FaceOrientation::INCOMING and
+          face.has_neighbor and not face.IsNeighborLocal(grid))
+        ++num_nonlocal_inco_faces;
+    }
+
     SlotDynamics(cell, spds, grid_face_histogram, lock_boxes, delayed_lock_box);
 
+    if (level_synchronous_slots_ and
+        std::binary_search(level_ends.begin(), level_ends.end(), csoi + 1))
+      for (auto& lock_box : lock_boxes)
+        for (auto& lock_box_slot : lock_box)
+          if (lock_box_slot.first == released_slot)
+            lock_box_slot.first = free_slot;
+
   } // for csoi
 
   log.Log(Logger::LOG_LVL::LOG_0VERBOSE_2) << "Done with Slot Dynamics.";
@@ -184,7 +225,7 @@ AAH_FLUDSCommonData::SlotDynamics(const Cell& cell,
           if ((static_cast<uint64_t>(lock_box_slot.first) == face.neighbor_id) and
               (lock_box_slot.second == adj_face_idx))
           {
-            lock_box_slot.first = -1;
+            lock_box_slot.first = level_synchronous_slots_ ? released_slot : free_slot;
             lock_box_slot.second = -1;
             found = true;
             break;
@@ -264,7 +305,7 @@ AAH_FLUDSCommonData::SlotDynamics(const Cell& cell,
       bool slot_found = false;
       for (auto k = 0; k < lock_box.size(); ++k)
       {
-        if (lock_box[k].first < 0)
+        if (lock_box[k].first == free_slot)
         {
           outb_face_slot_indices.push_back(k);
           lock_box[k].first = cell_g_index;
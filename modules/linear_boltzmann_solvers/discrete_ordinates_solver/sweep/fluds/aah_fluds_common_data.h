@@ -41,12 +41,19 @@ public:
     ~INCOMING_FACE_INFO() {}
   }; // TODO: Make common
 public:
+  /**
+   * Builds the FLUDS layout for the given SPDS. With level-synchronous slots, a local psi slot
+   * released by a cell is only reused by cells of later levels of the levelized local subgrid,
+   * so that the cells of a level can be swept concurrently.
+   */
   explicit AAH_FLUDSCommonData(const std::vector<CellFaceNodalMapping>& grid_nodal_mappings,
                                const SPDS& spds,
-                               const GridFaceHistogram& grid_face_histogram);
+                               const GridFaceHistogram& grid_face_histogram,
+                               bool level_synchronous_slots = false);
 
 protected:
   friend class AAH_FLUDS;
+  const bool level_synchronous_slots_;
   int largest_face_ = 0;
   /// Number of face categories
   size_t num_face_categories_ = 0;
@@ -105,6 +112,19 @@ protected:
    */
   std::vector<std::vector<short>> so_cell_inco_face_face_category_;
 
+  /**
+   * This is a vector [cell_sweep_order_index] which holds the number of non-local incoming faces
+   * of all cells preceding the cell in sweep order, i.e. the index of the cell's first non-local
+   * incoming face.
+   */
+  std::vector<int> so_cell_nonlocal_inco_face_offsets_;
+
+  /**
+   * This is a vector [cell_sweep_order_index] which holds the index of the cell's first non-local
+   * outgoing face.
+   */
+  std::vector<int> so_cell_nonlocal_outb_face_offsets_;
+
   /**
    * This is a vector [cell_sweep_order_index][incoming_face_count] that will hold a structure.
    * struct.slot_address holds the slot address where this face's upwind data is stored.
@@ -21,9 +21,24 @@ CBC_FLUDS::CBC_FLUDS(size_t num_groups,
     psi_uk_man_(psi_uk_man),
     sdm_(sdm)
 {
+  // Allocate the send and receive buffers and write the slot headers, which never change
+  auto AllocateBuffers = [this](const std::vector<std::vector<size_t>>& slot_node_offsets,
+                                std::vector<std::vector<double>>& buffers)
+  {
+    buffers.resize(slot_node_offsets.size());
+    for (size_t i = 0; i < slot_node_offsets.size(); ++i)
+    {
+      const size_t num_slots = slot_node_offsets[i].size() - 1;
+      buffers[i].assign(SlotOffset(slot_node_offsets[i], num_slots), 0.0);
+      for (size_t s = 0; s < num_slots; ++s)
+        buffers[i][SlotOffset(slot_node_offsets[i], s)] = static_cast<double>(s);
+    }
+  };
+  AllocateBuffers(common_data_.OutgoingSlotNodeOffsets(), deplocI_outgoing_psi_);
+  AllocateBuffers(common_data_.IncomingSlotNodeOffsets(), prelocI_outgoing_psi_);
 }
 
-const FLUDSCommonData&
+const CBC_FLUDSCommonData&
 CBC_FLUDS::CommonData() const
 {
   return common_data_;
@@ -42,14 +57,16 @@ CBC_FLUDS::GetLocalCellUpwindPsi(const std::vector<double>& psi_data_block, cons
   return &psi_data_block[dof_map];
 }
 
-const std::vector<double>&
-CBC_FLUDS::GetNonLocalUpwindData(uint64_t cell_global_id, unsigned int face_id) const
+const double*
+CBC_FLUDS::GetNonLocalUpwindData(uint64_t cell_local_id, unsigned int face_id) const
 {
-  return deplocs_outgoing_messages_.at({cell_global_id, face_id});
+  const auto& [prelocI, slot] = common_data_.GetNonLocalFaceSlot(cell_local_id, face_id);
+  const auto& slot_node_offsets = common_data_.IncomingSlotNodeOffsets()[prelocI];
+  return &prelocI_outgoing_psi_[prelocI][SlotOffset(slot_node_offsets, slot) + 1];
 }
 
 const double*
-CBC_FLUDS::GetNonLocalUpwindPsi(const std::vector<double>& psi_data,
+CBC_FLUDS::GetNonLocalUpwindPsi(const double* psi_data,
                                 unsigned int face_node_mapped,
                                 unsigned int angle_set_index)
 {
@@ -57,4 +74,11 @@ CBC_FLUDS::GetNonLocalUpwindPsi(const std::vector<double>& psi_data,
   return &psi_data[dof_map];
 }
 
+double*
+CBC_FLUDS::GetNonLocalDownwindData(int deplocI, size_t slot)
+{
+  const auto& slot_node_offsets = common_data_.OutgoingSlotNodeOffsets()[deplocI];
+  return &deplocI_outgoing_psi_[deplocI][SlotOffset(slot_node_offsets, slot) + 1];
+}
+
 } // namespace opensn
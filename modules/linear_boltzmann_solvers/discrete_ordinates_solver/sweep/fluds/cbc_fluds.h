@@ -5,7 +5,6 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/cbc_fluds_common_data.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/fluds.h"
-#include <map>
 #include <functional>
 
 namespace opensn
@@ -25,20 +24,33 @@ public:
             const UnknownManager& psi_uk_man,
             const SpatialDiscretization& sdm);
 
-  const FLUDSCommonData& CommonData() const;
+  const CBC_FLUDSCommonData& CommonData() const;
 
   const std::vector<double>& GetLocalUpwindDataBlock() const;
 
   const double* GetLocalCellUpwindPsi(const std::vector<double>& psi_data_block, const Cell& cell);
 
-  const std::vector<double>& GetNonLocalUpwindData(uint64_t cell_global_id,
-                                                   unsigned int face_id) const;
+  /// Returns the received angular flux of a non-local incoming face.
+  const double* GetNonLocalUpwindData(uint64_t cell_local_id, unsigned int face_id) const;
 
-  const double* GetNonLocalUpwindPsi(const std::vector<double>& psi_data,
+  const double* GetNonLocalUpwindPsi(const double* psi_data,
                                      unsigned int face_node_mapped,
                                      unsigned int angle_set_index);
 
-  void ClearLocalAndReceivePsi() override { deplocs_outgoing_messages_.clear(); }
+  /// Returns the outgoing angular flux of a slot in the send buffer of a location successor.
+  double* GetNonLocalDownwindData(int deplocI, size_t slot);
+
+  /**
+   * Returns the offset of a slot in a send or receive buffer. Each slot starts with its slot
+   * index, stored as a double, followed by the angular flux of all its face nodes. Consecutive
+   * slots are therefore contiguous and a run of slots identifies itself by its first value.
+   */
+  size_t SlotOffset(const std::vector<size_t>& slot_node_offsets, size_t slot) const
+  {
+    return slot_node_offsets[slot] * num_groups_and_angles_ + slot;
+  }
+
+  void ClearLocalAndReceivePsi() override {}
   void ClearSendPsi() override {}
   void AllocateInternalLocalPsi(size_t num_grps, size_t num_angles) override {}
   void AllocateOutgoingPsi(size_t num_grps, size_t num_angles, size_t num_loc_sucs) override {}
@@ -69,14 +81,6 @@ public:
     return delayed_prelocI_outgoing_psi_old_;
   }
 
-  // cell_global_id, face_id
-  using CellFaceKey = std::pair<uint64_t, unsigned int>;
-
-  std::map<CellFaceKey, std::vector<double>>& DeplocsOutgoingMessages()
-  {
-    return deplocs_outgoing_messages_;
-  }
-
 private:
   const CBC_FLUDSCommonData& common_data_;
   std::reference_wrapper<std::vector<double>> local_psi_data_;
@@ -85,14 +89,14 @@ private:
 
   std::vector<double> delayed_local_psi_;
   std::vector<double> delayed_local_psi_old_;
+  /// Send buffer for each location successor, laid out by CBC_FLUDSCommonData slots
   std::vector<std::vector<double>> deplocI_outgoing_psi_;
+  /// Receive buffer for each location dependency, laid out by CBC_FLUDSCommonData slots
   std::vector<std::vector<double>> prelocI_outgoing_psi_;
   std::vector<std::vector<double>> boundryI_incoming_psi_;
 
   std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_;
   std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_old_;
-
-  std::map<CellFaceKey, std::vector<double>> deplocs_outgoing_messages_;
 };
 
 } // namespace opensn
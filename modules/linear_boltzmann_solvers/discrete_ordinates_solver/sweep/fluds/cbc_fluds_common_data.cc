@@ -4,6 +4,8 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/cbc_fluds_common_data.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include <algorithm>
+#include <tuple>
 
 namespace opensn
 {
@@ -12,6 +14,66 @@ CBC_FLUDSCommonData::CBC_FLUDSCommonData(
   const SPDS& spds, const std::vector<CellFaceNodalMapping>& grid_nodal_mappings)
   : FLUDSCommonData(spds, grid_nodal_mappings)
 {
+  const auto& grid = spds.Grid();
+  const auto& face_orientations = spds.CellFaceOrientations();
+
+  cell_face_offsets_.assign(grid.local_cells.size() + 1, 0);
+  for (const auto& cell : grid.local_cells)
+    cell_face_offsets_[cell.local_id + 1] = cell_face_offsets_[cell.local_id] + cell.faces.size();
+  face_slots_.assign(cell_face_offsets_.back(), {});
+
+  // receiving cell global id, receiving face index, local cell id, local face index
+  using SlotKey = std::tuple<uint64_t, unsigned int, uint64_t, unsigned int>;
+  std::vector<std::vector<SlotKey>> outgoing_keys(spds.LocationSuccessors().size());
+  std::vector<std::vector<SlotKey>> incoming_keys(spds.LocationDependencies().size());
+
+  for (const auto& cell : grid.local_cells)
+  {
+    for (unsigned int f = 0; f < cell.faces.size(); ++f)
+    {
+      const auto& face = cell.faces[f];
+      if (not face.has_neighbor or grid.IsCellLocal(face.neighbor_id))
+        continue;
+
+      const int locJ = grid.cells[face.neighbor_id].partition_id;
+      const auto orientation = face_orientations[cell.local_id][f];
+      if (orientation == FaceOrientation::OUTGOING)
+      {
+        const auto adj_face = GetFaceNodalMapping(cell.local_id, f).associated_face_;
+        outgoing_keys[spds.MapLocJToDeplocI(locJ)].emplace_back(
+          face.neighbor_id, adj_face, cell.local_id, f);
+      }
+      else if (orientation == FaceOrientation::INCOMING)
+        incoming_keys[spds.MapLocJToPrelocI(locJ)].emplace_back(
+          cell.global_id, f, cell.local_id, f);
+    }
+  }
+
+  auto AssignSlots = [this](std::vector<std::vector<SlotKey>>& keys,
+                            std::vector<std::vector<size_t>>& node_offsets,
+                            std::vector<std::vector<uint64_t>>* slot_cells)
+  {
+    node_offsets.assign(keys.size(), {});
+    if (slot_cells)
+      slot_cells->assign(keys.size(), {});
+    for (int i = 0; i < keys.size(); ++i)
+    {
+      std::sort(keys[i].begin(), keys[i].end());
+      node_offsets[i].assign(keys[i].size() + 1, 0);
+      for (size_t s = 0; s < keys[i].size(); ++s)
+      {
+        const auto& [rcv_cell_gid, rcv_face, cell_local_id, f] = keys[i][s];
+        const auto num_face_nodes = GetFaceNodalMapping(cell_local_id, f).face_node_mapping_.size();
+        node_offsets[i][s + 1] = node_offsets[i][s] + num_face_nodes;
+        face_slots_[cell_face_offsets_[cell_local_id] + f] = {i, s};
+        if (slot_cells)
+          (*slot_cells)[i].push_back(cell_local_id);
+      }
+    }
+  };
+
+  AssignSlots(outgoing_keys, outgoing_slot_node_offsets_, nullptr);
+  AssignSlots(incoming_keys, incoming_slot_node_offsets_, &incoming_slot_cells_);
 }
 
 } // namespace opensn
@@ -5,15 +5,72 @@
 
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/fluds_common_data.h"
 #include <cinttypes>
+#include <cstddef>
 
 namespace opensn
 {
 
+/**
+ * Common data for cell-by-cell FLUDS. In addition to the face nodal mappings, this precomputes the
+ * layout of the angular flux exchanged with neighboring locations. Every non-local face that is
+ * incoming or outgoing for the sweep direction is assigned a fixed slot in the buffer shared with
+ * the neighboring location. Slots are ordered by the global id and face index of the receiving
+ * cell, which both locations can compute without communication.
+ */
 class CBC_FLUDSCommonData : public FLUDSCommonData
 {
 public:
+  /// Position of a non-local face in the buffer exchanged with a neighboring location.
+  struct NonLocalFaceSlot
+  {
+    /// Index into SPDS::LocationSuccessors() for outgoing faces or SPDS::LocationDependencies()
+    /// for incoming faces. -1 for faces that are not exchanged.
+    int location_index = -1;
+    /// Slot index within the buffer of that location.
+    size_t slot = 0;
+  };
+
   CBC_FLUDSCommonData(const SPDS& spds,
                       const std::vector<CellFaceNodalMapping>& grid_nodal_mappings);
+
+  /// Returns the slot of a non-local cell face.
+  const NonLocalFaceSlot& GetNonLocalFaceSlot(uint64_t cell_local_id, unsigned int face_id) const
+  {
+    return face_slots_[cell_face_offsets_[cell_local_id] + face_id];
+  }
+
+  /**
+   * Returns, for each location successor, the face-node offset of each outgoing slot. Each vector
+   * has one more entry than the number of slots.
+   */
+  const std::vector<std::vector<size_t>>& OutgoingSlotNodeOffsets() const
+  {
+    return outgoing_slot_node_offsets_;
+  }
+
+  /**
+   * Returns, for each location dependency, the face-node offset of each incoming slot. Each vector
+   * has one more entry than the number of slots.
+   */
+  const std::vector<std::vector<size_t>>& IncomingSlotNodeOffsets() const
+  {
+    return incoming_slot_node_offsets_;
+  }
+
+  /// Returns, for each location dependency, the local id of the cell receiving each slot.
+  const std::vector<std::vector<uint64_t>>& IncomingSlotCells() const
+  {
+    return incoming_slot_cells_;
+  }
+
+private:
+  /// Offset of each local cell's faces into face_slots_
+  std::vector<size_t> cell_face_offsets_;
+  std::vector<NonLocalFaceSlot> face_slots_;
+
+  std::vector<std::vector<size_t>> outgoing_slot_node_offsets_;
+  std::vector<std::vector<size_t>> incoming_slot_node_offsets_;
+  std::vector<std::vector<uint64_t>> incoming_slot_cells_;
 };
 
 } // namespace opensn
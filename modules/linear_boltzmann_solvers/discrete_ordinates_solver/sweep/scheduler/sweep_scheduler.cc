@@ -70,42 +70,17 @@ SweepScheduler::InitializeAlgoDOG()
       auto angleset = angleset_group.AngleSets()[as];
       const auto& spds = dynamic_cast<const AAH_SPDS&>(angleset->GetSPDS());
 
-      const std::vector<STDG>& leveled_graph = spds.GlobalSweepPlanes();
-
-      // Find location depth
-      int loc_depth = -1;
-      for (size_t level = 0; level < leveled_graph.size(); ++level)
-      {
-        for (size_t index = 0; index < leveled_graph[level].item_id.size(); ++index)
-        {
-          if (leveled_graph[level].item_id[index] == opensn::mpi_comm.rank())
-          {
-            loc_depth = static_cast<int>(leveled_graph.size() - level);
-            break;
-          }
-        } // for locations in plane
-      }   // for sweep planes
-
       // Set up rule values
-      if (loc_depth >= 0)
-      {
-        RuleValues new_rule_vals(angleset);
-        new_rule_vals.depth_of_graph = loc_depth;
-        new_rule_vals.set_index = as + q * num_anglesets;
+      RuleValues new_rule_vals(angleset);
+      new_rule_vals.depth_of_graph = spds.NumGlobalSweepLevels() - spds.GlobalSweepLevel();
+      new_rule_vals.set_index = as + q * num_anglesets;
 
-        const auto& omega = spds.Omega();
-        new_rule_vals.sign_of_omegax = (omega.x >= 0) ? 2 : 1;
-        new_rule_vals.sign_of_omegay = (omega.y >= 0) ? 2 : 1;
-        new_rule_vals.sign_of_omegaz = (omega.z >= 0) ? 2 : 1;
-
-        rule_values_.push_back(new_rule_vals);
-      }
-      else
-      {
-        log.LogAllError() << "Location depth not found in Depth-Of-Graph algorithm.";
-        Exit(EXIT_FAILURE);
-      }
+      const auto& omega = spds.Omega();
+      new_rule_vals.sign_of_omegax = (omega.x >= 0) ? 2 : 1;
+      new_rule_vals.sign_of_omegay = (omega.y >= 0) ? 2 : 1;
+      new_rule_vals.sign_of_omegaz = (omega.z >= 0) ? 2 : 1;
 
+      rule_values_.push_back(new_rule_vals);
     } // for anglesets
   }   // for quadrants/anglesetgroups
 
@@ -351,6 +326,7 @@ SweepScheduler::ZeroOutputFluxDataStructures()
   ZeroDestinationPsi();
   ZeroDestinationPhi();
   ZeroOutgoingDelayedPsi();
+  sweep_chunk_.ZeroAccumulators();
 }
 
 void
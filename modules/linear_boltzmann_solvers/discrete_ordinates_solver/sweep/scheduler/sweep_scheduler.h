@@ -93,7 +93,10 @@ public:
   /// Resets all the outgoing intra-location and inter-location cyclic interfaces.
   void ZeroOutgoingDelayedPsi();
 
-  /// Clear the output angular flux vector, the flux moments vector, and the outgoing delayed psi.
+  /**
+   * Clear the output angular flux vector, the flux moments vector, the outgoing delayed psi and
+   * the quantities of the sweep chunk's accumulators.
+   */
   void ZeroOutputFluxDataStructures();
 
   /// Activates or deactives the surface src flag.
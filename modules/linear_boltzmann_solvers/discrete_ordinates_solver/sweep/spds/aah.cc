@@ -9,12 +9,17 @@
 #include "caliper/cali.h"
 #include <boost/graph/topological_sort.hpp>
 #include <algorithm>
+#include <set>
 
 namespace opensn
 {
 
 AAH_SPDS::AAH_SPDS(int id, const Vector3& omega, const MeshContinuum& grid, bool allow_cycles)
-  : SPDS(omega, grid), id_(id), allow_cycles_(allow_cycles)
+  : SPDS(omega, grid),
+    id_(id),
+    allow_cycles_(allow_cycles),
+    global_sweep_level_(0),
+    num_global_sweep_levels_(0)
 {
   CALI_CXX_MARK_SCOPE("AAH_SPDS::AAH_SPDS");
 
@@ -80,16 +85,12 @@ AAH_SPDS::AAH_SPDS(int id, const Vector3& omega, const MeshContinuum& grid, bool
   for (auto& level : levelized_spls_)
     for (auto& cell : level)
       spls_.push_back(cell);
-
-  // Generate location-to-location dependencies
-  global_dependencies_.resize(opensn::mpi_comm.size());
-  CommunicateLocationDependencies(location_dependencies_, global_dependencies_);
 }
 
 void
-AAH_SPDS::BuildGlobalSweepFAS()
+AAH_SPDS::BuildGlobalSweepFAS(const std::vector<std::vector<int>>& global_dependencies)
 {
-  assert(not global_dependencies_.empty());
+  assert(global_dependencies.size() == opensn::mpi_comm.size());
 
   CALI_CXX_MARK_SCOPE("AAH_SPDS::BuildGlobalSweepFAS");
 
@@ -97,7 +98,7 @@ AAH_SPDS::BuildGlobalSweepFAS()
   Graph global_tdg(opensn::mpi_comm.size());
 
   for (int loc = 0; loc < opensn::mpi_comm.size(); ++loc)
-    for (int dep : global_dependencies_[loc])
+    for (int dep : global_dependencies[loc])
       boost::add_edge(dep, loc, 1.0, global_tdg);
 
   // Remove cycles and generate the feedback arc set (FAS). The FAS is the list of edges that must
@@ -114,99 +115,138 @@ AAH_SPDS::BuildGlobalSweepFAS()
 }
 
 void
-AAH_SPDS::BuildGlobalSweepTDG()
+AAH_SPDS::ApplyGlobalSweepFAS()
 {
-  CALI_CXX_MARK_SCOPE("AAH_SPDS::BuildGlobalSweepTDG");
-
-  // Create graph
-  Graph global_tdg(opensn::mpi_comm.size());
-
-  for (int loc = 0; loc < opensn::mpi_comm.size(); ++loc)
-    for (int dep : global_dependencies_[loc])
-      boost::add_edge(dep, loc, 1.0, global_tdg);
-
-  // De-serialize edges
-  std::vector<std::pair<int, int>> edges_to_remove;
-  edges_to_remove.resize(global_sweep_fas_.size() / 2, std::pair<int, int>(0, 0));
-  int i = 0;
-  for (auto& edge : edges_to_remove)
-  {
-    edge.first = global_sweep_fas_[i++];
-    edge.second = global_sweep_fas_[i++];
-  }
+  CALI_CXX_MARK_SCOPE("AAH_SPDS::ApplyGlobalSweepFAS");
 
-  // Remove edges
-  for (auto& edge_to_remove : edges_to_remove)
+  const int rank = opensn::mpi_comm.rank();
+  for (size_t i = 0; i + 1 < global_sweep_fas_.size(); i += 2)
   {
-    int rlocI = edge_to_remove.first;
-    int locI = edge_to_remove.second;
-
-    boost::remove_edge(rlocI, locI, global_tdg);
+    const int rlocI = global_sweep_fas_[i];
+    const int locI = global_sweep_fas_[i + 1];
 
-    if (locI == opensn::mpi_comm.rank())
+    if (locI == rank)
     {
       auto dependent_location =
         std::find(location_dependencies_.begin(), location_dependencies_.end(), rlocI);
-      location_dependencies_.erase(dependent_location);
+      if (dependent_location != location_dependencies_.end())
+        location_dependencies_.erase(dependent_location);
       delayed_location_dependencies_.push_back(rlocI);
     }
 
-    if (rlocI == opensn::mpi_comm.rank())
+    if (rlocI == rank)
       delayed_location_successors_.push_back(locI);
   }
+}
 
-  // Generate topological ordering
-  std::vector<size_t> global_linear_sweep_order;
-  boost::topological_sort(global_tdg, std::back_inserter(global_linear_sweep_order));
-  std::reverse(global_linear_sweep_order.begin(), global_linear_sweep_order.end());
-  if (global_linear_sweep_order.empty())
-  {
-    throw std::logic_error("AAH_SPDS: Cyclic dependencies found in the global sweep graph.\n"
-                           "Cycles need to be allowed by the calling application.");
-  }
-
-  // Rank to global_tdg id mapping
-  std::vector<int> global_order_mapping(opensn::mpi_comm.size(), -1);
-  for (int k = 0; k < opensn::mpi_comm.size(); ++k)
+void
+AAH_SPDS::BuildGlobalSweepLevels(const std::vector<std::shared_ptr<AAH_SPDS>>& spds_list)
+{
+  CALI_CXX_MARK_SCOPE("AAH_SPDS::BuildGlobalSweepLevels");
+
+  const size_t num_spds = spds_list.size();
+
+  // The level of a location is one more than the highest level of the locations it depends on.
+  // Levels are resolved in rounds. In each round, every location sends the levels resolved in the
+  // previous round to its neighbors, i.e. the locations that it depends on or that depend on it
+  // for any SPDS. A message is sent to every neighbor in every round, even if it is empty, so that
+  // the rounds stay matched without a global synchronization of the messages.
+  std::vector<std::vector<int>> successors(num_spds);
+  std::set<int> neighbors;
+  std::vector<int> num_pending_dependencies(num_spds, 0);
+  std::vector<int> max_dependency_level(num_spds, -1);
+  std::vector<int> levels(num_spds, -1);
+  std::vector<size_t> newly_resolved;
+  for (size_t s = 0; s < num_spds; ++s)
   {
-    int loc = global_linear_sweep_order[k];
-    global_order_mapping[loc] = k;
+    const auto& spds = *spds_list[s];
+    for (const int locJ : spds.location_successors_)
+      if (std::find(spds.delayed_location_successors_.begin(),
+                    spds.delayed_location_successors_.end(),
+                    locJ) == spds.delayed_location_successors_.end())
+        successors[s].push_back(locJ);
+
+    neighbors.insert(spds.location_dependencies_.begin(), spds.location_dependencies_.end());
+    neighbors.insert(successors[s].begin(), successors[s].end());
+
+    num_pending_dependencies[s] = static_cast<int>(spds.location_dependencies_.size());
+    if (num_pending_dependencies[s] == 0)
+    {
+      levels[s] = 0;
+      newly_resolved.push_back(s);
+    }
   }
 
-  // Determine sweep order ranks
-  int abs_max_rank = 0;
-  std::vector<int> global_sweep_order_rank(opensn::mpi_comm.size(), -1);
-  for (int k = 0; k < opensn::mpi_comm.size(); ++k)
+  const int tag = 0;
+  std::vector<std::vector<int>> send_buffers(neighbors.size());
+  while (true)
   {
-    int loc = global_linear_sweep_order[k];
-    if (global_dependencies_[loc].empty())
-      global_sweep_order_rank[k] = 0;
-    else
+    const auto local_num_resolved = static_cast<int>(newly_resolved.size());
+    int num_resolved = 0;
+    mpi_comm.all_reduce(local_num_resolved, num_resolved, mpi::op::sum<int>());
+    if (num_resolved == 0)
+      break;
+
+    // Send the newly resolved levels to the successors of each SPDS
+    std::vector<mpi::Request> requests;
+    requests.reserve(neighbors.size());
+    size_t n = 0;
+    for (const int neighbor : neighbors)
     {
-      int max_rank = -1;
-      for (auto dep_loc : global_dependencies_[loc])
+      auto& buffer = send_buffers[n++];
+      buffer.assign(1, 0);
+      for (const size_t s : newly_resolved)
       {
-        if (dep_loc < 0)
-          continue;
+        if (std::find(successors[s].begin(), successors[s].end(), neighbor) !=
+            successors[s].end())
+        {
+          buffer.push_back(static_cast<int>(s));
+          buffer.push_back(levels[s]);
+          ++buffer.front();
+        }
+      }
+      requests.push_back(mpi_comm.isend(neighbor, tag, buffer));
+    }
 
-        int dep_mapped_index = global_order_mapping[dep_loc];
-        if (global_sweep_order_rank[dep_mapped_index] > max_rank)
-          max_rank = global_sweep_order_rank[dep_mapped_index];
+    // Receive the levels of the dependencies that were resolved in the previous round
+    newly_resolved.clear();
+    std::vector<int> buffer;
+    for (const int neighbor : neighbors)
+    {
+      mpi_comm.recv(neighbor, tag, buffer);
+      for (int i = 0; i < buffer.front(); ++i)
+      {
+        const auto s = static_cast<size_t>(buffer[1 + 2 * i]);
+        max_dependency_level[s] = std::max(max_dependency_level[s], buffer[2 + 2 * i]);
+        if (--num_pending_dependencies[s] == 0)
+        {
+          levels[s] = max_dependency_level[s] + 1;
+          newly_resolved.push_back(s);
+        }
       }
-      global_sweep_order_rank[k] = max_rank + 1;
-      if ((max_rank + 1) > abs_max_rank)
-        abs_max_rank = max_rank + 1;
     }
+
+    for (auto& request : requests)
+      mpi::wait(request);
+  }
+
+  // Locations that are still unresolved are part of a cycle
+  int local_num_unresolved = static_cast<int>(std::count(levels.begin(), levels.end(), -1));
+  int num_unresolved = 0;
+  mpi_comm.all_reduce(local_num_unresolved, num_unresolved, mpi::op::sum<int>());
+  if (num_unresolved > 0)
+  {
+    throw std::logic_error("AAH_SPDS: Cyclic dependencies found in the global sweep graph.\n"
+                           "Cycles need to be allowed by the calling application.");
   }
 
-  // Generate TDG
-  for (int rank = 0; rank <= abs_max_rank; ++rank)
+  std::vector<int> max_levels(num_spds, 0);
+  mpi_comm.all_reduce(levels, max_levels, mpi::op::max<int>());
+
+  for (size_t s = 0; s < num_spds; ++s)
   {
-    STDG stdg;
-    for (int k = 0; k < opensn::mpi_comm.size(); ++k)
-      if (global_sweep_order_rank[k] == rank)
-        stdg.item_id.push_back(global_linear_sweep_order[k]);
-    global_sweep_planes_.push_back(stdg);
+    spds_list[s]->global_sweep_level_ = levels[s];
+    spds_list[s]->num_global_sweep_levels_ = max_levels[s] + 1;
   }
 }
 
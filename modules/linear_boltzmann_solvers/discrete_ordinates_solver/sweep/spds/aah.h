@@ -24,14 +24,25 @@ public:
   /// Returns the id of this SPDS.
   int Id() { return id_; }
 
-  /// Return the levelized global sweep TDG.
-  const std::vector<STDG>& GlobalSweepPlanes() const { return global_sweep_planes_; }
+  /// Returns the level of this location in the leveled global sweep graph.
+  int GlobalSweepLevel() const { return global_sweep_level_; }
 
-  /// Builds the Feedback Arc Set (FAS) for the global sweep.
-  void BuildGlobalSweepFAS();
+  /// Returns the number of levels in the leveled global sweep graph.
+  int NumGlobalSweepLevels() const { return num_global_sweep_levels_; }
 
-  /// Builds the Task Dependency Graph (TDG) for the global sweep.
-  void BuildGlobalSweepTDG();
+  /**
+   * Builds the Feedback Arc Set (FAS) for the global sweep.
+   *
+   * \param global_dependencies The location dependencies of every location, indexed by rank.
+   */
+  void BuildGlobalSweepFAS(const std::vector<std::vector<int>>& global_dependencies);
+
+  /**
+   * Moves the FAS edges that end at this location from the location dependencies to the delayed
+   * location dependencies, and records the FAS edges that start at this location as delayed
+   * location successors.
+   */
+  void ApplyGlobalSweepFAS();
 
   /// Returns the global sweep FAS as a vector of edges.
   std::vector<int> GlobalSweepFAS() { return global_sweep_fas_; }
@@ -42,15 +53,23 @@ public:
    */
   void SetGlobalSweepFAS(std::vector<int>& edges) { global_sweep_fas_ = edges; }
 
+  /**
+   * Levels the global sweep graphs of the given SPDS. Each location only exchanges levels with the
+   * locations it depends on and the locations that depend on it, so that no location stores the
+   * full global sweep graph. The FAS of each SPDS must have been applied beforehand. This is a
+   * collective operation and all ranks must pass their SPDS in the same order.
+   */
+  static void BuildGlobalSweepLevels(const std::vector<std::shared_ptr<AAH_SPDS>>& spds_list);
+
 private:
   /// Unique identifier for this SPDS.
   int id_;
   /// Flag indicating whether cycles are allowed in the dependency graphs.
   bool allow_cycles_;
-  /// Location-to-location global sweep dependencies.
-  std::vector<std::vector<int>> global_dependencies_;
-  /// Levelized global sweep task dependency graph.
-  std::vector<STDG> global_sweep_planes_;
+  /// Level of this location in the leveled global sweep graph.
+  int global_sweep_level_;
+  /// Number of levels in the leveled global sweep graph.
+  int num_global_sweep_levels_;
   /// Vector of edges representing the FAS used to break cycles in the global sweep graph.
   std::vector<int> global_sweep_fas_;
 };
@@ -10,6 +10,8 @@
 namespace opensn
 {
 
+class AAH_FLUDS;
+
 class AahSweepChunk : public SweepChunk
 {
 public:
@@ -24,9 +26,48 @@ public:
                 const LBSGroupset& groupset,
                 const std::map<int, std::shared_ptr<MultiGroupXS>>& xs,
                 int num_moments,
-                int max_num_cell_dofs);
+                int max_num_cell_dofs,
+                int num_threads = 1);
 
   void Sweep(AngleSet& angle_set) override;
+
+private:
+  /// Work arrays for the solution of one cell. Each sweeping thread has its own.
+  struct CellScratch
+  {
+    CellScratch(int max_num_cell_dofs, size_t num_groups)
+      : Amat(max_num_cell_dofs, max_num_cell_dofs),
+        Atemp(max_num_cell_dofs, max_num_cell_dofs),
+        b(num_groups, Vector<double>(max_num_cell_dofs, 0.)),
+        source(max_num_cell_dofs)
+    {
+    }
+
+    DenseMatrix<double> Amat;
+    DenseMatrix<double> Atemp;
+    std::vector<Vector<double>> b;
+    std::vector<double> source;
+  };
+
+  /**
+   * Sweeps all angles of the angle set through the cell at the given sweep ordering index. The
+   * non-local face counters hold the counter values preceding the cell's first non-local incoming
+   * and outgoing faces and are advanced past the faces of the cell.
+   */
+  void SweepCell(AngleSet& angle_set,
+                 AAH_FLUDS& fluds,
+                 size_t spls_index,
+                 int& preloc_face_counter,
+                 int& deploc_face_counter,
+                 CellScratch& scratch);
+
+  /**
+   * Sweeps the levels of the local subgrid in order, distributing the cells of each level across
+   * threads. Cells in a level have no dependencies on one another.
+   */
+  void SweepLevels(AngleSet& angle_set);
+
+  const int num_threads_;
 };
 
 } // namespace opensn
@@ -102,7 +102,7 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
   std::vector<double> face_mu_values(cell_num_faces_);
 
   const auto& rho = densities_[cell_local_id_];
-  const auto& sigma_t = xs_.at(cell_->material_id)->SigmaTotal();
+  const auto& sigma_t = cell_transport_view_->XS().SigmaTotal();
 
   // as = angle set
   // ss = subset
@@ -137,17 +137,16 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
       const bool is_boundary_face = not face.has_neighbor;
       auto face_nodal_mapping = &fluds_->CommonData().GetFaceNodalMapping(cell_local_id_, f);
 
-      const std::vector<double>* psi_upwnd_data_block = nullptr;
       const double* psi_local_face_upwnd_data = nullptr;
+      const double* psi_nonlocal_face_upwnd_data = nullptr;
       if (is_local_face)
       {
-        psi_upwnd_data_block = &fluds_->GetLocalUpwindDataBlock();
         psi_local_face_upwnd_data = fluds_->GetLocalCellUpwindPsi(
-          *psi_upwnd_data_block, *cell_transport_view_->FaceNeighbor(f));
+          fluds_->GetLocalUpwindDataBlock(), *cell_transport_view_->FaceNeighbor(f));
       }
       else if (not is_boundary_face)
       {
-        psi_upwnd_data_block = &fluds_->GetNonLocalUpwindData(cell_->global_id, f);
+        psi_nonlocal_face_upwnd_data = fluds_->GetNonLocalUpwindData(cell_local_id_, f);
       }
 
       // IntSf_mu_psi_Mij_dA
@@ -173,9 +172,9 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
           }
           else if (not is_boundary_face)
           {
-            assert(psi_upwnd_data_block);
+            assert(psi_nonlocal_face_upwnd_data);
             const unsigned int adj_face_node = face_nodal_mapping->face_node_mapping_[fj];
-            psi = fluds_->GetNonLocalUpwindPsi(*psi_upwnd_data_block, adj_face_node, as_ss_idx);
+            psi = fluds_->GetNonLocalUpwindPsi(psi_nonlocal_face_upwnd_data, adj_face_node, as_ss_idx);
           }
           else
             psi = angle_set.PsiBoundary(face.neighbor_id,
@@ -261,6 +260,8 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
       }
     }
 
+    Accumulate(*cell_, direction_num, gs_ss_begin_, gs_ss_size_, b);
+
     // Perform outgoing surface operations
     for (int f = 0; f < cell_num_faces_; ++f)
     {
@@ -274,19 +275,13 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
         (is_boundary_face and angle_set.GetBoundaries()[face.neighbor_id]->IsReflecting());
       const auto& IntF_shapeI = IntS_shapeI_[f];
 
-      const int locality = cell_transport_view_->FaceLocality(f);
       const size_t num_face_nodes = cell_mapping_->NumFaceNodes(f);
-      auto& face_nodal_mapping = fluds_->CommonData().GetFaceNodalMapping(cell_local_id_, f);
-      std::vector<double>* psi_dnwnd_data = nullptr;
+      double* psi_dnwnd_data = nullptr;
       if (not is_boundary_face and not is_local_face)
       {
         auto& async_comm = *angle_set.GetCommunicator();
         size_t data_size = num_face_nodes * group_angle_stride_;
-        psi_dnwnd_data = &async_comm.InitGetDownwindMessageData(locality,
-                                                                face.neighbor_id,
-                                                                face_nodal_mapping.associated_face_,
-                                                                angle_set.GetID(),
-                                                                data_size);
+        psi_dnwnd_data = async_comm.InitGetDownwindMessageData(cell_local_id_, f, data_size);
       }
 
       for (int fi = 0; fi < num_face_nodes; ++fi)
@@ -307,7 +302,7 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
         {
           assert(psi_dnwnd_data);
           const size_t addr_offset = fi * group_angle_stride_ + as_ss_idx * group_stride_;
-          psi = &(*psi_dnwnd_data)[addr_offset];
+          psi = &psi_dnwnd_data[addr_offset];
         }
         else if (is_reflecting_boundary_face)
           psi = angle_set.PsiReflected(
@@ -11,6 +11,37 @@
 namespace opensn
 {
 
+/**
+ * Interface for angular integrals that are accumulated during the sweep from the angular flux of
+ * each cell as it is solved, in the same way as the flux moments. This allows such integrals to
+ * be computed without storing the angular flux.
+ */
+class SweepAccumulator
+{
+public:
+  virtual ~SweepAccumulator() = default;
+
+  /// Resets the accumulated quantities. Called before every sweep.
+  virtual void Zero() = 0;
+
+  /**
+   * Adds the contribution of the angular flux of a cell in one direction. Cells of the same sweep
+   * level may be accumulated concurrently, so implementations may only modify data of this cell.
+   *
+   * \param cell The cell whose angular flux was solved.
+   * \param direction_num The index of the direction in the groupset quadrature.
+   * \param gs_ss_begin The index of the first group of the group subset within the groupset.
+   * \param gs_ss_size The number of groups in the group subset.
+   * \param psi The angular flux, with `psi[gsg](i)` the value at node `i` for group subset group
+   *        `gsg`.
+   */
+  virtual void Accumulate(const Cell& cell,
+                          size_t direction_num,
+                          size_t gs_ss_begin,
+                          size_t gs_ss_size,
+                          const std::vector<Vector<double>>& psi) = 0;
+};
+
 /// Sweep work function
 class SweepChunk
 {
@@ -68,9 +99,33 @@ public:
 
   virtual ~SweepChunk() = default;
 
+  /// Adds an angular integral to be accumulated during every sweep.
+  void AddAccumulator(std::shared_ptr<SweepAccumulator> accumulator)
+  {
+    accumulators_.push_back(std::move(accumulator));
+  }
+
 protected:
   friend class SweepScheduler;
 
+  /// Resets the quantities of all accumulators.
+  void ZeroAccumulators()
+  {
+    for (auto& accumulator : accumulators_)
+      accumulator->Zero();
+  }
+
+  /// Passes the angular flux of a cell in one direction to all accumulators.
+  void Accumulate(const Cell& cell,
+                  size_t direction_num,
+                  size_t gs_ss_begin,
+                  size_t gs_ss_size,
+                  const std::vector<Vector<double>>& psi) const
+  {
+    for (const auto& accumulator : accumulators_)
+      accumulator->Accumulate(cell, direction_num, gs_ss_begin, gs_ss_size, psi);
+  }
+
   /// Sets the location where flux moments are to be written.
   void SetDestinationPhi(std::vector<double>& phi) { destination_phi_ = (&phi); }
 
@@ -116,6 +171,7 @@ private:
   std::vector<double>* destination_phi_;
   std::vector<double>* destination_psi_;
   bool surface_source_active_ = false;
+  std::vector<std::shared_ptr<SweepAccumulator>> accumulators_;
 };
 
 } // namespace opensn
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_tallies/boundary_angular_flux_tally.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+
+namespace opensn
+{
+
+BoundaryAngularFluxTally::BoundaryAngularFluxTally(
+  const MeshContinuum& grid,
+  const SpatialDiscretization& discretization,
+  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+  const LBSGroupset& groupset,
+  const std::vector<uint64_t>& boundary_ids)
+  : BoundaryTally(grid, discretization, unit_cell_matrices, groupset, boundary_ids),
+    num_gs_angles_(groupset.quadrature->omegas.size()),
+    slot_psi_(slot_boundaries_.size() * num_gs_angles_ * num_gs_groups_, 0.0)
+{
+}
+
+void
+BoundaryAngularFluxTally::Zero()
+{
+  slot_psi_.assign(slot_psi_.size(), 0.0);
+}
+
+void
+BoundaryAngularFluxTally::Accumulate(const Cell& cell,
+                                     size_t direction_num,
+                                     size_t gs_ss_begin,
+                                     size_t gs_ss_size,
+                                     const std::vector<Vector<double>>& psi)
+{
+  const auto slot_size = num_gs_angles_ * num_gs_groups_;
+  for (const auto& boundary_face : cell_boundary_faces_[cell.local_id])
+  {
+    double* face_psi = &slot_psi_[boundary_face.slot * slot_size +
+                                  direction_num * num_gs_groups_ + gs_ss_begin];
+    for (const auto& [i, int_f_shape_i] : boundary_face.node_weights)
+      for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+        face_psi[gsg] += int_f_shape_i * psi[gsg](i);
+  }
+}
+
+std::vector<double>
+BoundaryAngularFluxTally::GetAngularFlux(uint64_t boundary_id) const
+{
+  const auto slot_size = num_gs_angles_ * num_gs_groups_;
+  const auto global_psi = ReduceSlots(slot_psi_, slot_size);
+
+  const auto offset = BoundaryIndex(boundary_id) * slot_size;
+  return {global_psi.begin() + offset, global_psi.begin() + offset + slot_size};
+}
+
+} // namespace opensn
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_tallies/boundary_tally.h"
+
+namespace opensn
+{
+
+/**
+ * Tallies the surface integral of the angular flux over a set of boundaries during the sweep of
+ * a groupset, for every direction and group of the groupset. Directional currents and responses
+ * through the boundaries follow from these integrals without storing the angular flux.
+ */
+class BoundaryAngularFluxTally : public BoundaryTally
+{
+public:
+  BoundaryAngularFluxTally(const MeshContinuum& grid,
+                           const SpatialDiscretization& discretization,
+                           const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                           const LBSGroupset& groupset,
+                           const std::vector<uint64_t>& boundary_ids);
+
+  void Zero() override;
+
+  void Accumulate(const Cell& cell,
+                  size_t direction_num,
+                  size_t gs_ss_begin,
+                  size_t gs_ss_size,
+                  const std::vector<Vector<double>>& psi) override;
+
+  /**
+   * Returns the surface integral of the angular flux of the last sweep over the given boundary.
+   * The value for direction `n` and groupset group `gsg` is at index `n * G + gsg`, where `G` is
+   * the number of groups of the groupset. This is a collective operation.
+   */
+  std::vector<double> GetAngularFlux(uint64_t boundary_id) const;
+
+private:
+  const size_t num_gs_angles_;
+  /// The integrals of each slot, with one value per groupset direction and group.
+  std::vector<double> slot_psi_;
+};
+
+} // namespace opensn
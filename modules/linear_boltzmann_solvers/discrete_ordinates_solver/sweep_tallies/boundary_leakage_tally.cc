@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_tallies/boundary_leakage_tally.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+
+namespace opensn
+{
+
+BoundaryLeakageTally::BoundaryLeakageTally(const MeshContinuum& grid,
+                                           const SpatialDiscretization& discretization,
+                                           const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                                           const LBSGroupset& groupset,
+                                           const std::vector<uint64_t>& boundary_ids)
+  : BoundaryTally(grid, discretization, unit_cell_matrices, groupset, boundary_ids),
+    slot_leakage_(slot_boundaries_.size() * num_gs_groups_, 0.0)
+{
+}
+
+void
+BoundaryLeakageTally::Zero()
+{
+  slot_leakage_.assign(slot_leakage_.size(), 0.0);
+}
+
+void
+BoundaryLeakageTally::Accumulate(const Cell& cell,
+                                 size_t direction_num,
+                                 size_t gs_ss_begin,
+                                 size_t gs_ss_size,
+                                 const std::vector<Vector<double>>& psi)
+{
+  const auto& omega = groupset_.quadrature->omegas[direction_num];
+  const auto weight = groupset_.quadrature->weights[direction_num];
+
+  for (const auto& boundary_face : cell_boundary_faces_[cell.local_id])
+  {
+    const auto mu = omega.Dot(cell.faces[boundary_face.face_index].normal);
+    if (mu <= 0.0)
+      continue;
+
+    double* leakage = &slot_leakage_[boundary_face.slot * num_gs_groups_ + gs_ss_begin];
+    for (const auto& [i, int_f_shape_i] : boundary_face.node_weights)
+    {
+      const auto coeff = weight * mu * int_f_shape_i;
+      for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+        leakage[gsg] += coeff * psi[gsg](i);
+    }
+  }
+}
+
+std::map<uint64_t, std::vector<double>>
+BoundaryLeakageTally::GetLeakage(const std::vector<uint64_t>& boundary_ids) const
+{
+  const auto global_leakage = ReduceSlots(slot_leakage_, num_gs_groups_);
+
+  std::map<uint64_t, std::vector<double>> leakage;
+  for (const auto& bid : boundary_ids)
+  {
+    const auto offset = BoundaryIndex(bid) * num_gs_groups_;
+    leakage[bid].assign(global_leakage.begin() + offset,
+                        global_leakage.begin() + offset + num_gs_groups_);
+  }
+  return leakage;
+}
+
+} // namespace opensn
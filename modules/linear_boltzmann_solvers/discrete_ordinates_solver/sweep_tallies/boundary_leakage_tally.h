@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_tallies/boundary_tally.h"
+#include <map>
+
+namespace opensn
+{
+
+/**
+ * Tallies the group-wise leakage, i.e. the outgoing partial current, through a set of boundaries
+ * during the sweep of a groupset.
+ */
+class BoundaryLeakageTally : public BoundaryTally
+{
+public:
+  BoundaryLeakageTally(const MeshContinuum& grid,
+                       const SpatialDiscretization& discretization,
+                       const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                       const LBSGroupset& groupset,
+                       const std::vector<uint64_t>& boundary_ids);
+
+  void Zero() override;
+
+  void Accumulate(const Cell& cell,
+                  size_t direction_num,
+                  size_t gs_ss_begin,
+                  size_t gs_ss_size,
+                  const std::vector<Vector<double>>& psi) override;
+
+  /**
+   * Returns the leakage of the last sweep through each of the given boundaries, with one value
+   * per group of the groupset. This is a collective operation.
+   */
+  std::map<uint64_t, std::vector<double>>
+  GetLeakage(const std::vector<uint64_t>& boundary_ids) const;
+
+private:
+  /// The leakage of each slot, with one value per groupset group.
+  std::vector<double> slot_leakage_;
+};
+
+} // namespace opensn
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_tallies/boundary_tally.h"
+#include "framework/math/spatial_discretization/spatial_discretization.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/runtime.h"
+#include <algorithm>
+
+namespace opensn
+{
+
+BoundaryTally::BoundaryTally(const MeshContinuum& grid,
+                             const SpatialDiscretization& discretization,
+                             const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                             const LBSGroupset& groupset,
+                             const std::vector<uint64_t>& boundary_ids)
+  : groupset_(groupset), num_gs_groups_(groupset.groups.size()), boundary_ids_(boundary_ids)
+{
+  cell_boundary_faces_.assign(grid.local_cells.size(), {});
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& cell_mapping = discretization.GetCellMapping(cell);
+    const auto& fe_values = unit_cell_matrices[cell.local_id];
+
+    for (unsigned int f = 0; f < cell.faces.size(); ++f)
+    {
+      const auto& face = cell.faces[f];
+      if (face.has_neighbor)
+        continue;
+      const auto it = std::find(boundary_ids_.begin(), boundary_ids_.end(), face.neighbor_id);
+      if (it == boundary_ids_.end())
+        continue;
+
+      BoundaryFace boundary_face{f, slot_boundaries_.size(), {}};
+      const auto& int_f_shape_i = fe_values.intS_shapeI[f];
+      for (size_t fi = 0; fi < cell_mapping.NumFaceNodes(f); ++fi)
+      {
+        const auto i = cell_mapping.MapFaceNode(f, fi);
+        boundary_face.node_weights.emplace_back(i, int_f_shape_i(i));
+      }
+
+      slot_boundaries_.push_back(std::distance(boundary_ids_.begin(), it));
+      cell_boundary_faces_[cell.local_id].push_back(std::move(boundary_face));
+    }
+  }
+}
+
+size_t
+BoundaryTally::BoundaryIndex(uint64_t boundary_id) const
+{
+  const auto it = std::find(boundary_ids_.begin(), boundary_ids_.end(), boundary_id);
+  OpenSnInvalidArgumentIf(it == boundary_ids_.end(),
+                          "Boundary ID " + std::to_string(boundary_id) + " is not tallied.");
+  return std::distance(boundary_ids_.begin(), it);
+}
+
+std::vector<double>
+BoundaryTally::ReduceSlots(const std::vector<double>& slot_values, size_t slot_size) const
+{
+  std::vector<double> local_values(boundary_ids_.size() * slot_size, 0.0);
+  for (size_t s = 0; s < slot_boundaries_.size(); ++s)
+  {
+    double* boundary_values = &local_values[slot_boundaries_[s] * slot_size];
+    const double* values = &slot_values[s * slot_size];
+    for (size_t k = 0; k < slot_size; ++k)
+      boundary_values[k] += values[k];
+  }
+
+  std::vector<double> global_values(local_values.size(), 0.0);
+  mpi_comm.all_reduce(
+    local_values.data(), local_values.size(), global_values.data(), mpi::op::sum<double>());
+  return global_values;
+}
+
+} // namespace opensn
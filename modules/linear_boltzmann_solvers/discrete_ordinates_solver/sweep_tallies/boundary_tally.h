@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
+
+namespace opensn
+{
+
+/**
+ * Base class for sweep tallies of surface integrals of the angular flux over boundary faces.
+ * Every local face on one of the tallied boundaries gets its own tally slot, so that the cells of
+ * a sweep level can be accumulated concurrently. The slots are only summed when the tally is
+ * queried.
+ */
+class BoundaryTally : public SweepAccumulator
+{
+protected:
+  /// A local boundary face and the surface integrals of the shape functions of its nodes.
+  struct BoundaryFace
+  {
+    unsigned int face_index;
+    size_t slot;
+    std::vector<std::pair<int, double>> node_weights;
+  };
+
+  /**
+   * Finds the local faces on the given boundaries.
+   *
+   * \param grid The mesh of the solver.
+   * \param discretization The spatial discretization of the solver.
+   * \param unit_cell_matrices The integrals of the shape functions of every local cell.
+   * \param groupset The groupset whose sweep is tallied.
+   * \param boundary_ids The ids of the boundaries to tally.
+   */
+  BoundaryTally(const MeshContinuum& grid,
+                const SpatialDiscretization& discretization,
+                const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                const LBSGroupset& groupset,
+                const std::vector<uint64_t>& boundary_ids);
+
+  /// Returns the index of a boundary id in the list of tallied boundaries.
+  size_t BoundaryIndex(uint64_t boundary_id) const;
+
+  /**
+   * Sums the slot values of every boundary over the local faces and over all processes. Each
+   * slot holds `slot_size` values. The result holds `slot_size` values per tallied boundary.
+   */
+  std::vector<double> ReduceSlots(const std::vector<double>& slot_values, size_t slot_size) const;
+
+  const LBSGroupset& groupset_;
+  const size_t num_gs_groups_;
+  const std::vector<uint64_t> boundary_ids_;
+  /// The tallied faces of each local cell.
+  std::vector<std::vector<BoundaryFace>> cell_boundary_faces_;
+  /// The index of the boundary of each slot.
+  std::vector<size_t> slot_boundaries_;
+};
+
+} // namespace opensn
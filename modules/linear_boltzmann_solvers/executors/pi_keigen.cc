@@ -4,6 +4,7 @@
 #include "modules/linear_boltzmann_solvers/executors/pi_keigen.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/ags_solver.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_vecops.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/io/lbs_solver_io.h"
 #include "framework/logging/log_exceptions.h"
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
@@ -143,7 +144,10 @@ PowerIterationKEigen::Execute()
   // If restarts are enabled, always write a restart dump upon convergence or
   // when we reach the iteration limit
   if (lbs_solver_.RestartsEnabled())
+  {
     WriteRestartData();
+    lbs_solver_.WaitForRestartData();
+  }
 
   // Print summary
   int total_num_sweeps = 0;
@@ -206,6 +210,34 @@ void
 PowerIterationKEigen::WriteRestartData()
 {
   std::string fbase = lbs_solver_.Options().write_restart_path.string();
+
+  if (lbs_solver_.Options().restart_single_file)
+  {
+    const std::string fname = fbase + ".restart.h5";
+    if (LBSSolverIO::WriteRestartData(lbs_solver_, fname, {{"keff", k_eff_}, {"Fprev", F_prev_}}))
+    {
+      log.Log() << "Successfully wrote restart data to " << fname;
+      lbs_solver_.UpdateLastRestartWriteTime();
+    }
+    else
+      log.Log0Error() << "Failed to write restart data to " << fname;
+    return;
+  }
+
+  // Angular fluxes are only written when they are stored, as in LBSSolver::WriteRestartData
+  static const std::vector<std::vector<double>> no_psi;
+  const auto& psi = lbs_solver_.Options().save_angular_flux ? lbs_solver_.PsiNewLocal() : no_psi;
+
+  if (lbs_solver_.Options().async_restart_write)
+  {
+    lbs_solver_.GetRestartWriter().Write(fbase,
+                                         lbs_solver_.PhiOldLocal(),
+                                         psi,
+                                         {{"keff", k_eff_}, {"Fprev", F_prev_}},
+                                         lbs_solver_.MakeRestartWrittenCallback());
+    return;
+  }
+
   std::string fname = fbase + std::to_string(opensn::mpi_comm.rank()) + ".restart.h5";
 
   // Write data
@@ -218,6 +250,10 @@ PowerIterationKEigen::WriteRestartData()
     location_succeeded = H5WriteDataset1D<double>(file, "phi_old", lbs_solver_.PhiOldLocal()) and
                          H5CreateAttribute<double>(file, "keff", k_eff_) and
                          H5CreateAttribute<double>(file, "Fprev", F_prev_);
+    for (size_t gs = 0; gs < psi.size(); ++gs)
+      location_succeeded =
+        H5WriteDataset1D<double>(file, "psi_groupset_" + std::to_string(gs), psi[gs]) and
+        location_succeeded;
     H5Fclose(file);
   }
 
@@ -236,6 +272,19 @@ void
 PowerIterationKEigen::ReadRestartData()
 {
   std::string fbase = lbs_solver_.Options().read_restart_path.string();
+
+  if (lbs_solver_.Options().restart_single_file)
+  {
+    const std::string fname = fbase + ".restart.h5";
+    std::map<std::string, double> attributes{{"keff", 0.0}, {"Fprev", 0.0}};
+    if (not LBSSolverIO::ReadRestartData(lbs_solver_, fname, attributes))
+      throw std::invalid_argument("Failed to read restart data from " + fname);
+    k_eff_ = attributes.at("keff");
+    F_prev_ = attributes.at("Fprev");
+    log.Log() << "Successfully read restart data from " << fname;
+    return;
+  }
+
   std::string fname = fbase + std::to_string(opensn::mpi_comm.rank()) + ".restart.h5";
 
   bool location_succeeded = true;
@@ -250,6 +299,16 @@ PowerIterationKEigen::ReadRestartData()
     location_succeeded = (not phi_old_local.empty()) and
                          H5ReadAttribute<double>(file, "keff", k_eff_) and
                          H5ReadAttribute<double>(file, "Fprev", F_prev_);
+    if (lbs_solver_.Options().save_angular_flux)
+    {
+      auto& psi = lbs_solver_.PsiNewLocal();
+      for (size_t gs = 0; gs < psi.size(); ++gs)
+      {
+        const auto name = "psi_groupset_" + std::to_string(gs);
+        if (H5Has(file, name))
+          psi[gs] = H5ReadDataset1D<double>(file, name);
+      }
+    }
     H5Fclose(file);
   }
 
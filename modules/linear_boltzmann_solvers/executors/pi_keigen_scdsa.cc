@@ -137,6 +137,9 @@ PowerIterationKEigenSCDSA::Initialize()
   }
 
   auto& ds = diffusion_solver_;
+  ds->SetCellXS(PackGroupsetXS(lbs_solver_.GetCellTemperatureXSMap(),
+                               front_gs_.groups.front().id,
+                               front_gs_.groups.back().id));
   ds->options.residual_tolerance = diff_accel_diffusion_l_abs_tol_;
   ds->options.max_iters = diff_accel_diffusion_max_iters_;
   ds->options.verbose = diff_accel_diffusion_verbose_;
@@ -477,8 +480,9 @@ PowerIterationKEigenSCDSA::NodallyAveragedPWLDVector(
   const auto& vgc = ghost_info.vector_ghost_communicator;
   const auto& dfem_dof_global2local_map = ghost_info.ghost_global_id_2_local_map;
 
+  // The ghost exchange overlaps the local cell work, which only needs the input vector
   auto input_with_ghosts = vgc->MakeGhostedVector(input);
-  vgc->CommunicateGhostEntries(input_with_ghosts);
+  vgc->BeginGhostExchange(input_with_ghosts);
 
   const auto& grid = pwld_sdm.Grid();
 
@@ -526,6 +530,8 @@ PowerIterationKEigenSCDSA::NodallyAveragedPWLDVector(
             partition_bndry_vertex_id_set.insert(vid);
   } // for local cell
 
+  vgc->EndGhostExchange(input_with_ghosts);
+
   // Ghost cells
   const auto ghost_cell_ids = grid.cells.GetGhostGlobalIDs();
   const auto& vid_set = partition_bndry_vertex_id_set;
@@ -3,6 +3,7 @@
 
 #include "modules/linear_boltzmann_solvers/executors/pi_keigen_smm.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/lbs_discrete_ordinates_solver.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/iterative_methods/sweep_wgs_context.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/ags_solver.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_context.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion_mip_solver.h"
@@ -69,7 +70,6 @@ PowerIterationKEigenSMM::GetInputParameters()
 PowerIterationKEigenSMM::PowerIterationKEigenSMM(const InputParameters& params)
   : PowerIterationKEigen(params),
     dimension_(0),
-    psi_new_local_(lbs_solver_.PsiNewLocal()),
     accel_pi_max_its_(params.GetParamValue<unsigned int>("accel_pi_max_its")),
     accel_pi_k_tol_(params.GetParamValue<double>("accel_pi_k_tol")),
     accel_pi_verbose_(params.GetParamValue<bool>("accel_pi_verbose")),
@@ -80,7 +80,6 @@ PowerIterationKEigenSMM::PowerIterationKEigenSMM(const InputParameters& params)
     diffusion_verbose_(params.GetParamValue<bool>("diff_verbose"))
 {
   ghosts_required_ = diffusion_sdm_name_ == "pwlc";
-  lbs_solver_.Options().save_angular_flux = true;
   if (lbs_solver_.Groupsets().size() != 1)
     throw std::logic_error("The SMM k-eigenvalue executor is only implemented for "
                            "problems with a single groupset.");
@@ -129,6 +128,31 @@ PowerIterationKEigenSMM::Initialize()
   const auto ghost_ids = MakePWLDGhostIndices(pwld, tensor_uk_man_);
   tensors_ = std::make_unique<GhostedParallelSTLVector>(
     local_size, global_size, ghost_ids, opensn::mpi_comm);
+  local_tensors_.assign(local_size, 0.0);
+
+  // Find the boundary nodes whose closures are accumulated
+  closure_face_nodes_.assign(grid.local_cells.size(), {});
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& cell_mapping = pwld.GetCellMapping(cell);
+
+    std::map<int, int> node_faces;
+    for (int f = 0; f < cell.faces.size(); ++f)
+      if (not cell.faces[f].has_neighbor)
+        for (int fi = 0; fi < cell_mapping.NumFaceNodes(f); ++fi)
+          node_faces[cell_mapping.MapFaceNode(f, fi)] = f;
+
+    for (const auto& [i, f] : node_faces)
+    {
+      closure_face_nodes_[cell.local_id].emplace_back(i, f);
+      betas_[pwld.MapDOFLocal(cell, i)].assign(num_groups, 0.0);
+    }
+  }
+
+  // The closures are accumulated by the sweep instead of being computed from a stored psi
+  auto sweep_context = std::dynamic_pointer_cast<SweepWGSContext>(front_wgs_context_);
+  OpenSnLogicalErrorIf(not sweep_context, "The SMM k-eigenvalue executor requires a sweep.");
+  sweep_context->sweep_chunk->AddAccumulator(std::make_shared<ClosureAccumulator>(*this));
 
   // Create diffusion solver
   UnknownManager diff_uk_man;
@@ -171,6 +195,10 @@ PowerIterationKEigenSMM::Initialize()
                                                         diffusion_verbose_);
   }
 
+  diff_solver->SetCellXS(PackGroupsetXS(lbs_solver_.GetCellTemperatureXSMap(),
+                                        front_gs_.groups.front().id,
+                                        front_gs_.groups.back().id));
+
   diff_solver->options.residual_tolerance = diffusion_l_abs_tol_;
   diff_solver->options.max_iters = diffusion_l_max_its_;
   diff_solver->options.verbose = diffusion_verbose_;
@@ -220,7 +248,7 @@ PowerIterationKEigenSMM::Execute()
     auto phi0_m = phi0;
 
     // Update second-moment method data
-    ComputeClosures(psi_new_local_);
+    ComputeClosures();
     const auto correction = ComputeSourceCorrection();
 
     // Start diffusion power iterations
@@ -326,113 +354,72 @@ PowerIterationKEigenSMM::Execute()
 }
 
 void
-PowerIterationKEigenSMM::ComputeClosures(const std::vector<std::vector<double>>& psi)
+PowerIterationKEigenSMM::ComputeClosures()
 {
-  const auto& grid = lbs_solver_.Grid();
-  const auto& pwld = lbs_solver_.SpatialDiscretization();
-  const auto& transport_views = lbs_solver_.GetCellTransportViews();
+  // Set the ghosted tensor vector with the local tensors, then
+  // communicate the ghosts
+  tensors_->Set(local_tensors_);
+  tensors_->CommunicateGhostEntries();
+}
 
-  // Create a local tensor vector, set it to zero
-  auto local_tensors = tensors_->MakeLocalVector();
-  local_tensors.assign(local_tensors.size(), 0.0);
+void
+PowerIterationKEigenSMM::ClosureAccumulator::Zero()
+{
+  smm_.local_tensors_.assign(smm_.local_tensors_.size(), 0.0);
+  for (auto& [imap, beta] : smm_.betas_)
+    beta.assign(beta.size(), 0.0);
+}
 
-  // Loop over groupsets
-  int gs = 0;
-  for (const auto& groupset : lbs_solver_.Groupsets())
-  {
-    const auto& psi_uk_man = groupset.psi_uk_man_;
-    const auto& quad = groupset.quadrature;
-    const auto num_gs_dirs = quad->omegas.size();
+void
+PowerIterationKEigenSMM::ClosureAccumulator::Accumulate(const Cell& cell,
+                                                        size_t direction_num,
+                                                        size_t gs_ss_begin,
+                                                        size_t gs_ss_size,
+                                                        const std::vector<Vector<double>>& psi)
+{
+  const auto& pwld = smm_.lbs_solver_.SpatialDiscretization();
+  const auto& quad = smm_.front_gs_.quadrature;
+  const auto dimension = smm_.dimension_;
 
-    const auto first_grp = groupset.groups.front().id;
-    const auto num_gs_groups = groupset.groups.size();
+  const auto& omega = quad->omegas[direction_num];
+  const auto wt = quad->weights[direction_num];
+  const auto first_grp = smm_.front_gs_.groups.front().id + gs_ss_begin;
 
-    // Loop over cells
-    for (const auto& cell : grid.local_cells)
+  // Node-wise tensors
+  const auto num_nodes = pwld.GetCellMapping(cell).NumNodes();
+  for (int i = 0; i < num_nodes; ++i)
+  {
+    for (int gsg = 0; gsg < gs_ss_size; ++gsg)
     {
-      const auto& transport_view = transport_views[cell.local_id];
-      const auto& cell_mapping = pwld.GetCellMapping(cell);
+      const auto g = first_grp + gsg;
+      double* T = &smm_.local_tensors_[pwld.MapDOFLocal(cell, i, smm_.tensor_uk_man_, g, 0)];
+      const auto coeff = wt * psi[gsg](i);
 
-      // Compute node-wise, groupset wise tensors
-      for (int i = 0; i < transport_view.NumNodes(); ++i)
+      for (int k = 0; k < dimension; ++k)
       {
-        for (int gsg = 0; gsg < num_gs_groups; ++gsg)
-        {
-          const auto g = first_grp + gsg;
+        const auto dim_idx_k = dimension > 1 ? k : 2;
+        T[k * dimension + k] -= coeff / 3.0;
 
-          // Get the tensor, set it to zero
-          const auto dof_map = pwld.MapDOFLocal(cell, i, tensor_uk_man_, g, 0);
-          double* T = &local_tensors[dof_map];
-
-          // Perform the quad integration
-          for (int d = 0; d < num_gs_dirs; ++d)
-          {
-            const auto& omega = quad->omegas[d];
-            const auto& wt = quad->weights[d];
-
-            const auto psi_dof = pwld.MapDOFLocal(cell, i, psi_uk_man, d, gsg);
-            const auto coeff = wt * psi[gs][psi_dof];
-
-            for (int k = 0; k < dimension_; ++k)
-            {
-              const auto dim_idx_k = dimension_ > 1 ? k : 2;
-              T[k * dimension_ + k] -= coeff / 3.0;
-
-              for (int l = 0; l < dimension_; ++l)
-              {
-                const auto dim_idx_l = dimension_ > 1 ? l : 2;
-                T[k * dimension_ + l] += coeff * omega[dim_idx_k] * omega[dim_idx_l];
-              }
-            }
-          } // for direction d
-        }   // for groupset group gsg
-      }     // for node i
-
-      // Loop over cell faces
-      int f = 0;
-      for (const auto& face : cell.faces)
-      {
-        if (not face.has_neighbor)
+        for (int l = 0; l < dimension; ++l)
         {
-          const auto num_face_nodes = cell_mapping.NumFaceNodes(f);
-          for (int fi = 0; fi < num_face_nodes; ++fi)
-          {
-            const auto i = cell_mapping.MapFaceNode(f, fi);
-            const auto imap = pwld.MapDOFLocal(cell, i);
-            const auto bfac = bndry_factors_[imap][gs];
-
-            // Reset boundary closures
-            betas_[imap].assign(lbs_solver_.NumGroups(), 0.0);
-            auto& beta = betas_[imap];
-
-            // Compute the boundary closure
-            for (int gsg = 0; gsg < num_gs_groups; ++gsg)
-            {
-              const auto g = first_grp + gsg;
-
-              // Perform the quadrature integration
-              for (int d = 0; d < num_gs_dirs; ++d)
-              {
-                const auto& wt = quad->weights[d];
-                const auto& omega = quad->omegas[d];
-                const auto mu = std::fabs(omega.Dot(face.normal));
-
-                const auto psi_dof = pwld.MapDOFLocal(cell, i, psi_uk_man, d, gsg);
-                beta[g] += wt * (mu - bfac) * psi[gs][psi_dof];
-              } // for direction n
-            }   // for groupset group gsg
-          }     // for face node fi
+          const auto dim_idx_l = dimension > 1 ? l : 2;
+          T[k * dimension + l] += coeff * omega[dim_idx_k] * omega[dim_idx_l];
         }
-        ++f;
-      } // for face
-    }   // for cell
-    ++gs;
-  } // for groupset
+      }
+    } // for group subset group gsg
+  }   // for node i
 
-  // Set the ghosted tensor vector with the local tensors, then
-  // communicate the ghosts
-  tensors_->Set(local_tensors);
-  tensors_->CommunicateGhostEntries();
+  // Boundary closures
+  for (const auto& [i, f] : smm_.closure_face_nodes_[cell.local_id])
+  {
+    const auto imap = pwld.MapDOFLocal(cell, i);
+    const auto bfac = smm_.bndry_factors_.at(imap)[0];
+    const auto mu = std::fabs(omega.Dot(cell.faces[f].normal));
+
+    auto& beta = smm_.betas_.at(imap);
+    for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+      beta[first_grp + gsg] += wt * (mu - bfac) * psi[gsg](i);
+  }
 }
 
 std::vector<double>
@@ -440,7 +427,7 @@ PowerIterationKEigenSMM::ComputeSourceCorrection() const
 {
   const auto& grid = lbs_solver_.Grid();
   const auto& pwld = lbs_solver_.SpatialDiscretization();
-  const auto& matid_to_xs_map = lbs_solver_.GetMatID2XSMap();
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
   const auto& unit_cell_matrices = lbs_solver_.GetUnitCellMatrices();
 
   const auto& diff_sd = diffusion_solver_->SpatialDiscretization();
@@ -467,8 +454,8 @@ PowerIterationKEigenSMM::ComputeSourceCorrection() const
     const auto& fe_values = unit_cell_matrices[cell.local_id];
     const auto& K = K_tensor_matrices_[cell.local_id];
 
-    const auto& xs = matid_to_xs_map.at(cell.material_id);
-    const auto& sigma_tr = xs->SigmaTransport();
+    const auto& xs = cell_transport_views[cell.local_id].XS();
+    const auto& sigma_tr = xs.SigmaTransport();
 
     // Volumetric term
     for (int gsg = 0; gsg < num_gs_groups; ++gsg)
@@ -1073,8 +1060,9 @@ PowerIterationKEigenSMM::ComputeNodallyAveragedPWLDVector(const std::vector<doub
   const auto& ghost_comm = ghost_info.vector_ghost_communicator;
   const auto& pwld_global_to_local_map = ghost_info.ghost_global_to_local_map;
 
+  // The ghost exchange overlaps the local cell work, which only needs the unghosted vector
   auto ghosted_pwld_vector = ghost_comm->MakeGhostedVector(pwld_vector);
-  ghost_comm->CommunicateGhostEntries(ghosted_pwld_vector);
+  ghost_comm->BeginGhostExchange(ghosted_pwld_vector);
 
   const auto& grid = pwld.Grid();
   const auto num_local_pwlc_dofs = pwlc.GetNumLocalAndGhostDOFs(uk_man);
@@ -1118,6 +1106,8 @@ PowerIterationKEigenSMM::ComputeNodallyAveragedPWLDVector(const std::vector<doub
             partition_vertex_ids.insert(vertex_id);
   } // for local cell
 
+  ghost_comm->EndGhostExchange(ghosted_pwld_vector);
+
   // Add ghost cell data
   const auto ghost_cell_ids = grid.cells.GetGhostGlobalIDs();
   const auto& pvids = partition_vertex_ids;
@@ -7,6 +7,7 @@
 #include "modules/linear_boltzmann_solvers/executors/pi_keigen.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
 
 namespace opensn
 {
@@ -22,6 +23,27 @@ protected:
     std::map<int64_t, int64_t> ghost_global_to_local_map;
   };
 
+  /**
+   * Accumulates the second moment tensors and the boundary closures from the angular flux of
+   * each cell as it is solved during the sweep, so that the angular flux need not be stored.
+   */
+  class ClosureAccumulator : public SweepAccumulator
+  {
+  public:
+    explicit ClosureAccumulator(PowerIterationKEigenSMM& smm) : smm_(smm) {}
+
+    void Zero() override;
+
+    void Accumulate(const Cell& cell,
+                    size_t direction_num,
+                    size_t gs_ss_begin,
+                    size_t gs_ss_size,
+                    const std::vector<Vector<double>>& psi) override;
+
+  private:
+    PowerIterationKEigenSMM& smm_;
+  };
+
 public:
   static InputParameters GetInputParameters();
   explicit PowerIterationKEigenSMM(const InputParameters& params);
@@ -30,7 +52,8 @@ public:
   void Execute() override;
 
 protected:
-  void ComputeClosures(const std::vector<std::vector<double>>& psi);
+  /// Sets the tensor vector from the closures accumulated in the last sweep.
+  void ComputeClosures();
   std::vector<double> ComputeSourceCorrection() const;
 
   void AssembleDiffusionBCs() const;
@@ -64,13 +87,17 @@ protected:
 
 protected:
   unsigned int dimension_;
-  std::vector<std::vector<double>>& psi_new_local_;
 
   // Second moment closures
   UnknownManager tensor_uk_man_;
   std::shared_ptr<GhostedParallelSTLVector> tensors_;
+  std::vector<double> local_tensors_;
   std::map<uint64_t, std::vector<double>> betas_;
 
+  // Per local cell, the pairs of boundary node and face whose boundary closure is accumulated.
+  // A node on several boundary faces takes its closure from the last one.
+  std::vector<std::vector<std::pair<int, int>>> closure_face_nodes_;
+
   // Quadrature approximated boundary factors per groupset
   std::map<uint64_t, std::vector<double>> bndry_factors_;
 
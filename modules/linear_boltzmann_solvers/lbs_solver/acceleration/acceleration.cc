@@ -31,20 +31,21 @@ TranslateBCs(const std::map<uint64_t, std::shared_ptr<SweepBoundary>>& sweep_bou
   return bcs;
 }
 
-std::map<int, Multigroup_D_and_sigR>
-PackGroupsetXS(const std::map<int, std::shared_ptr<MultiGroupXS>>& matid_to_xs_map,
-               int first_grp_index,
-               int last_group_index)
+namespace
+{
+
+template <typename KEY>
+std::map<KEY, Multigroup_D_and_sigR>
+PackGroupsetXSImpl(const std::map<KEY, std::shared_ptr<MultiGroupXS>>& key_to_xs_map,
+                   int first_grp_index,
+                   int last_group_index)
 {
   const int num_gs_groups = last_group_index - first_grp_index + 1;
   OpenSnInvalidArgumentIf(num_gs_groups < 0, "last_grp_index must be >= first_grp_index");
 
-  std::map<int, Multigroup_D_and_sigR> matid_2_mgxs_map;
-  for (const auto& matid_xs_pair : matid_to_xs_map)
+  std::map<KEY, Multigroup_D_and_sigR> key_2_mgxs_map;
+  for (const auto& [key, xs] : key_to_xs_map)
   {
-    const auto& mat_id = matid_xs_pair.first;
-    const auto& xs = matid_xs_pair.second;
-
     std::vector<double> D(num_gs_groups, 0.0);
     std::vector<double> sigma_r(num_gs_groups, 0.0);
 
@@ -58,10 +59,28 @@ PackGroupsetXS(const std::map<int, std::shared_ptr<MultiGroupXS>>& matid_to_xs_m
       ++g;
     } // for g
 
-    matid_2_mgxs_map.insert(std::make_pair(mat_id, Multigroup_D_and_sigR{D, sigma_r}));
+    key_2_mgxs_map.insert(std::make_pair(key, Multigroup_D_and_sigR{D, sigma_r}));
   }
 
-  return matid_2_mgxs_map;
+  return key_2_mgxs_map;
+}
+
+} // namespace
+
+std::map<int, Multigroup_D_and_sigR>
+PackGroupsetXS(const std::map<int, std::shared_ptr<MultiGroupXS>>& matid_to_xs_map,
+               int first_grp_index,
+               int last_group_index)
+{
+  return PackGroupsetXSImpl(matid_to_xs_map, first_grp_index, last_group_index);
+}
+
+std::map<uint64_t, Multigroup_D_and_sigR>
+PackGroupsetXS(const std::map<uint64_t, std::shared_ptr<MultiGroupXS>>& cell_id_to_xs_map,
+               int first_grp_index,
+               int last_group_index)
+{
+  return PackGroupsetXSImpl(cell_id_to_xs_map, first_grp_index, last_group_index);
 }
 
 } // namespace opensn
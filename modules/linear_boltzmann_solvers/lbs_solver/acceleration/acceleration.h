@@ -80,4 +80,10 @@ PackGroupsetXS(const std::map<int, std::shared_ptr<MultiGroupXS>>& matid_to_xs_m
                int first_grp_index,
                int last_group_index);
 
+/// Makes a packaged set of XSs, suitable for diffusion, for individual cells keyed on global id.
+std::map<uint64_t, Multigroup_D_and_sigR>
+PackGroupsetXS(const std::map<uint64_t, std::shared_ptr<MultiGroupXS>>& cell_id_to_xs_map,
+               int first_grp_index,
+               int last_group_index);
+
 } // namespace opensn
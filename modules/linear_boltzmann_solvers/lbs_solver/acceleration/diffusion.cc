@@ -97,10 +97,86 @@ DiffusionSolver::AddToMatrix(const std::vector<int64_t>& rows,
   if (rows.size() != cols.size() or rows.size() != vals.size())
     throw std::invalid_argument("The number of row entries, column entries, and value "
                                 "entries do not agree.");
-  for (int i = 0; i < vals.size(); ++i)
-    MatSetValue(A_, rows[i], cols[i], vals[i], ADD_VALUES);
-  MatAssemblyBegin(A_, MAT_FLUSH_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FLUSH_ASSEMBLY);
+
+  added_rows_.insert(added_rows_.end(), rows.begin(), rows.end());
+  added_cols_.insert(added_cols_.end(), cols.begin(), cols.end());
+  added_vals_.insert(added_vals_.end(), vals.begin(), vals.end());
+
+  // The added entries change the COO pattern
+  coo_pattern_built_ = false;
+}
+
+void
+DiffusionSolver::BeginMatrixAssembly()
+{
+  if (not coo_pattern_built_)
+  {
+    coo_rows_.clear();
+    coo_cols_.clear();
+  }
+  coo_vals_.clear();
+  coo_vals_.reserve(coo_rows_.size());
+}
+
+void
+DiffusionSolver::AddMatrixBlock(size_t num_rows,
+                                const int64_t* rows,
+                                size_t num_cols,
+                                const int64_t* cols,
+                                const double* vals)
+{
+  if (not coo_pattern_built_)
+    for (size_t i = 0; i < num_rows; ++i)
+      for (size_t j = 0; j < num_cols; ++j)
+      {
+        coo_rows_.push_back(rows[i]);
+        coo_cols_.push_back(cols[j]);
+      }
+  coo_vals_.insert(coo_vals_.end(), vals, vals + num_rows * num_cols);
+}
+
+void
+DiffusionSolver::EndMatrixAssembly()
+{
+  if (not coo_pattern_built_)
+  {
+    coo_rows_.insert(coo_rows_.end(), added_rows_.begin(), added_rows_.end());
+    coo_cols_.insert(coo_cols_.end(), added_cols_.begin(), added_cols_.end());
+  }
+  coo_vals_.insert(coo_vals_.end(), added_vals_.begin(), added_vals_.end());
+
+  if (coo_vals_.size() != coo_rows_.size())
+    throw std::logic_error(name_ + ": The number of matrix entries changed since the first "
+                                   "assembly.");
+
+  // Duplicate (row, col) pairs are summed by MatSetValuesCOO, which also assembles the matrix
+  if (not coo_pattern_built_)
+  {
+    // PETSc may reorder the index arrays it is given
+    auto rows = coo_rows_;
+    auto cols = coo_cols_;
+    MatSetPreallocationCOO(A_, static_cast<PetscCount>(rows.size()), rows.data(), cols.data());
+    coo_pattern_built_ = true;
+  }
+  MatSetValuesCOO(A_, coo_vals_.data(), INSERT_VALUES);
+
+  coo_vals_.clear();
+  coo_vals_.shrink_to_fit();
+}
+
+void
+DiffusionSolver::SetCellXS(std::map<uint64_t, Multigroup_D_and_sigR> cell_id_2_xs_map)
+{
+  cell_id_2_xs_map_ = std::move(cell_id_2_xs_map);
+}
+
+const Multigroup_D_and_sigR&
+DiffusionSolver::GetCellXS(const Cell& cell) const
+{
+  const auto it = cell_id_2_xs_map_.find(cell.global_id);
+  if (it != cell_id_2_xs_map_.end())
+    return it->second;
+  return mat_id_2_xs_map_.at(cell.material_id);
 }
 
 void
@@ -112,18 +188,9 @@ DiffusionSolver::Initialize()
   if (options.verbose)
     log.Log() << name_ << ": Global number of DOFs=" << num_global_dofs_;
 
-  opensn::mpi_comm.barrier();
-  log.Log() << "Sparsity pattern";
-  opensn::mpi_comm.barrier();
-  // Create Matrix
-  std::vector<int64_t> nodal_nnz_in_diag;
-  std::vector<int64_t> nodal_nnz_off_diag;
-  sdm_.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man_);
-  opensn::mpi_comm.barrier();
-  log.Log() << "Done Sparsity pattern";
-  opensn::mpi_comm.barrier();
+  // Create Matrix. It is preallocated from the COO pattern during assembly.
   A_ = CreateSquareMatrix(num_local_dofs_, num_global_dofs_);
-  InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
+  coo_pattern_built_ = false;
   opensn::mpi_comm.barrier();
   log.Log() << "Done matrix creation";
   opensn::mpi_comm.barrier();
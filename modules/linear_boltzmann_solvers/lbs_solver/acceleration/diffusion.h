@@ -30,6 +30,8 @@ protected:
   const std::map<uint64_t, BoundaryCondition> bcs_;
 
   const MatID2XSMap mat_id_2_xs_map_;
+  /// Cross sections of individual cells, keyed on global cell id, overriding the material ones
+  std::map<uint64_t, Multigroup_D_and_sigR> cell_id_2_xs_map_;
 
   const std::vector<UnitCellMatrices>& unit_cell_matrices_;
 
@@ -40,6 +42,18 @@ protected:
   Vec rhs_ = nullptr;
   KSP ksp_ = nullptr;
 
+  /// COO row and column indices of the matrix entries. These are built on the first assembly;
+  /// later assemblies only update the values.
+  std::vector<int64_t> coo_rows_;
+  std::vector<int64_t> coo_cols_;
+  std::vector<double> coo_vals_;
+  bool coo_pattern_built_ = false;
+
+  /// Entries added with AddToMatrix, included in every assembly of the matrix
+  std::vector<int64_t> added_rows_;
+  std::vector<int64_t> added_cols_;
+  std::vector<double> added_vals_;
+
   const bool requires_ghosts_;
   const bool suppress_bcs_;
 
@@ -85,6 +99,13 @@ public:
 
   std::pair<size_t, size_t> GetNumPhiIterativeUnknowns();
 
+  /**
+   * Sets cross sections for individual cells, keyed on global cell id, that take precedence over
+   * the material cross sections. Ghost cells neighboring local cells must be included. This must
+   * be called before the system is assembled.
+   */
+  void SetCellXS(std::map<uint64_t, Multigroup_D_and_sigR> cell_id_2_xs_map);
+
   virtual ~DiffusionSolver();
 
   /**
@@ -103,7 +124,10 @@ public:
   /// Adds to the right-hand side without applying spatial discretization.
   void AddToRHS(const std::vector<double>& values);
 
-  /// Adds to the entries into the matrix without applying spatial discretization.
+  /**
+   * Adds entries to the matrix without applying spatial discretization. The entries are kept and
+   * added every time the matrix is assembled, so this may be called before AssembleAand_b.
+   */
   void AddToMatrix(const std::vector<int64_t>& rows,
                    const std::vector<int64_t>& cols,
                    const std::vector<double>& vals);
@@ -125,6 +149,26 @@ public:
    *                 use the values of the output solution as initial guess.
    */
   void Solve(Vec petsc_solution, bool use_initial_guess = false);
+
+protected:
+  /// Starts collecting the COO values of a matrix assembly.
+  void BeginMatrixAssembly();
+
+  /// Adds a dense, row-major block of values to the matrix being assembled.
+  void AddMatrixBlock(size_t num_rows,
+                      const int64_t* rows,
+                      size_t num_cols,
+                      const int64_t* cols,
+                      const double* vals);
+
+  /**
+   * Sets the collected values in the matrix with a single MatSetValuesCOO call. The COO pattern
+   * is preallocated on the first assembly only.
+   */
+  void EndMatrixAssembly();
+
+  /// Returns the cross sections of a local or ghost cell.
+  const Multigroup_D_and_sigR& GetCellXS(const Cell& cell) const;
 };
 
 } // namespace opensn
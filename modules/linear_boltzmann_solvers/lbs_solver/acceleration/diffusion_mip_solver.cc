@@ -64,7 +64,9 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
   const size_t num_groups = uk_man_.unknowns.front().num_components;
 
   VecSet(rhs_, 0.0);
+  BeginMatrixAssembly();
 
+  std::vector<double> source_qp, ref_solution_qp;
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces.size();
@@ -72,8 +74,10 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
     const size_t num_nodes = cell_mapping.NumNodes();
     const auto cc_nodes = cell_mapping.GetNodeLocations();
     const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+    if (source_function_)
+      source_function_->Evaluate(fe_vol_data.QPointsXYZ(), source_qp);
 
-    const auto& xs = mat_id_2_xs_map_.at(cell.material_id);
+    const auto& xs = GetCellXS(cell);
 
     DenseMatrix<double> cell_A(num_nodes, num_nodes);
     Vector<double> cell_rhs(num_nodes);
@@ -119,8 +123,7 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
         if (source_function_)
         {
           for (size_t qp : fe_vol_data.QuadraturePointIndices())
-            entry_rhs_i += source_function_->Evaluate(fe_vol_data.QPointXYZ(qp)) *
-                           fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
+            entry_rhs_i += source_qp[qp] * fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
         }
 
         cell_rhs(i) += entry_rhs_i;
@@ -144,7 +147,7 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
           const size_t acf = MeshContinuum::MapCellFace(cell, adj_cell, f);
           const double hp = HPerpendicular(adj_cell, acf);
 
-          const auto& adj_xs = mat_id_2_xs_map_.at(adj_cell.material_id);
+          const auto& adj_xs = GetCellXS(adj_cell);
           const double adj_Dg = adj_xs.Dg[g];
 
           // Compute kappa
@@ -225,21 +228,11 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
             } // for j
           }   // for fi
 
-          MatSetValues(A_,
-                       num_nodes,
-                       cell_idxs.data(),
-                       num_face_nodes,
-                       adj_idxs.data(),
-                       adj_A.data(),
-                       ADD_VALUES);
-
-          MatSetValues(A_,
-                       num_face_nodes,
-                       adj_idxs.data(),
-                       num_nodes,
-                       cell_idxs.data(),
-                       adj_AT.data(),
-                       ADD_VALUES);
+          AddMatrixBlock(
+            num_nodes, cell_idxs.data(), num_face_nodes, adj_idxs.data(), adj_A.data());
+
+          AddMatrixBlock(
+            num_face_nodes, adj_idxs.data(), num_nodes, cell_idxs.data(), adj_AT.data());
 
         } // internal face
         else
@@ -252,6 +245,9 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
           {
             const double bc_value = bc.values[0];
 
+            if (ref_solution_function_)
+              ref_solution_function_->Evaluate(fe_srf_data.QPointsXYZ(), ref_solution_qp);
+
             // Compute kappa
             double kappa = 1.0;
             if (cell.Type() == CellType::SLAB)
@@ -280,10 +276,8 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
                 {
                   aij_bc_value = 0.0;
                   for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                    aij_bc_value += kappa *
-                                    ref_solution_function_->Evaluate(fe_srf_data.QPointXYZ(qp)) *
-                                    fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(jm, qp) *
-                                    fe_srf_data.JxW(qp);
+                    aij_bc_value += kappa * ref_solution_qp[qp] * fe_srf_data.ShapeValue(i, qp) *
+                                    fe_srf_data.ShapeValue(jm, qp) * fe_srf_data.JxW(qp);
                 }
 
                 cell_A(i, jm) += aij;
@@ -314,7 +308,7 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
                 {
                   Vector3 vec_aij_mms;
                   for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                    vec_aij_mms += ref_solution_function_->Evaluate(fe_srf_data.QPointXYZ(qp)) *
+                    vec_aij_mms += ref_solution_qp[qp] *
                                    (fe_srf_data.ShapeValue(j, qp) * fe_srf_data.ShapeGrad(i, qp) *
                                       fe_srf_data.JxW(qp) +
                                     fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeGrad(j, qp) *
@@ -371,14 +365,12 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
         }       // boundary face
       }         // for face
 
-      MatSetValues(
-        A_, num_nodes, cell_idxs.data(), num_nodes, cell_idxs.data(), cell_A.data(), ADD_VALUES);
+      AddMatrixBlock(num_nodes, cell_idxs.data(), num_nodes, cell_idxs.data(), cell_A.data());
       VecSetValues(rhs_, num_nodes, cell_idxs.data(), cell_rhs.data(), ADD_VALUES);
     } // for g
   }   // for cell
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  EndMatrixAssembly();
   VecAssemblyBegin(rhs_);
   VecAssemblyEnd(rhs_);
 
@@ -415,15 +407,18 @@ DiffusionMIPSolver::Assemble_b_wQpoints(const std::vector<double>& q_vector)
 
   VecSet(rhs_, 0.0);
 
+  std::vector<double> source_qp, source_srf_qp, ref_solution_qp;
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces.size();
     const auto& cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
     const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
+    if (source_function_)
+      source_function_->Evaluate(fe_vol_data.QPointsXYZ(), source_qp);
     const size_t num_groups = uk_man_.unknowns.front().num_components;
 
-    const auto& xs = mat_id_2_xs_map_.at(cell.material_id);
+    const auto& xs = GetCellXS(cell);
 
     Vector<double> cell_rhs(num_nodes);
     Vector<int64_t> cell_idxs(num_nodes);
@@ -457,8 +452,7 @@ DiffusionMIPSolver::Assemble_b_wQpoints(const std::vector<double>& q_vector)
         else
         {
           for (size_t qp : fe_vol_data.QuadraturePointIndices())
-            entry_rhs_i += source_function_->Evaluate(fe_vol_data.QPointXYZ(qp)) *
-                           fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
+            entry_rhs_i += source_qp[qp] * fe_vol_data.ShapeValue(i, qp) * fe_vol_data.JxW(qp);
         }
 
         cell_rhs(i) += entry_rhs_i;
@@ -484,6 +478,12 @@ DiffusionMIPSolver::Assemble_b_wQpoints(const std::vector<double>& q_vector)
           {
             const double bc_value = bc.values[0];
 
+            if (ref_solution_function_)
+            {
+              source_function_->Evaluate(fe_srf_data.QPointsXYZ(), source_srf_qp);
+              ref_solution_function_->Evaluate(fe_srf_data.QPointsXYZ(), ref_solution_qp);
+            }
+
             // Compute kappa
             double kappa = 1.0;
             if (cell.Type() == CellType::SLAB)
@@ -512,9 +512,8 @@ DiffusionMIPSolver::Assemble_b_wQpoints(const std::vector<double>& q_vector)
                 {
                   aij_bc_value = 0.0;
                   for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                    aij_bc_value += kappa * source_function_->Evaluate(fe_srf_data.QPointXYZ(qp)) *
-                                    fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(jm, qp) *
-                                    fe_srf_data.JxW(qp);
+                    aij_bc_value += kappa * source_srf_qp[qp] * fe_srf_data.ShapeValue(i, qp) *
+                                    fe_srf_data.ShapeValue(jm, qp) * fe_srf_data.JxW(qp);
                 }
 
                 cell_rhs(i) += aij_bc_value;
@@ -544,7 +543,7 @@ DiffusionMIPSolver::Assemble_b_wQpoints(const std::vector<double>& q_vector)
                 {
                   Vector3 vec_aij_mms;
                   for (size_t qp : fe_srf_data.QuadraturePointIndices())
-                    vec_aij_mms += ref_solution_function_->Evaluate(fe_srf_data.QPointXYZ(qp)) *
+                    vec_aij_mms += ref_solution_qp[qp] *
                                    (fe_srf_data.ShapeValue(j, qp) * fe_srf_data.ShapeGrad(i, qp) *
                                       fe_srf_data.JxW(qp) +
                                     fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeGrad(j, qp) *
@@ -614,6 +613,7 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
   const size_t num_groups = uk_man_.unknowns.front().num_components;
 
   VecSet(rhs_, 0.0);
+  BeginMatrixAssembly();
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces.size();
@@ -625,7 +625,7 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
     const auto& intV_gradshapeI_gradshapeJ = unit_cell_matrices.intV_gradshapeI_gradshapeJ;
     const auto& intV_shapeI_shapeJ = unit_cell_matrices.intV_shapeI_shapeJ;
 
-    const auto& xs = mat_id_2_xs_map_.at(cell.material_id);
+    const auto& xs = GetCellXS(cell);
 
     DenseMatrix<double> cell_A(num_nodes, num_nodes);
     Vector<double> cell_rhs(num_nodes);
@@ -683,7 +683,7 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
           const size_t acf = MeshContinuum::MapCellFace(cell, adj_cell, f);
           const double hp = HPerpendicular(adj_cell, acf);
 
-          const auto& adj_xs = mat_id_2_xs_map_.at(adj_cell.material_id);
+          const auto& adj_xs = GetCellXS(adj_cell);
           const double adj_Dg = adj_xs.Dg[g];
 
           // Compute kappa
@@ -753,21 +753,11 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
             } // for j
           }   // for fi
 
-          MatSetValues(A_,
-                       num_nodes,
-                       cell_idxs.data(),
-                       num_face_nodes,
-                       adj_idxs.data(),
-                       adj_A.data(),
-                       ADD_VALUES);
-
-          MatSetValues(A_,
-                       num_face_nodes,
-                       adj_idxs.data(),
-                       num_nodes,
-                       cell_idxs.data(),
-                       adj_AT.data(),
-                       ADD_VALUES);
+          AddMatrixBlock(
+            num_nodes, cell_idxs.data(), num_face_nodes, adj_idxs.data(), adj_A.data());
+
+          AddMatrixBlock(
+            num_face_nodes, adj_idxs.data(), num_nodes, cell_idxs.data(), adj_AT.data());
 
         } // internal face
         else
@@ -860,14 +850,12 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
         }       // boundary face
       }         // for face
 
-      MatSetValues(
-        A_, num_nodes, cell_idxs.data(), num_nodes, cell_idxs.data(), cell_A.data(), ADD_VALUES);
+      AddMatrixBlock(num_nodes, cell_idxs.data(), num_nodes, cell_idxs.data(), cell_A.data());
       VecSetValues(rhs_, num_nodes, cell_idxs.data(), cell_rhs.data(), ADD_VALUES);
     } // for g
   }   // for cell
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  EndMatrixAssembly();
   VecAssemblyBegin(rhs_);
   VecAssemblyEnd(rhs_);
 
@@ -926,7 +914,7 @@ DiffusionMIPSolver::Assemble_b(const std::vector<double>& q_vector)
 
     const auto& intV_shapeI_shapeJ = unit_cell_matrices.intV_shapeI_shapeJ;
 
-    const auto& xs = mat_id_2_xs_map_.at(cell.material_id);
+    const auto& xs = GetCellXS(cell);
 
     Vector<double> cell_rhs(num_nodes);
     Vector<int64_t> cell_idxs(num_nodes);
@@ -1079,7 +1067,7 @@ DiffusionMIPSolver::Assemble_b(Vec petsc_q_vector)
 
     const auto& intV_shapeI_shapeJ = unit_cell_matrices.intV_shapeI_shapeJ;
 
-    const auto& xs = mat_id_2_xs_map_.at(cell.material_id);
+    const auto& xs = GetCellXS(cell);
 
     Vector<double> cell_rhs(num_nodes);
     Vector<int64_t> cell_idxs(num_nodes);
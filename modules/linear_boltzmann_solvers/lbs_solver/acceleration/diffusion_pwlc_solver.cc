@@ -55,6 +55,7 @@ DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
   const size_t num_groups = uk_man_.unknowns.front().num_components;
 
   VecSet(rhs_, 0.0);
+  BeginMatrixAssembly();
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces.size();
@@ -66,7 +67,7 @@ DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
     const auto& intV_gradshapeI_gradshapeJ = unit_cell_matrices.intV_gradshapeI_gradshapeJ;
     const auto& intV_shapeI_shapeJ = unit_cell_matrices.intV_shapeI_shapeJ;
 
-    const auto& xs = mat_id_2_xs_map_.at(cell.material_id);
+    const auto& xs = GetCellXS(cell);
 
     // Mark dirichlet nodes
     std::vector<std::pair<bool, double>> node_is_dirichlet(num_nodes, {false, 0.0});
@@ -198,14 +199,12 @@ DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
         }       // boundary face
       }         // for face
 
-      MatSetValues(
-        A_, num_nodes, cell_idxs.data(), num_nodes, cell_idxs.data(), cell_A.data(), ADD_VALUES);
+      AddMatrixBlock(num_nodes, cell_idxs.data(), num_nodes, cell_idxs.data(), cell_A.data());
       VecSetValues(rhs_, num_nodes, cell_idxs.data(), cell_rhs.data(), ADD_VALUES);
     } // for g
   }   // for cell
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  EndMatrixAssembly();
   VecAssemblyBegin(rhs_);
   VecAssemblyEnd(rhs_);
 
@@ -271,7 +270,7 @@ DiffusionPWLCSolver::Assemble_b(const std::vector<double>& q_vector)
     const auto& intV_shapeI_shapeJ = unit_cell_matrices.intV_shapeI_shapeJ;
     const auto& intV_shapeI = unit_cell_matrices.intV_shapeI;
 
-    const auto& xs = mat_id_2_xs_map_.at(cell.material_id);
+    const auto& xs = GetCellXS(cell);
 
     // Mark dirichlet nodes
     std::vector<std::pair<bool, double>> node_is_dirichlet(num_nodes, {false, 0.0});
@@ -61,6 +61,8 @@ public:
   struct TwoGridAccelerationInfo
   {
     std::map<int, TwoGridCollapsedInfo> map_mat_id_2_tginfo;
+    /// Collapsed info of the cross sections evaluated at cell temperatures
+    std::map<const MultiGroupXS*, TwoGridCollapsedInfo> map_xs_2_tginfo;
     EnergyCollapseScheme scheme = EnergyCollapseScheme::JFULL;
   } tg_acceleration_info_;
 
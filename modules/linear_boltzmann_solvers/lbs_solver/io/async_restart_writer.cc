@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/io/async_restart_writer.h"
+#include "framework/logging/log.h"
+#include "framework/utils/hdf_utils.h"
+#include "framework/runtime.h"
+#include "caliper/cali.h"
+
+namespace opensn
+{
+
+namespace
+{
+
+/// Returns true if the HDF5 library may be called from more than one thread.
+bool
+HDF5IsThreadSafe()
+{
+  static const bool thread_safe = []
+  {
+    hbool_t is_thread_safe = false;
+    return H5is_library_threadsafe(&is_thread_safe) >= 0 and is_thread_safe;
+  }();
+  return thread_safe;
+}
+
+} // namespace
+
+AsyncRestartWriter::~AsyncRestartWriter()
+{
+  if (pending_.valid())
+    pending_.wait();
+}
+
+void
+AsyncRestartWriter::Write(const std::string& file_base,
+                          const std::vector<double>& phi,
+                          const std::vector<std::vector<double>>& psi,
+                          const std::map<std::string, double>& attributes,
+                          std::function<void()> on_written)
+{
+  CALI_CXX_MARK_SCOPE("AsyncRestartWriter::Write");
+
+  // Stage the data in the buffer that is not being written. Assigning into the existing vectors
+  // reuses their storage after the first checkpoint.
+  auto& snapshot = buffers_[next_buffer_];
+  snapshot.file_name = file_base + std::to_string(opensn::mpi_comm.rank()) + ".restart.h5";
+  snapshot.phi.assign(phi.begin(), phi.end());
+  snapshot.psi.resize(psi.size());
+  for (size_t gs = 0; gs < psi.size(); ++gs)
+    snapshot.psi[gs].assign(psi[gs].begin(), psi[gs].end());
+  snapshot.attributes = attributes;
+
+  // Only one write may be in flight
+  Wait();
+
+  if (HDF5IsThreadSafe())
+    pending_ =
+      std::async(std::launch::async, &AsyncRestartWriter::WriteSnapshot, std::cref(snapshot));
+  else
+  {
+    // The main thread may call HDF5 while the write is in flight, which a library that is not
+    // thread-safe does not allow
+    if (not warned_not_thread_safe_)
+    {
+      log.Log0Warning() << "HDF5 is not built thread-safe. Asynchronous restart files are "
+                           "written on the calling thread.";
+      warned_not_thread_safe_ = true;
+    }
+    std::promise<bool> written;
+    written.set_value(WriteSnapshot(snapshot));
+    pending_ = written.get_future();
+  }
+  pending_file_base_ = file_base;
+  pending_on_written_ = std::move(on_written);
+  next_buffer_ = 1 - next_buffer_;
+}
+
+bool
+AsyncRestartWriter::Wait()
+{
+  if (not pending_.valid())
+    return true;
+
+  CALI_CXX_MARK_SCOPE("AsyncRestartWriter::Wait");
+
+  const bool location_succeeded = pending_.get();
+
+  bool global_succeeded = true;
+  mpi_comm.all_reduce(location_succeeded, global_succeeded, mpi::op::logical_and<bool>());
+  if (global_succeeded)
+  {
+    log.Log() << "Successfully wrote restart data to " << pending_file_base_ << "X.restart.h5";
+    if (pending_on_written_)
+      pending_on_written_();
+  }
+  else
+    log.Log0Error() << "Failed to write restart data to " << pending_file_base_ << "X.restart.h5";
+  pending_on_written_ = nullptr;
+
+  return global_succeeded;
+}
+
+bool
+AsyncRestartWriter::Ready() const
+{
+  return pending_.valid() and
+         pending_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+bool
+AsyncRestartWriter::WriteSnapshot(const Snapshot& snapshot)
+{
+  hid_t file = H5Fcreate(snapshot.file_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  if (file < 0)
+    return false;
+
+  bool succeeded = H5WriteDataset1D<double>(file, "phi_old", snapshot.phi);
+  for (size_t gs = 0; gs < snapshot.psi.size(); ++gs)
+    succeeded = H5WriteDataset1D<double>(
+                  file, "psi_groupset_" + std::to_string(gs), snapshot.psi[gs]) and
+                succeeded;
+  for (const auto& [name, value] : snapshot.attributes)
+  {
+    double attribute_value = value;
+    succeeded = H5CreateAttribute<double>(file, name, attribute_value) and succeeded;
+  }
+
+  return H5Fclose(file) >= 0 and succeeded;
+}
+
+} // namespace opensn
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <future>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace opensn
+{
+
+/**
+ * Writes per-process restart files on a background thread so that the solver can keep iterating
+ * while the file is written.
+ *
+ * Write copies the restart data into one of two staging buffers and returns. Because the buffers
+ * alternate, the copy for a new checkpoint overlaps with the write of the previous one, and a
+ * checkpoint only blocks if the previous write is still in progress. The background thread only
+ * does HDF5 I/O on the staged copy; all MPI communication stays on the calling thread.
+ *
+ * HDF5 may only be called from several threads if it was built thread-safe. With any other build
+ * the staged copy is written on the calling thread instead, so the solver does not overlap with
+ * the write but the interface and its outcome reporting are unchanged.
+ */
+class AsyncRestartWriter
+{
+public:
+  AsyncRestartWriter() = default;
+  AsyncRestartWriter(const AsyncRestartWriter&) = delete;
+  AsyncRestartWriter& operator=(const AsyncRestartWriter&) = delete;
+
+  /// Waits for a pending write, without communicating, so that no write outlives the writer.
+  ~AsyncRestartWriter();
+
+  /**
+   * Stages the restart data and starts writing it to `<file_base><rank>.restart.h5`. If a previous
+   * write is still in progress, this waits for it and reports its outcome first. Collective.
+   *
+   * \param file_base File name stem
+   * \param phi Flux moments, written as `phi_old`
+   * \param psi Angular fluxes per groupset, written as `psi_groupset_<id>` (may be empty)
+   * \param attributes Scalar attributes to store in the file
+   * \param on_written Called by Wait once the write has succeeded on all processes
+   */
+  void Write(const std::string& file_base,
+             const std::vector<double>& phi,
+             const std::vector<std::vector<double>>& psi,
+             const std::map<std::string, double>& attributes = {},
+             std::function<void()> on_written = {});
+
+  /**
+   * Waits for the pending write, if any, and returns true if it succeeded on all processes. The
+   * write's `on_written` callback is invoked on success. Collective.
+   */
+  bool Wait();
+
+  /// Returns true if a write has been started and not yet waited for.
+  bool Pending() const { return pending_.valid(); }
+
+  /// Returns true if the pending write has finished on this process, so that Wait will not block.
+  bool Ready() const;
+
+private:
+  struct Snapshot
+  {
+    std::string file_name;
+    std::vector<double> phi;
+    std::vector<std::vector<double>> psi;
+    std::map<std::string, double> attributes;
+  };
+
+  /// Writes a staged snapshot. Runs on the background thread.
+  static bool WriteSnapshot(const Snapshot& snapshot);
+
+  std::array<Snapshot, 2> buffers_;
+  /// Index of the buffer that the next checkpoint is staged in
+  size_t next_buffer_ = 0;
+  bool warned_not_thread_safe_ = false;
+  std::future<bool> pending_;
+  std::string pending_file_base_;
+  std::function<void()> pending_on_written_;
+};
+
+} // namespace opensn
@@ -7,6 +7,7 @@
 #include <optional>
 #include <vector>
 #include <functional>
+#include <map>
 
 namespace opensn
 {
@@ -95,6 +96,33 @@ public:
     const std::string& file_stem,
     bool single_file,
     std::optional<std::reference_wrapper<std::vector<double>>> opt_dest = std::nullopt);
+
+  /**
+   * Collectively write restart data to a single file using parallel HDF5. The flux moments, the
+   * angular fluxes (if they are stored) and the precursors are stored by global cell id and cell
+   * node, independent of the partitioning, so that the file can be read on any number of
+   * processes. Returns true if all processes succeeded.
+   *
+   * \param lbs_solver LBS solver
+   * \param file_name Restart file name
+   * \param attributes Additional scalar attributes to store in the file
+   */
+  static bool WriteRestartData(LBSSolver& lbs_solver,
+                               const std::string& file_name,
+                               const std::map<std::string, double>& attributes = {});
+
+  /**
+   * Collectively read restart data written by WriteRestartData, redistributing it to the current
+   * partitioning. Returns true if all processes succeeded.
+   *
+   * \param lbs_solver LBS solver
+   * \param file_name Restart file name
+   * \param attributes Additional scalar attributes to read from the file. The keys of the map
+   *        select the attributes to read.
+   */
+  static bool ReadRestartData(LBSSolver& lbs_solver,
+                              const std::string& file_name,
+                              std::map<std::string, double>& attributes);
 };
 
 } // namespace opensn
@@ -0,0 +1,658 @@
+// SPDX-FileCopyrightText: 2024 The OpenSn Authors <https://open-sn.github.io/opensn/>
+// SPDX-License-Identifier: MIT
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/io/lbs_solver_io.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mpi/mpi_utils.h"
+#include "framework/utils/hdf_utils.h"
+#include <algorithm>
+
+namespace opensn
+{
+
+#ifdef H5_HAVE_PARALLEL
+namespace
+{
+
+/**
+ * Restart file layout. All data is ordered by global cell id, and within a cell by cell node, so
+ * that it does not depend on the partitioning:
+ * - `cell_node_offsets` [num_cells + 1]: first node row of each cell.
+ * - `phi` [num_nodes, num_moments * num_groups]
+ * - `psi/groupset_<id>` [num_nodes, num_directions * num_groupset_groups]
+ * - `precursors` [num_cells, max_precursors_per_material]
+ */
+
+/// A range of `second` contiguous rows of a dataset starting at row `first`.
+using RowRun = std::pair<hsize_t, hsize_t>;
+
+/// Chunks hold approximately this many bytes.
+constexpr size_t RESTART_CHUNK_BYTES = 1 << 20;
+
+/// Appends a range of rows to a list of runs, merging it with the last run when contiguous.
+void
+AppendRowRun(std::vector<RowRun>& runs, hsize_t first, hsize_t num_rows)
+{
+  if (num_rows == 0)
+    return;
+  if (not runs.empty() and runs.back().first + runs.back().second == first)
+    runs.back().second += num_rows;
+  else
+    runs.emplace_back(first, num_rows);
+}
+
+/// Selects the union of the given runs of rows in a dataspace of rank 1 or 2.
+void
+SelectRowRuns(hid_t space, const std::vector<RowRun>& runs)
+{
+  hsize_t dims[2] = {0, 1};
+  H5Sget_simple_extent_dims(space, dims, nullptr);
+
+  H5Sselect_none(space);
+  for (const auto& [first, num_rows] : runs)
+  {
+    const hsize_t start[2] = {first, 0};
+    const hsize_t count[2] = {num_rows, dims[1]};
+    H5Sselect_hyperslab(space, H5S_SELECT_OR, start, nullptr, count, nullptr);
+  }
+}
+
+/// Returns true on all processes if `local_succeeded` is true on all processes. Collective.
+bool
+AllSucceeded(bool local_succeeded)
+{
+  bool global_succeeded = false;
+  mpi_comm.all_reduce(local_succeeded, global_succeeded, mpi::op::logical_and<bool>());
+  return global_succeeded;
+}
+
+/// Makes a transfer property list for collective MPI-IO.
+hid_t
+MakeCollectiveTransferList()
+{
+  hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+  return dxpl;
+}
+
+/**
+ * Collectively creates a chunked, optionally compressed, dataset and writes the given runs of rows
+ * from each process. The values of each process must be ordered by row.
+ */
+template <typename T>
+bool
+H5WriteRowRuns(hid_t file,
+               const std::string& name,
+               const std::vector<hsize_t>& dims,
+               const std::vector<RowRun>& runs,
+               const std::vector<T>& values,
+               int compression_level)
+{
+  bool retval = false;
+
+  const int rank = static_cast<int>(dims.size());
+  hsize_t row_size = 1;
+  for (int d = 1; d < rank; ++d)
+    row_size *= dims[d];
+
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  if (dims[0] > 0 and row_size > 0)
+  {
+    auto chunk_dims = dims;
+    chunk_dims[0] = std::clamp<hsize_t>(RESTART_CHUNK_BYTES / (sizeof(T) * row_size), 1, dims[0]);
+    H5Pset_chunk(dcpl, rank, chunk_dims.data());
+    if (compression_level > 0)
+      H5Pset_deflate(dcpl, static_cast<unsigned int>(compression_level));
+  }
+
+  hid_t file_space = H5Screate_simple(rank, dims.data(), nullptr);
+  hid_t dataset =
+    H5Dcreate2(file, name.c_str(), get_datatype<T>(), file_space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+  // A process that failed to create the dataset must not leave the others in the collective write
+  if (AllSucceeded(dataset != H5I_INVALID_HID))
+  {
+    SelectRowRuns(file_space, runs);
+
+    const hsize_t num_values = values.size();
+    hid_t mem_space = H5Screate_simple(1, &num_values, nullptr);
+    if (num_values == 0)
+      H5Sselect_none(mem_space);
+
+    // Processes without data still take part in the collective write
+    const T dummy{};
+    const void* buffer = values.empty() ? &dummy : values.data();
+
+    hid_t dxpl = MakeCollectiveTransferList();
+    retval =
+      H5Dwrite(dataset, get_datatype<T>(), mem_space, file_space, dxpl, buffer) >= 0 and
+      static_cast<hsize_t>(H5Sget_select_npoints(file_space)) == num_values;
+    H5Pclose(dxpl);
+    H5Sclose(mem_space);
+  }
+  if (dataset != H5I_INVALID_HID)
+    H5Dclose(dataset);
+  H5Sclose(file_space);
+  H5Pclose(dcpl);
+
+  return retval;
+}
+
+/**
+ * Collectively reads the given runs of rows of a dataset, ordered by row. The dataset rows must
+ * have `row_size` values.
+ */
+template <typename T>
+bool
+H5ReadRowRuns(hid_t file,
+              const std::string& name,
+              const std::vector<RowRun>& runs,
+              hsize_t row_size,
+              std::vector<T>& values)
+{
+  bool retval = false;
+
+  hid_t dataset = H5Dopen2(file, name.c_str(), H5P_DEFAULT);
+  if (not AllSucceeded(dataset != H5I_INVALID_HID))
+  {
+    if (dataset != H5I_INVALID_HID)
+      H5Dclose(dataset);
+    return false;
+  }
+
+  hid_t file_space = H5Dget_space(dataset);
+  const int rank = H5Sget_simple_extent_ndims(file_space);
+  hsize_t dims[2] = {0, 1};
+  H5Sget_simple_extent_dims(file_space, dims, nullptr);
+
+  // Runs past the end of the dataset are an error, but every process must take part in the read
+  bool valid = (rank == 1 or rank == 2) and dims[1] == row_size;
+  for (const auto& [first, num_rows] : runs)
+    valid = valid and first + num_rows <= dims[0];
+  if (valid)
+    SelectRowRuns(file_space, runs);
+  else
+    H5Sselect_none(file_space);
+
+  const hsize_t num_values = H5Sget_select_npoints(file_space);
+  values.assign(num_values, T{});
+  hid_t mem_space = H5Screate_simple(1, &num_values, nullptr);
+  if (num_values == 0)
+    H5Sselect_none(mem_space);
+
+  T dummy{};
+  void* buffer = values.empty() ? &dummy : values.data();
+
+  hid_t dxpl = MakeCollectiveTransferList();
+  retval = H5Dread(dataset, get_datatype<T>(), mem_space, file_space, dxpl, buffer) >= 0 and valid;
+  H5Pclose(dxpl);
+  H5Sclose(mem_space);
+  H5Sclose(file_space);
+  H5Dclose(dataset);
+
+  return retval;
+}
+
+/// Returns the number of rows of a dataset, or 0 if it does not exist.
+hsize_t
+H5NumRows(hid_t file, const std::string& name)
+{
+  hsize_t dims[2] = {0, 0};
+  hid_t dataset = H5Dopen2(file, name.c_str(), H5P_DEFAULT);
+  if (dataset != H5I_INVALID_HID)
+  {
+    hid_t space = H5Dget_space(dataset);
+    H5Sget_simple_extent_dims(space, dims, nullptr);
+    H5Sclose(space);
+    H5Dclose(dataset);
+  }
+  return dims[0];
+}
+
+/// Returns the local cells ordered by global id.
+std::vector<const Cell*>
+SortedLocalCells(const MeshContinuum& grid)
+{
+  std::vector<const Cell*> cells;
+  cells.reserve(grid.local_cells.size());
+  for (const auto& cell : grid.local_cells)
+    cells.push_back(&cell);
+  std::sort(cells.begin(),
+            cells.end(),
+            [](const Cell* a, const Cell* b) { return a->global_id < b->global_id; });
+  return cells;
+}
+
+/**
+ * Computes the first node row of each of the given cells, ordered by global id, in a layout where
+ * nodes are ordered by global cell id. The global ids are block-distributed over the processes to
+ * compute the prefix sum of the number of cell nodes, so no process holds data for all cells.
+ * `block_begin` and `block_offsets` return the part of the global cell-to-node offsets that this
+ * process is responsible for writing.
+ */
+std::vector<uint64_t>
+ComputeCellNodeOffsets(const std::vector<const Cell*>& cells,
+                       const SpatialDiscretization& discretization,
+                       uint64_t num_global_cells,
+                       uint64_t& block_begin,
+                       std::vector<uint64_t>& block_offsets)
+{
+  const auto num_procs = static_cast<uint64_t>(mpi_comm.size());
+  const auto rank = static_cast<uint64_t>(mpi_comm.rank());
+  const uint64_t block_size = std::max<uint64_t>(1, (num_global_cells + num_procs - 1) / num_procs);
+
+  // Send the number of nodes of each cell to the owner of its block
+  std::map<int, std::vector<uint64_t>> send_counts;
+  for (const auto* cell : cells)
+  {
+    auto& data = send_counts[static_cast<int>(cell->global_id / block_size)];
+    data.push_back(cell->global_id);
+    data.push_back(discretization.GetCellNumNodes(*cell));
+  }
+  const auto recv_counts = MapAllToAll(send_counts);
+
+  block_begin = std::min(rank * block_size, num_global_cells);
+  const uint64_t block_end = std::min(block_begin + block_size, num_global_cells);
+
+  std::vector<uint64_t> block_num_nodes(block_end - block_begin, 0);
+  for (const auto& [pid, data] : recv_counts)
+    for (size_t k = 0; k < data.size(); k += 2)
+      block_num_nodes[data[k] - block_begin] = data[k + 1];
+
+  uint64_t block_total = 0;
+  for (const auto num_nodes : block_num_nodes)
+    block_total += num_nodes;
+  const auto extents = BuildLocationExtents(block_total, mpi_comm);
+
+  // The owner of the last cell also writes the total number of nodes
+  const bool owns_last = block_begin < block_end and block_end == num_global_cells;
+  block_offsets.assign(block_num_nodes.size() + (owns_last ? 1 : 0), 0);
+  uint64_t offset = extents[rank];
+  for (size_t c = 0; c < block_num_nodes.size(); ++c)
+  {
+    block_offsets[c] = offset;
+    offset += block_num_nodes[c];
+  }
+  if (owns_last)
+    block_offsets.back() = offset;
+
+  // Send the offsets back, in the order in which the cells were received
+  std::map<int, std::vector<uint64_t>> send_offsets;
+  for (const auto& [pid, data] : recv_counts)
+  {
+    auto& offsets = send_offsets[pid];
+    for (size_t k = 0; k < data.size(); k += 2)
+      offsets.push_back(block_offsets[data[k] - block_begin]);
+  }
+  const auto recv_offsets = MapAllToAll(send_offsets);
+
+  std::vector<uint64_t> cell_offsets;
+  cell_offsets.reserve(cells.size());
+  std::map<int, size_t> cursors;
+  for (const auto* cell : cells)
+  {
+    const int pid = static_cast<int>(cell->global_id / block_size);
+    cell_offsets.push_back(recv_offsets.at(pid)[cursors[pid]++]);
+  }
+  return cell_offsets;
+}
+
+/// Makes the row runs of the nodes of the given cells.
+std::vector<RowRun>
+MakeNodeRowRuns(const std::vector<const Cell*>& cells,
+                const std::vector<uint64_t>& cell_offsets,
+                const SpatialDiscretization& discretization)
+{
+  std::vector<RowRun> runs;
+  for (size_t c = 0; c < cells.size(); ++c)
+    AppendRowRun(runs, cell_offsets[c], discretization.GetCellNumNodes(*cells[c]));
+  return runs;
+}
+
+/// Makes the row runs of the given cells, for datasets with one row per cell.
+std::vector<RowRun>
+MakeCellRowRuns(const std::vector<const Cell*>& cells)
+{
+  std::vector<RowRun> runs;
+  for (const auto* cell : cells)
+    AppendRowRun(runs, cell->global_id, 1);
+  return runs;
+}
+
+} // namespace
+#endif
+
+bool
+LBSSolverIO::WriteRestartData(LBSSolver& lbs_solver,
+                              const std::string& file_name,
+                              const std::map<std::string, double>& attributes)
+{
+#ifdef H5_HAVE_PARALLEL
+  const auto& options = lbs_solver.Options();
+  const auto& grid = lbs_solver.Grid();
+  const auto& discretization = lbs_solver.SpatialDiscretization();
+  const auto& uk_man = lbs_solver.UnknownManager();
+  const auto& groupsets = lbs_solver.Groupsets();
+
+  uint64_t num_moments = lbs_solver.NumMoments();
+  uint64_t num_groups = lbs_solver.NumGroups();
+  uint64_t num_global_cells = grid.GetGlobalNumberOfCells();
+  const int compression_level = options.restart_compression_level;
+
+  const auto cells = SortedLocalCells(grid);
+  uint64_t block_begin = 0;
+  std::vector<uint64_t> block_offsets;
+  const auto cell_offsets =
+    ComputeCellNodeOffsets(cells, discretization, num_global_cells, block_begin, block_offsets);
+  uint64_t num_global_nodes = discretization.GetNumLocalNodes();
+  mpi_comm.all_reduce(num_global_nodes, mpi::op::sum<uint64_t>());
+  const auto node_runs = MakeNodeRowRuns(cells, cell_offsets, discretization);
+
+  hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(fapl, mpi_comm, MPI_INFO_NULL);
+  hid_t file = H5Fcreate(file_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+  H5Pclose(fapl);
+
+  bool location_succeeded = file != H5I_INVALID_HID;
+  bool global_succeeded = true;
+  mpi_comm.all_reduce(location_succeeded, global_succeeded, mpi::op::logical_and<bool>());
+  if (not global_succeeded)
+  {
+    if (file != H5I_INVALID_HID)
+      H5Fclose(file);
+    return false;
+  }
+
+  // Attributes and dataset creation are collective, so every process writes identical metadata
+  uint64_t num_groupsets = groupsets.size();
+  uint64_t max_precursors = options.use_precursors ? lbs_solver.MaxPrecursorsPerMaterial() : 0;
+  location_succeeded = H5CreateAttribute(file, "num_cells", num_global_cells) and
+                       H5CreateAttribute(file, "num_nodes", num_global_nodes) and
+                       H5CreateAttribute(file, "num_moments", num_moments) and
+                       H5CreateAttribute(file, "num_groups", num_groups) and
+                       H5CreateAttribute(file, "num_groupsets", num_groupsets) and
+                       H5CreateAttribute(file, "max_precursors", max_precursors);
+  for (const auto& [name, value] : attributes)
+  {
+    double attribute_value = value;
+    location_succeeded = H5CreateAttribute(file, name, attribute_value) and location_succeeded;
+  }
+
+  // Cell to node offsets
+  {
+    std::vector<RowRun> runs;
+    AppendRowRun(runs, block_begin, block_offsets.size());
+    location_succeeded = H5WriteRowRuns<uint64_t>(file,
+                                                  "cell_node_offsets",
+                                                  {num_global_cells + 1},
+                                                  runs,
+                                                  block_offsets,
+                                                  compression_level) and
+                         location_succeeded;
+  }
+
+  // Flux moments
+  {
+    const auto& phi = lbs_solver.PhiOldLocal();
+    std::vector<double> values;
+    values.reserve(discretization.GetNumLocalNodes() * num_moments * num_groups);
+    for (const auto* cell : cells)
+      for (size_t i = 0; i < discretization.GetCellNumNodes(*cell); ++i)
+        for (unsigned int m = 0; m < num_moments; ++m)
+          for (unsigned int g = 0; g < num_groups; ++g)
+            values.push_back(phi[discretization.MapDOFLocal(*cell, i, uk_man, m, g)]);
+
+    location_succeeded = H5WriteRowRuns<double>(file,
+                                                "phi",
+                                                {num_global_nodes, num_moments * num_groups},
+                                                node_runs,
+                                                values,
+                                                compression_level) and
+                         location_succeeded;
+  }
+
+  // Angular fluxes
+  if (options.save_angular_flux)
+  {
+    H5CreateGroup(file, "psi");
+    const auto& psi = lbs_solver.PsiNewLocal();
+    for (const auto& groupset : groupsets)
+    {
+      const auto& psi_uk_man = groupset.psi_uk_man_;
+      const uint64_t num_gs_dirs = groupset.quadrature->omegas.size();
+      const uint64_t num_gs_groups = groupset.groups.size();
+
+      std::vector<double> values;
+      values.reserve(discretization.GetNumLocalNodes() * num_gs_dirs * num_gs_groups);
+      for (const auto* cell : cells)
+        for (size_t i = 0; i < discretization.GetCellNumNodes(*cell); ++i)
+          for (unsigned int n = 0; n < num_gs_dirs; ++n)
+            for (unsigned int g = 0; g < num_gs_groups; ++g)
+              values.push_back(
+                psi[groupset.id][discretization.MapDOFLocal(*cell, i, psi_uk_man, n, g)]);
+
+      location_succeeded = H5WriteRowRuns<double>(file,
+                                                  "psi/groupset_" + std::to_string(groupset.id),
+                                                  {num_global_nodes, num_gs_dirs * num_gs_groups},
+                                                  node_runs,
+                                                  values,
+                                                  compression_level) and
+                           location_succeeded;
+    }
+  }
+
+  // Precursors
+  if (max_precursors > 0)
+  {
+    const auto& precursors = lbs_solver.PrecursorsNewLocal();
+    std::vector<double> values;
+    values.reserve(cells.size() * max_precursors);
+    for (const auto* cell : cells)
+      for (uint64_t j = 0; j < max_precursors; ++j)
+        values.push_back(precursors[cell->local_id * max_precursors + j]);
+
+    location_succeeded = H5WriteRowRuns<double>(file,
+                                                "precursors",
+                                                {num_global_cells, max_precursors},
+                                                MakeCellRowRuns(cells),
+                                                values,
+                                                compression_level) and
+                         location_succeeded;
+  }
+
+  location_succeeded = H5Fclose(file) >= 0 and location_succeeded;
+
+  mpi_comm.all_reduce(location_succeeded, global_succeeded, mpi::op::logical_and<bool>());
+  return global_succeeded;
+#else
+  OpenSnLogicalError("Single-file restarts require HDF5 built with parallel (MPI-IO) support.");
+#endif
+}
+
+bool
+LBSSolverIO::ReadRestartData(LBSSolver& lbs_solver,
+                             const std::string& file_name,
+                             std::map<std::string, double>& attributes)
+{
+#ifdef H5_HAVE_PARALLEL
+  const auto& options = lbs_solver.Options();
+  const auto& grid = lbs_solver.Grid();
+  const auto& discretization = lbs_solver.SpatialDiscretization();
+  const auto& uk_man = lbs_solver.UnknownManager();
+  const auto& groupsets = lbs_solver.Groupsets();
+
+  const uint64_t num_moments = lbs_solver.NumMoments();
+  const uint64_t num_groups = lbs_solver.NumGroups();
+  const uint64_t num_global_cells = grid.GetGlobalNumberOfCells();
+
+  hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(fapl, mpi_comm, MPI_INFO_NULL);
+  hid_t file = H5Fopen(file_name.c_str(), H5F_ACC_RDONLY, fapl);
+  H5Pclose(fapl);
+
+  bool location_succeeded = file != H5I_INVALID_HID;
+  bool global_succeeded = true;
+  mpi_comm.all_reduce(location_succeeded, global_succeeded, mpi::op::logical_and<bool>());
+  if (not global_succeeded)
+  {
+    if (file != H5I_INVALID_HID)
+      H5Fclose(file);
+    return false;
+  }
+
+  // Check compatibility. The metadata is identical on all processes.
+  uint64_t file_num_cells = 0, file_num_moments = 0, file_num_groups = 0;
+  uint64_t file_num_groupsets = 0, file_max_precursors = 0;
+  H5ReadAttribute(file, "num_cells", file_num_cells);
+  H5ReadAttribute(file, "num_moments", file_num_moments);
+  H5ReadAttribute(file, "num_groups", file_num_groups);
+  H5ReadAttribute(file, "num_groupsets", file_num_groupsets);
+  H5ReadAttribute(file, "max_precursors", file_max_precursors);
+
+  const bool compatible = file_num_cells == num_global_cells and file_num_moments == num_moments and
+                          file_num_groups == num_groups and
+                          file_num_groupsets == groupsets.size();
+  if (not compatible)
+  {
+    log.Log0Error() << "Restart file " << file_name
+                    << " is incompatible with the problem: expected " << num_global_cells
+                    << " cells, " << num_moments << " moments and " << num_groups
+                    << " groups, found " << file_num_cells << " cells, " << file_num_moments
+                    << " moments and " << file_num_groups << " groups.";
+    H5Fclose(file);
+    return false;
+  }
+
+  for (auto& [name, value] : attributes)
+    location_succeeded = H5ReadAttribute(file, name, value) and location_succeeded;
+
+  // Read the node offsets of the local cells. Consecutive global ids share their offsets, so
+  // each run of k cells needs k + 1 offsets.
+  const auto cells = SortedLocalCells(grid);
+  std::vector<RowRun> offset_runs;
+  for (const auto* cell : cells)
+  {
+    if (not offset_runs.empty() and
+        offset_runs.back().first + offset_runs.back().second - 1 == cell->global_id)
+      ++offset_runs.back().second;
+    else
+      offset_runs.emplace_back(cell->global_id, 2);
+  }
+  std::vector<uint64_t> file_offsets;
+  location_succeeded =
+    H5ReadRowRuns<uint64_t>(file, "cell_node_offsets", offset_runs, 1, file_offsets) and
+    location_succeeded;
+
+  std::vector<uint64_t> cell_offsets;
+  if (location_succeeded)
+  {
+    cell_offsets.reserve(cells.size());
+    size_t c = 0;
+    size_t k = 0;
+    for (const auto& [first, num_entries] : offset_runs)
+    {
+      for (hsize_t r = 0; r + 1 < num_entries; ++r, ++c, ++k)
+      {
+        const auto num_file_nodes = file_offsets[k + 1] - file_offsets[k];
+        if (num_file_nodes != discretization.GetCellNumNodes(*cells[c]))
+          location_succeeded = false;
+        cell_offsets.push_back(file_offsets[k]);
+      }
+      ++k;
+    }
+  }
+  else
+    cell_offsets.assign(cells.size(), 0);
+
+  // A process with an incompatible mesh reads nothing but still takes part in the collective reads
+  const auto node_runs = location_succeeded
+                           ? MakeNodeRowRuns(cells, cell_offsets, discretization)
+                           : std::vector<RowRun>{};
+
+  // Flux moments
+  {
+    std::vector<double> values;
+    location_succeeded =
+      H5ReadRowRuns<double>(file, "phi", node_runs, num_moments * num_groups, values) and
+      location_succeeded;
+
+    if (location_succeeded)
+    {
+      auto& phi = lbs_solver.PhiOldLocal();
+      phi.assign(discretization.GetNumLocalDOFs(uk_man), 0.0);
+      size_t v = 0;
+      for (const auto* cell : cells)
+        for (size_t i = 0; i < discretization.GetCellNumNodes(*cell); ++i)
+          for (unsigned int m = 0; m < num_moments; ++m)
+            for (unsigned int g = 0; g < num_groups; ++g)
+              phi[discretization.MapDOFLocal(*cell, i, uk_man, m, g)] = values[v++];
+    }
+  }
+
+  // Angular fluxes
+  if (options.save_angular_flux and H5Has(file, "psi"))
+  {
+    auto& psi = lbs_solver.PsiNewLocal();
+    for (const auto& groupset : groupsets)
+    {
+      const auto& psi_uk_man = groupset.psi_uk_man_;
+      const uint64_t num_gs_dirs = groupset.quadrature->omegas.size();
+      const uint64_t num_gs_groups = groupset.groups.size();
+
+      std::vector<double> values;
+      location_succeeded = H5ReadRowRuns<double>(file,
+                                                 "psi/groupset_" + std::to_string(groupset.id),
+                                                 node_runs,
+                                                 num_gs_dirs * num_gs_groups,
+                                                 values) and
+                           location_succeeded;
+
+      if (location_succeeded)
+      {
+        auto& gs_psi = psi[groupset.id];
+        gs_psi.assign(discretization.GetNumLocalDOFs(psi_uk_man), 0.0);
+        size_t v = 0;
+        for (const auto* cell : cells)
+          for (size_t i = 0; i < discretization.GetCellNumNodes(*cell); ++i)
+            for (unsigned int n = 0; n < num_gs_dirs; ++n)
+              for (unsigned int g = 0; g < num_gs_groups; ++g)
+                gs_psi[discretization.MapDOFLocal(*cell, i, psi_uk_man, n, g)] = values[v++];
+      }
+    }
+  }
+
+  // Precursors
+  const uint64_t max_precursors =
+    options.use_precursors ? lbs_solver.MaxPrecursorsPerMaterial() : 0;
+  if (max_precursors > 0 and file_max_precursors == max_precursors and
+      H5NumRows(file, "precursors") == num_global_cells)
+  {
+    std::vector<double> values;
+    location_succeeded =
+      H5ReadRowRuns<double>(file,
+                            "precursors",
+                            location_succeeded ? MakeCellRowRuns(cells) : std::vector<RowRun>{},
+                            max_precursors,
+                            values) and
+      location_succeeded;
+
+    if (location_succeeded)
+    {
+      auto& precursors = lbs_solver.PrecursorsNewLocal();
+      size_t v = 0;
+      for (const auto* cell : cells)
+        for (uint64_t j = 0; j < max_precursors; ++j)
+          precursors[cell->local_id * max_precursors + j] = values[v++];
+    }
+  }
+
+  H5Fclose(file);
+
+  mpi_comm.all_reduce(location_succeeded, global_succeeded, mpi::op::logical_and<bool>());
+  return global_succeeded;
+#else
+  OpenSnLogicalError("Single-file restarts require HDF5 built with parallel (MPI-IO) support.");
+#endif
+}
+
+} // namespace opensn
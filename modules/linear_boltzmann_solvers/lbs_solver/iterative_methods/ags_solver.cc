@@ -74,8 +74,8 @@ AGSSolver::Solve()
     lbs_solver_.QMomentsLocal() = saved_qmoms;
 
     // Write restart data
-    if (lbs_solver_.RestartsEnabled() and lbs_solver_.TriggerRestartDump() and
-        lbs_solver_.Options().enable_ags_restart_write)
+    if (lbs_solver_.Options().enable_ags_restart_write and lbs_solver_.RestartsEnabled() and
+        lbs_solver_.TriggerRestartDump())
     {
       lbs_solver_.WriteRestartData();
     }
@@ -89,7 +89,10 @@ AGSSolver::Solve()
   // If restarts are enabled, always write a restart dump upon convergence or when we reach the
   // iteration limit
   if (lbs_solver_.RestartsEnabled() && lbs_solver_.Options().enable_ags_restart_write)
+  {
     lbs_solver_.WriteRestartData();
+    lbs_solver_.WaitForRestartData();
+  }
 }
 
 } // namespace opensn
\ No newline at end of file
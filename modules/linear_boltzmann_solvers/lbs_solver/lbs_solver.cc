@@ -10,13 +10,16 @@
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion_mip_solver.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/point_source/point_source.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/io/lbs_solver_io.h"
 #include "framework/math/spatial_discretization/finite_element/piecewise_linear/piecewise_linear_discontinuous.h"
 #include "framework/materials/multi_group_xs/multi_group_xs.h"
+#include "framework/materials/multi_group_xs/temperature_dependent_xs.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/math/time_integrations/time_integration.h"
 #include "framework/field_functions/field_function_grid_based.h"
 #include "framework/materials/material.h"
 #include "framework/logging/log.h"
+#include "framework/mpi/mpi_utils.h"
 #include "framework/utils/hdf_utils.h"
 #include "framework/object_factory.h"
 #include "framework/runtime.h"
@@ -26,6 +29,7 @@
 #include <fstream>
 #include <cstring>
 #include <cassert>
+#include <set>
 #include <sys/stat.h>
 
 namespace opensn
@@ -215,6 +219,118 @@ LBSSolver::GetMatID2IsoSrcMap() const
   return matid_to_src_map_;
 }
 
+void
+LBSSolver::SetCellTemperatures(
+  const std::map<int, std::shared_ptr<TemperatureDependentXS>>& matid_to_txs_map,
+  const std::vector<double>& cell_temperatures)
+{
+  CALI_CXX_MARK_SCOPE("LBSSolver::SetCellTemperatures");
+
+  OpenSnLogicalErrorIf(grid_ptr_ == nullptr or
+                         cell_transport_views_.size() != grid_ptr_->local_cells.size(),
+                       "The solver must be initialized before setting cell temperatures.");
+  OpenSnInvalidArgumentIf(cell_temperatures.size() != grid_ptr_->local_cells.size(),
+                          "The number of cell temperatures must equal the number of local cells.");
+
+  for (const auto& [mat_id, txs] : matid_to_txs_map)
+    OpenSnInvalidArgumentIf(txs->NumGroups() < num_groups_,
+                            "The temperature-dependent cross sections for material " +
+                              std::to_string(mat_id) + " have fewer groups than the simulation.");
+
+  matid_to_txs_map_ = matid_to_txs_map;
+  cell_temperatures_ = cell_temperatures;
+  AssignCellXS();
+
+  // Re-assemble the diffusion acceleration with the new cross sections. The sparsity of the
+  // matrices is unchanged, so only their values are updated.
+  for (auto& groupset : groupsets_)
+  {
+    if (groupset.wgdsa_solver)
+    {
+      auto& solver = *groupset.wgdsa_solver;
+      solver.SetCellXS(PackGroupsetXS(
+        cell_id_to_temperature_xs_, groupset.groups.front().id, groupset.groups.back().id));
+      std::vector<double> dummy_rhs(discretization_->GetNumLocalDOFs(solver.UnknownStructure()),
+                                    0.0);
+      solver.AssembleAand_b(dummy_rhs);
+    }
+    if (groupset.tgdsa_solver)
+    {
+      auto& solver = *groupset.tgdsa_solver;
+      solver.SetCellXS(MakeTGDSACellXS(groupset));
+      std::vector<double> dummy_rhs(discretization_->GetNumLocalDOFs(solver.UnknownStructure()),
+                                    0.0);
+      solver.AssembleAand_b(dummy_rhs);
+    }
+  }
+}
+
+const std::map<uint64_t, std::shared_ptr<MultiGroupXS>>&
+LBSSolver::GetCellTemperatureXSMap() const
+{
+  return cell_id_to_temperature_xs_;
+}
+
+void
+LBSSolver::AssignCellXS()
+{
+  CALI_CXX_MARK_SCOPE("LBSSolver::AssignCellXS");
+
+  cell_id_to_temperature_xs_.clear();
+  if (not matid_to_txs_map_.empty() and cell_temperatures_.size() != grid_ptr_->local_cells.size())
+  {
+    log.Log0Warning() << "The number of local cells changed since the cell temperatures were set. "
+                         "The cell temperatures are discarded.";
+    matid_to_txs_map_.clear();
+    cell_temperatures_.clear();
+  }
+
+  std::map<int, std::vector<uint64_t>> send_cell_ids;
+  std::map<int, std::vector<double>> send_temperatures;
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    auto& transport_view = cell_transport_views_[cell.local_id];
+    const auto it = matid_to_txs_map_.find(cell.material_id);
+    if (it == matid_to_txs_map_.end())
+    {
+      transport_view.ReassignXS(*matid_to_xs_map_.at(cell.material_id));
+      continue;
+    }
+
+    // Cells at the same quantized temperature share a cached cross section
+    const double temperature = cell_temperatures_[cell.local_id];
+    auto xs = it->second->GetXS(temperature);
+    xs->SetAdjointMode(options_.adjoint);
+    transport_view.ReassignXS(*xs);
+    cell_id_to_temperature_xs_[cell.global_id] = xs;
+
+    std::set<int> ghost_partitions;
+    for (const auto& face : cell.faces)
+      if (face.has_neighbor and not face.IsNeighborLocal(*grid_ptr_))
+        ghost_partitions.insert(face.GetNeighborPartitionID(*grid_ptr_));
+    for (const int pid : ghost_partitions)
+    {
+      send_cell_ids[pid].push_back(cell.global_id);
+      send_temperatures[pid].push_back(temperature);
+    }
+  }
+
+  // Evaluate the cross sections of ghost cells at the temperatures of their owners
+  const auto recv_cell_ids = MapAllToAll(send_cell_ids);
+  const auto recv_temperatures = MapAllToAll(send_temperatures);
+  for (const auto& [pid, cell_ids] : recv_cell_ids)
+  {
+    const auto& temperatures = recv_temperatures.at(pid);
+    for (size_t i = 0; i < cell_ids.size(); ++i)
+    {
+      const auto& ghost_cell = grid_ptr_->cells[cell_ids[i]];
+      auto xs = matid_to_txs_map_.at(ghost_cell.material_id)->GetXS(temperatures[i]);
+      xs->SetAdjointMode(options_.adjoint);
+      cell_id_to_temperature_xs_[cell_ids[i]] = xs;
+    }
+  }
+}
+
 const MeshContinuum&
 LBSSolver::Grid() const
 {
@@ -445,6 +561,24 @@ LBSSolver::OptionsBlock()
   params.AddOptionalParameter("write_restart_time_interval",
                               0,
                               "Time interval in seconds at which restart data is to be written.");
+  params.AddOptionalParameter("write_restart_wall_time",
+                              0.0,
+                              "Elapsed wall time in seconds after which a single restart dump is "
+                              "written, e.g., shortly before the end of a batch allocation. 0 "
+                              "disables it.");
+  params.AddOptionalParameter("async_restart_write",
+                              false,
+                              "Flag for writing per-process restart files on a background thread "
+                              "while the solver continues iterating. Single-file restarts are "
+                              "always written synchronously.");
+  params.AddOptionalParameter("restart_single_file",
+                              false,
+                              "Flag for writing and reading restart data as a single parallel HDF5 "
+                              "file that can be read on any number of processes.");
+  params.AddOptionalParameter("restart_compression_level",
+                              0,
+                              "Deflate compression level (0-9) of single-file restart data. 0 "
+                              "disables compression.");
   params.AddOptionalParameter(
     "use_precursors", false, "Flag for using delayed neutron precursors.");
   params.AddOptionalParameter("use_source_moments",
@@ -453,6 +587,14 @@ LBSSolver::OptionsBlock()
                               "moments obtained elsewhere.");
   params.AddOptionalParameter(
     "save_angular_flux", false, "Flag indicating whether angular fluxes are to be stored or not.");
+  params.AddOptionalParameter("tally_leakage",
+                              false,
+                              "Flag for tallying the boundary leakage during the sweep so that it "
+                              "can be computed without storing the angular fluxes.");
+  params.AddOptionalParameter("tally_boundary_angular_flux",
+                              false,
+                              "Flag for tallying the surface-integrated angular flux on every "
+                              "boundary during the sweep.");
   params.AddOptionalParameter(
     "adjoint", false, "Flag for toggling whether the solver is in adjoint mode.");
   params.AddOptionalParameter(
@@ -629,6 +771,23 @@ LBSSolver::SetOptions(const InputParameters& params)
     else if (spec.Name() == "write_restart_path")
       options_.write_restart_path = spec.GetValue<std::string>();
 
+    else if (spec.Name() == "write_restart_wall_time")
+      options_.write_restart_wall_time = spec.GetValue<double>();
+
+    else if (spec.Name() == "async_restart_write")
+      options_.async_restart_write = spec.GetValue<bool>();
+
+    else if (spec.Name() == "restart_single_file")
+      options_.restart_single_file = spec.GetValue<bool>();
+
+    else if (spec.Name() == "restart_compression_level")
+    {
+      options_.restart_compression_level = spec.GetValue<int>();
+      OpenSnInvalidArgumentIf(options_.restart_compression_level < 0 or
+                                options_.restart_compression_level > 9,
+                              "restart_compression_level must be in the range [0, 9].");
+    }
+
     else if (spec.Name() == "use_precursors")
       options_.use_precursors = spec.GetValue<bool>();
 
@@ -638,6 +797,12 @@ LBSSolver::SetOptions(const InputParameters& params)
     else if (spec.Name() == "save_angular_flux")
       options_.save_angular_flux = spec.GetValue<bool>();
 
+    else if (spec.Name() == "tally_leakage")
+      options_.tally_leakage = spec.GetValue<bool>();
+
+    else if (spec.Name() == "tally_boundary_angular_flux")
+      options_.tally_boundary_angular_flux = spec.GetValue<bool>();
+
     else if (spec.Name() == "verbose_inner_iterations")
       options_.verbose_inner_iterations = spec.GetValue<bool>();
 
@@ -721,7 +886,7 @@ LBSSolver::SetOptions(const InputParameters& params)
     }
   } // for p
 
-  if (options_.write_restart_time_interval > 0)
+  if (RestartsEnabled())
   {
     auto dir = options_.write_restart_path.parent_path();
     if (opensn::mpi_comm.rank() == 0)
@@ -789,6 +954,7 @@ LBSSolver::Initialize()
   InitializeGroupsets();
   ComputeNumberOfMoments();
   InitializeParrays();
+  AssignCellXS();
   InitializeBoundaries();
 
   // Initialize point sources
@@ -1022,13 +1188,7 @@ LBSSolver::InitializeMaterials()
 
   // Update transport views if available
   if (grid_ptr_->local_cells.size() == cell_transport_views_.size())
-    for (const auto& cell : grid_ptr_->local_cells)
-    {
-      const auto& xs_ptr = matid_to_xs_map_[cell.material_id];
-      auto& transport_view = cell_transport_views_[cell.local_id];
-
-      transport_view.ReassignXS(*xs_ptr);
-    }
+    AssignCellXS();
 
   log.Log0Verbose1() << "Materials Initialized:\n" << materials_list.str() << "\n";
 
@@ -1639,6 +1799,8 @@ LBSSolver::InitWGDSA(LBSGroupset& groupset, bool vaccum_bcs_are_dirichlet)
                                                        unit_cell_matrices_,
                                                        false,
                                                        true);
+    solver->SetCellXS(PackGroupsetXS(
+      cell_id_to_temperature_xs_, groupset.groups.front().id, groupset.groups.back().id));
     ParameterBlock block;
 
     solver->options.residual_tolerance = groupset.wgdsa_tol;
@@ -1756,7 +1918,7 @@ LBSSolver::AssembleWGDSADeltaPhiVector(const LBSGroupset& groupset,
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
-    const auto& sigma_s = matid_to_xs_map_[cell.material_id]->SigmaSGtoG();
+    const auto& sigma_s = cell_transport_views_[cell.local_id].XS().SigmaSGtoG();
 
     for (size_t i = 0; i < num_nodes; ++i)
     {
@@ -1855,6 +2017,7 @@ LBSSolver::InitTGDSA(LBSGroupset& groupset)
                                                        unit_cell_matrices_,
                                                        false,
                                                        true);
+    solver->SetCellXS(MakeTGDSACellXS(groupset));
 
     solver->options.residual_tolerance = groupset.tgdsa_tol;
     solver->options.max_iters = groupset.tgdsa_max_iters;
@@ -1871,6 +2034,26 @@ LBSSolver::InitTGDSA(LBSGroupset& groupset)
   }
 }
 
+std::map<uint64_t, Multigroup_D_and_sigR>
+LBSSolver::MakeTGDSACellXS(LBSGroupset& groupset)
+{
+  auto& map_xs_2_tginfo = groupset.tg_acceleration_info_.map_xs_2_tginfo;
+  map_xs_2_tginfo.clear();
+  for (const auto& [cell_id, xs] : cell_id_to_temperature_xs_)
+    if (map_xs_2_tginfo.count(xs.get()) == 0)
+      map_xs_2_tginfo.insert(
+        std::make_pair(xs.get(), MakeTwoGridCollapsedInfo(*xs, EnergyCollapseScheme::JFULL)));
+
+  std::map<uint64_t, Multigroup_D_and_sigR> cell_id_2_mgxs_map;
+  for (const auto& [cell_id, xs] : cell_id_to_temperature_xs_)
+  {
+    const auto& tg_info = map_xs_2_tginfo.at(xs.get());
+    cell_id_2_mgxs_map.insert(std::make_pair(
+      cell_id, Multigroup_D_and_sigR{{tg_info.collapsed_D}, {tg_info.collapsed_sig_a}}));
+  }
+  return cell_id_2_mgxs_map;
+}
+
 void
 LBSSolver::CleanUpTGDSA(LBSGroupset& groupset)
 {
@@ -1900,7 +2083,7 @@ LBSSolver::AssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
-    const auto& S = matid_to_xs_map_[cell.material_id]->TransferMatrix(0);
+    const auto& S = cell_transport_views_[cell.local_id].XS().TransferMatrix(0);
 
     for (size_t i = 0; i < num_nodes; ++i)
     {
@@ -1937,13 +2120,17 @@ LBSSolver::DisAssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
   const size_t gss = groupset.groups.size();
 
   const auto& map_mat_id_2_tginfo = groupset.tg_acceleration_info_.map_mat_id_2_tginfo;
+  const auto& map_xs_2_tginfo = groupset.tg_acceleration_info_.map_xs_2_tginfo;
 
   for (const auto& cell : grid_ptr_->local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
 
-    const auto& xi_g = map_mat_id_2_tginfo.at(cell.material_id).spectrum;
+    const auto it = map_xs_2_tginfo.find(&cell_transport_views_[cell.local_id].XS());
+    const auto& xi_g = it != map_xs_2_tginfo.end()
+                         ? it->second.spectrum
+                         : map_mat_id_2_tginfo.at(cell.material_id).spectrum;
 
     for (size_t i = 0; i < num_nodes; ++i)
     {
@@ -1962,20 +2149,67 @@ LBSSolver::DisAssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
 bool
 LBSSolver::TriggerRestartDump()
 {
-  auto now = std::chrono::system_clock::now().time_since_epoch();
-  size_t now_secs = std::chrono::duration_cast<std::chrono::seconds>(now).count();
+  // Only one asynchronous dump is written at a time. Its success must be reported before the
+  // timers are checked, because the restart times are only updated once it has been written.
+  if (restart_writer_.Pending())
+  {
+    bool all_ready = true;
+    mpi_comm.all_reduce(restart_writer_.Ready(), all_ready, mpi::op::logical_and<bool>());
+    if (not all_ready)
+      return false;
+    restart_writer_.Wait();
+  }
+
+  // Clocks are not synchronized across processes, so the root decides for everyone
+  int trigger = 0;
+  if (opensn::mpi_comm.rank() == 0)
+  {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    size_t now_secs = std::chrono::duration_cast<std::chrono::seconds>(now).count();
 
-  if ((now_secs - last_restart_write_time_) < options_.write_restart_time_interval)
-    return false;
+    if (options_.write_restart_time_interval > 0 and
+        (now_secs - last_restart_write_time_) >= options_.write_restart_time_interval)
+      trigger |= 1;
 
-  return true;
+    const double elapsed_secs = program_timer.GetTime() / 1000.0;
+    if (options_.write_restart_wall_time > 0 and not wall_time_restart_written_ and
+        elapsed_secs >= options_.write_restart_wall_time)
+      trigger |= 2;
+  }
+  opensn::mpi_comm.broadcast(trigger, 0);
+
+  wall_time_restart_due_ = (trigger & 2) != 0;
+  return trigger != 0;
 }
 
 void
 LBSSolver::UpdateLastRestartWriteTime()
+{
+  RecordRestartWrite(wall_time_restart_due_);
+  wall_time_restart_due_ = false;
+}
+
+std::function<void()>
+LBSSolver::MakeRestartWrittenCallback()
+{
+  // The trigger can be evaluated again before the write completes, so the dump keeps its own flag
+  const bool wall_time_dump = wall_time_restart_due_;
+  wall_time_restart_due_ = false;
+  return [this, wall_time_dump] { RecordRestartWrite(wall_time_dump); };
+}
+
+void
+LBSSolver::RecordRestartWrite(bool wall_time_dump)
 {
   auto now = std::chrono::system_clock::now().time_since_epoch();
   last_restart_write_time_ = std::chrono::duration_cast<std::chrono::seconds>(now).count();
+
+  // The wall-time dump is only used up when a triggered dump is actually written
+  if (wall_time_dump)
+  {
+    wall_time_restart_written_ = true;
+    log.Log() << "Wrote the wall-time restart dump.";
+  }
 }
 
 void
@@ -1984,6 +2218,30 @@ LBSSolver::WriteRestartData()
   CALI_CXX_MARK_SCOPE("LBSSolver::WriteRestartData");
 
   std::string fbase = options_.write_restart_path.string();
+
+  if (options_.restart_single_file)
+  {
+    const std::string fname = fbase + ".restart.h5";
+    if (LBSSolverIO::WriteRestartData(*this, fname))
+    {
+      log.Log() << "Successfully wrote restart data to " << fname;
+      UpdateLastRestartWriteTime();
+    }
+    else
+      log.Log0Error() << "Failed to write restart data to " << fname;
+    return;
+  }
+
+  // Angular fluxes are only written when they are stored
+  static const std::vector<std::vector<double>> no_psi;
+  const auto& psi = options_.save_angular_flux ? psi_new_local_ : no_psi;
+
+  if (options_.async_restart_write)
+  {
+    restart_writer_.Write(fbase, phi_old_local_, psi, {}, MakeRestartWrittenCallback());
+    return;
+  }
+
   std::string fname = fbase + std::to_string(opensn::mpi_comm.rank()) + ".restart.h5";
 
   // Write data
@@ -1992,6 +2250,10 @@ LBSSolver::WriteRestartData()
   if (file)
   {
     location_succeeded = H5WriteDataset1D<double>(file, "phi_old", phi_old_local_);
+    for (size_t gs = 0; gs < psi.size(); ++gs)
+      location_succeeded =
+        H5WriteDataset1D<double>(file, "psi_groupset_" + std::to_string(gs), psi[gs]) and
+        location_succeeded;
     H5Fclose(file);
   }
   else
@@ -2008,12 +2270,36 @@ LBSSolver::WriteRestartData()
     log.Log0Error() << "Failed to write restart data to " << fbase << "X.restart.h5";
 }
 
+void
+LBSSolver::WaitForRestartData()
+{
+  restart_writer_.Wait();
+}
+
+AsyncRestartWriter&
+LBSSolver::GetRestartWriter()
+{
+  return restart_writer_;
+}
+
 void
 LBSSolver::ReadRestartData()
 {
   CALI_CXX_MARK_SCOPE("LBSSolver::ReadRestartData");
 
   std::string fbase = options_.read_restart_path.string();
+
+  if (options_.restart_single_file)
+  {
+    const std::string fname = fbase + ".restart.h5";
+    std::map<std::string, double> attributes;
+    if (LBSSolverIO::ReadRestartData(*this, fname, attributes))
+      log.Log() << "Successfully read restart data from " << fname;
+    else
+      throw std::logic_error("Failed to read restart data from " + fname);
+    return;
+  }
+
   std::string fname = fbase + std::to_string(opensn::mpi_comm.rank()) + ".restart.h5";
 
   bool location_succeeded = true;
@@ -2023,6 +2309,13 @@ LBSSolver::ReadRestartData()
     phi_old_local_.clear();
     phi_old_local_ = H5ReadDataset1D<double>(file, "phi_old");
     location_succeeded = not phi_old_local_.empty();
+    if (options_.save_angular_flux)
+      for (size_t gs = 0; gs < psi_new_local_.size(); ++gs)
+      {
+        const auto name = "psi_groupset_" + std::to_string(gs);
+        if (H5Has(file, name))
+          psi_new_local_[gs] = H5ReadDataset1D<double>(file, name);
+      }
     H5Fclose(file);
   }
   else
@@ -2064,12 +2357,22 @@ LBSSolver::UpdateFieldFunctions()
   const auto& sdm = *discretization_;
   const auto& phi_uk_man = flux_moments_uk_man_;
 
-  // Update flux moments
+  // Update flux moments. With nodal storage, each field function is copied directly from a
+  // strided range of the flux moments vector.
+  const bool nodal_storage = phi_uk_man.dof_storage_type == UnknownStorageType::NODAL;
   for (const auto& [g_and_m, ff_index] : phi_field_functions_local_map_)
   {
     const size_t g = g_and_m.first;
     const size_t m = g_and_m.second;
 
+    auto& ff_ptr = field_functions_.at(ff_index);
+    if (nodal_storage)
+    {
+      ff_ptr->UpdateFieldVector(
+        phi_new_local_, phi_uk_man.MapUnknown(m, g), phi_uk_man.GetTotalUnknownStructureSize());
+      continue;
+    }
+
     std::vector<double> data_vector_local(local_node_count_, 0.0);
 
     for (const auto& cell : grid_ptr_->local_cells)
@@ -2086,7 +2389,6 @@ LBSSolver::UpdateFieldFunctions()
       } // for node
     }   // for cell
 
-    auto& ff_ptr = field_functions_.at(ff_index);
     ff_ptr->UpdateFieldVector(data_vector_local);
   }
 
@@ -2103,9 +2405,9 @@ LBSSolver::UpdateFieldFunctions()
 
       const auto& Vi = unit_cell_matrices_[cell.local_id].intV_shapeI;
 
-      const auto& xs = matid_to_xs_map_.at(cell.material_id);
+      const auto& xs = cell_transport_views_[cell.local_id].XS();
 
-      if (not xs->IsFissionable())
+      if (not xs.IsFissionable())
         continue;
 
       for (size_t i = 0; i < num_nodes; ++i)
@@ -2116,8 +2418,8 @@ LBSSolver::UpdateFieldFunctions()
         double nodal_power = 0.0;
         for (size_t g = 0; g < groups_.size(); ++g)
         {
-          const double sigma_fg = xs->SigmaFission()[g];
-          // const double kappa_g = xs->Kappa()[g];
+          const double sigma_fg = xs.SigmaFission()[g];
+          // const double kappa_g = xs.Kappa()[g];
           const double kappa_g = options_.power_default_kappa;
 
           nodal_power += kappa_g * sigma_fg * phi_new_local_[imapB + g];
@@ -2285,6 +2587,51 @@ LBSSolver::ComputeFissionRate(const std::vector<double>& phi)
   return global_fission_rate;
 }
 
+double
+LBSSolver::ComputeGenerationTime(const std::vector<double>& phi)
+{
+  CALI_CXX_MARK_SCOPE("LBSSolver::ComputeGenerationTime");
+
+  const int first_grp = groups_.front().id;
+  const int last_grp = groups_.back().id;
+
+  // Loop over local cells
+  double local_density = 0.0;
+  for (auto& cell : grid_ptr_->local_cells)
+  {
+    const auto& transport_view = cell_transport_views_[cell.local_id];
+    const auto& cell_matrices = unit_cell_matrices_[cell.local_id];
+
+    // Obtain xs
+    const auto& inv_velocity = transport_view.XS().InverseVelocity();
+    if (inv_velocity.empty())
+      continue;
+
+    // Loop over nodes
+    const int num_nodes = transport_view.NumNodes();
+    for (int i = 0; i < num_nodes; ++i)
+    {
+      const size_t uk_map = transport_view.MapDOF(i, 0, 0);
+      const double IntV_ShapeI = cell_matrices.intV_shapeI(i);
+
+      // Loop over groups
+      for (size_t g = first_grp; g <= last_grp; ++g)
+        local_density += inv_velocity[g] * phi[uk_map + g] * IntV_ShapeI;
+    } // for node
+  }   // for cell
+
+  // Allreduce global density
+  double global_density = 0.0;
+  mpi_comm.all_reduce(local_density, global_density, mpi::op::sum<double>());
+
+  const double production = ComputeFissionProduction(phi);
+  OpenSnLogicalErrorIf(production <= 0.0,
+                       "The generation time requires a flux shape with a positive fission "
+                       "production.");
+
+  return global_density / production;
+}
+
 void
 LBSSolver::ComputePrecursors()
 {
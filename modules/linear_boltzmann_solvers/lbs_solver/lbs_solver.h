@@ -9,6 +9,7 @@
 #include "modules/linear_boltzmann_solvers/lbs_solver/point_source/point_source.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/volumetric_source/volumetric_source.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/io/async_restart_writer.h"
 #include "framework/math/spatial_discretization/spatial_discretization.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/math/linear_solver/linear_solver.h"
@@ -24,6 +25,7 @@ class GridFaceHistogram;
 class TimeIntegration;
 class AGSSolver;
 class WGSLinearSolver;
+class TemperatureDependentXS;
 struct WGSContext;
 
 /// Base class for all Linear Boltzmann Solvers.
@@ -117,6 +119,23 @@ public:
   /// Returns a reference to the map of material ids to Isotropic Srcs.
   const std::map<int, std::shared_ptr<IsotropicMultiGroupSource>>& GetMatID2IsoSrcMap() const;
 
+  /**
+   * Assigns temperature-dependent cross sections to the local cells. Cells whose material id is in
+   * `matid_to_txs_map` use the cross sections evaluated at their temperature. All other cells
+   * keep the cross sections of their material. `cell_temperatures` is indexed by local cell id.
+   * The temperatures persist through reinitialization of the solver. The diffusion acceleration
+   * matrices of the groupsets are re-assembled with the new cross sections.
+   */
+  void SetCellTemperatures(
+    const std::map<int, std::shared_ptr<TemperatureDependentXS>>& matid_to_txs_map,
+    const std::vector<double>& cell_temperatures);
+
+  /**
+   * Returns the temperature-dependent cross sections of the local and ghost cells, keyed on
+   * global cell id. Cells that use the cross sections of their material are not included.
+   */
+  const std::map<uint64_t, std::shared_ptr<MultiGroupXS>>& GetCellTemperatureXSMap() const;
+
   /// Obtains a reference to the grid.
   const MeshContinuum& Grid() const;
 
@@ -249,15 +268,38 @@ public:
                                       const std::vector<double>& delta_phi_local,
                                       std::vector<double>& ref_phi_new);
 
-  bool RestartsEnabled() { return options_.write_restart_time_interval > 0; }
+  bool RestartsEnabled()
+  {
+    return options_.write_restart_time_interval > 0 or options_.write_restart_wall_time > 0;
+  }
 
+  /**
+   * Returns true if a restart dump is due, either because the restart time interval has elapsed
+   * or because the program has run longer than the restart wall time. The decision is made on
+   * the root process so that all processes agree. The wall-time dump stays due until a dump is
+   * written after it was triggered. While an asynchronous dump is still being written no new dump
+   * is triggered; a finished one is waited for first. Collective.
+   */
   bool TriggerRestartDump();
 
+  /// Records that the triggered restart dump was written now.
   void UpdateLastRestartWriteTime();
 
+  /**
+   * Returns a callback that records the triggered restart dump as written, for an asynchronous
+   * write to invoke once it has succeeded.
+   */
+  std::function<void()> MakeRestartWrittenCallback();
+
   /// Writes phi_old to restart file.
   void WriteRestartData();
 
+  /// Waits for an asynchronous restart write in progress to complete. Collective.
+  void WaitForRestartData();
+
+  /// Returns the writer used for asynchronous per-process restart files.
+  AsyncRestartWriter& GetRestartWriter();
+
   /// Read phi_old from restart file.
   void ReadRestartData();
 
@@ -282,6 +324,13 @@ public:
    */
   double ComputeFissionRate(const std::vector<double>& phi);
 
+  /**
+   * Computes the prompt neutron generation time of the flux shape `phi`, i.e. the ratio of the
+   * total neutron density to the total fission production. Both are integrated with a unit
+   * weight function rather than an adjoint flux.
+   */
+  double ComputeGenerationTime(const std::vector<double>& phi);
+
   /// Compute the steady state delayed neutron precursor concentrations.
   void ComputePrecursors();
 
@@ -324,8 +373,15 @@ protected:
   /// Initializes the Within-Group DSA solver.
   void InitTGDSA(LBSGroupset& groupset);
 
+  /// Sets the last restart write time to now and, for the wall-time dump, marks it written.
+  void RecordRestartWrite(bool wall_time_dump);
+
   LBSOptions options_;
   size_t last_restart_write_time_ = 0;
+  bool wall_time_restart_written_ = false;
+  /// Set when the last trigger was due to the wall time, until the dump is written.
+  bool wall_time_restart_due_ = false;
+  AsyncRestartWriter restart_writer_;
   size_t num_moments_ = 0;
   size_t num_groups_ = 0;
   size_t num_precursors_ = 0;
@@ -336,6 +392,12 @@ protected:
 
   std::map<int, std::shared_ptr<MultiGroupXS>> matid_to_xs_map_;
   std::map<int, std::shared_ptr<IsotropicMultiGroupSource>> matid_to_src_map_;
+  /// Temperature-dependent cross sections of materials, set with cell temperatures
+  std::map<int, std::shared_ptr<TemperatureDependentXS>> matid_to_txs_map_;
+  /// Cell temperatures, indexed by local cell id
+  std::vector<double> cell_temperatures_;
+  /// Cross sections evaluated at the temperatures of local and ghost cells, keyed on global id
+  std::map<uint64_t, std::shared_ptr<MultiGroupXS>> cell_id_to_temperature_xs_;
 
   std::vector<PointSource> point_sources_;
   std::vector<VolumetricSource> volumetric_sources_;
@@ -377,6 +439,19 @@ protected:
   /// Time integration parameter meant to be set by an executor
   std::shared_ptr<const TimeIntegration> time_integration_ = nullptr;
 
+  /**
+   * Points the transport view of each local cell at the cross sections of its material, or at
+   * those evaluated at its temperature when cell temperatures are set. The temperatures of local
+   * cells are communicated to the partitions that hold them as ghost cells.
+   */
+  void AssignCellXS();
+
+  /**
+   * Collapses the temperature-dependent cross sections of the cells for the Two-Grid DSA of a
+   * groupset. Cells at the same quantized temperature share their collapsed info.
+   */
+  std::map<uint64_t, Multigroup_D_and_sigR> MakeTGDSACellXS(LBSGroupset& groupset);
+
   /// Cleans up memory consuming items.
   static void CleanUpWGDSA(LBSGroupset& groupset);
 
@@ -6,6 +6,7 @@
 #include "framework/materials/multi_group_xs/multi_group_xs.h"
 #include "framework/materials/isotropic_multigroup_source.h"
 #include "framework/math/math.h"
+#include "framework/math/spatial_discretization/finite_element/unit_cell_matrices.h"
 #include <functional>
 #include <map>
 
@@ -207,6 +208,14 @@ struct LBSOptions
     opensn::input_path.replace_extension("restart").string() + "/" +
     opensn::input_path.stem().string();
   size_t write_restart_time_interval = 0;
+  /// Elapsed wall time in seconds after which one restart dump is written (0 disables).
+  double write_restart_wall_time = 0.0;
+  /// Write per-process restart files on a background thread.
+  bool async_restart_write = false;
+  /// Write and read restart data as one parallel HDF5 file readable on any number of processes.
+  bool restart_single_file = false;
+  /// Deflate level for single-file restart datasets (0 disables compression).
+  int restart_compression_level = 0;
 
   bool enable_ags_restart_write = true;
 
@@ -214,6 +223,10 @@ struct LBSOptions
   bool use_src_moments = false;
 
   bool save_angular_flux = false;
+  /// Tally the boundary leakage during the sweep so that it is available without stored psi.
+  bool tally_leakage = false;
+  /// Tally the surface-integrated angular flux on every boundary during the sweep.
+  bool tally_boundary_angular_flux = false;
 
   bool adjoint = false;
 
@@ -319,16 +332,4 @@ public:
   void ReassignXS(const MultiGroupXS& xs) { xs_ = &xs; }
 };
 
-struct UnitCellMatrices
-{
-  DenseMatrix<double> intV_gradshapeI_gradshapeJ;
-  DenseMatrix<Vector3> intV_shapeI_gradshapeJ;
-  DenseMatrix<double> intV_shapeI_shapeJ;
-  Vector<double> intV_shapeI;
-
-  std::vector<DenseMatrix<double>> intS_shapeI_shapeJ;
-  std::vector<DenseMatrix<Vector3>> intS_shapeI_gradshapeJ;
-  std::vector<Vector<double>> intS_shapeI;
-};
-
 } // namespace opensn
@@ -243,19 +243,19 @@ SourceFunction::AddVolumetricSources(const LBSGroupset& groupset,
       {
         const auto& cell = grid.local_cells[local_id];
         const auto& transport_view = cell_transport_views[local_id];
-        const auto nodes = discretization.GetCellNodeLocations(cell);
+        const auto& nodes = discretization.GetCellNodeLocations(cell);
         const auto num_cell_nodes = discretization.GetCellNumNodes(cell);
 
+        // Compute group-wise values for all cell nodes at once
+        const auto src = volumetric_source(cell, nodes, num_groups);
+
         // Go through each of the cell nodes
         for (size_t i = 0; i < num_cell_nodes; ++i)
         {
-          // Compute group-wise values for this node
-          const auto src = volumetric_source(cell, nodes[i], num_groups);
-
           // Contribute to the source moments
           const auto dof_map = transport_view.MapDOF(i, 0, 0);
           for (size_t g = gs_i; g <= gs_f; ++g)
-            q[dof_map + g] += src[g];
+            q[dof_map + g] += src[i * num_groups + g];
         } // for node i
       }   // for subscriber
     }     // for volumetric source
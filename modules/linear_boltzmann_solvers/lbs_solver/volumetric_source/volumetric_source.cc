@@ -124,4 +124,23 @@ VolumetricSource::operator()(const Cell& cell, const Vector3& xyz, const int num
     return function_->Evaluate(xyz, num_groups);
 }
 
+std::vector<double>
+VolumetricSource::operator()(const Cell& cell,
+                             const std::vector<Vector3>& nodes,
+                             const int num_groups) const
+{
+  std::vector<double> values;
+  if (std::count(subscribers_.begin(), subscribers_.end(), cell.local_id) == 0)
+    values.assign(nodes.size() * num_groups, 0.0);
+  else if (not function_)
+  {
+    values.reserve(nodes.size() * num_groups);
+    for (size_t i = 0; i < nodes.size(); ++i)
+      values.insert(values.end(), strength_.begin(), strength_.end());
+  }
+  else
+    function_->Evaluate(nodes, num_groups, values);
+  return values;
+}
+
 } // namespace opensn
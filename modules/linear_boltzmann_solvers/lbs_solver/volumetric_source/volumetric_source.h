@@ -41,6 +41,16 @@ public:
    */
   std::vector<double> operator()(const Cell& cell, const Vector3& xyz, int num_groups) const;
 
+  /**
+   * Evaluate the distributed source at a batch of nodes of a cell for all groups. The values are
+   * stored node by node.
+   *
+   * If the cell does not belong to the logical volume tied to this source,
+   * a vector of zeros are returned.
+   */
+  std::vector<double>
+  operator()(const Cell& cell, const std::vector<Vector3>& nodes, int num_groups) const;
+
   size_t NumLocalSubscribers() const { return num_local_subsribers_; }
   size_t NumGlobalSubsribers() const { return num_global_subscribers_; }
 
@@ -434,13 +434,13 @@ ResponseEvaluator::EvaluateResponse(const std::string& buffer) const
       const auto& nodes = discretization.GetCellNodeLocations(cell);
 
       const auto num_cell_nodes = transport_view.NumNodes();
+      const auto vals = volumetric_source(cell, nodes, num_groups);
       for (size_t i = 0; i < num_cell_nodes; ++i)
       {
         const auto& V_i = fe_values.intV_shapeI(i);
         const auto dof_map = transport_view.MapDOF(i, 0, 0);
-        const auto& vals = volumetric_source(cell, nodes[i], num_groups);
         for (size_t g = 0; g < num_groups; ++g)
-          local_response += vals[g] * phi_dagger[dof_map + g] * V_i;
+          local_response += vals[i * num_groups + g] * phi_dagger[dof_map + g] * V_i;
       }
     }
 
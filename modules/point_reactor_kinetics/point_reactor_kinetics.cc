@@ -8,6 +8,7 @@
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "framework/math/math.h"
+#include <algorithm>
 #include <numeric>
 
 namespace opensn
@@ -41,25 +42,35 @@ PRKSolver::GetInputParameters()
   params.AddOptionalParameter(
     "time_integration", "implicit_euler", "Time integration scheme to use");
 
+  params.AddOptionalParameter("num_micro_steps",
+                              1,
+                              "Number of micro steps per time step. Changes of the reactivity and "
+                              "generation time within a time step, e.g. from a transport solve "
+                              "at the end of the step, are interpolated linearly across the "
+                              "micro steps and evaluated where the time integration scheme "
+                              "evaluates them.");
+
   auto time_intgl_list =
     AllowableRangeList::New({"explicit_euler", "implicit_euler", "crank_nicolson"});
 
   params.ConstrainParameterRange("time_integration", std::move(time_intgl_list));
 
   params.ConstrainParameterRange("gen_time", AllowableRangeLowLimit::New(1.0e-12));
+  params.ConstrainParameterRange("num_micro_steps", AllowableRangeLowLimit::New(1));
   params.ConstrainParameterRange("initial_source", AllowableRangeLowLimit::New(0.0));
   params.ConstrainParameterRange("initial_population", AllowableRangeLowLimit::New(0.0));
   return params;
 }
 
 PRKSolver::PRKSolver(const InputParameters& params)
-  : opensn::Solver(params.GetParamValue<std::string>("name")),
+  : opensn::Solver(params),
     lambdas_(params.GetParamVectorValue<double>("precursor_lambdas")),
     betas_(params.GetParamVectorValue<double>("precursor_betas")),
     gen_time_(params.GetParamValue<double>("gen_time")),
     rho_(params.GetParamValue<double>("initial_rho")),
     source_strength_(params.GetParamValue<double>("initial_source")),
     time_integration_(params.GetParamValue<std::string>("time_integration")),
+    num_micro_steps_(params.GetParamValue<unsigned int>("num_micro_steps")),
     num_precursors_(lambdas_.size())
 {
   log.Log() << "Created solver " << Name();
@@ -89,6 +100,8 @@ PRKSolver::Initialize()
                                     "the data lists are of different size.");
 
   beta_ = std::accumulate(betas_.begin(), betas_.end(), 0.0);
+  rho_prev_ = rho_;
+  gen_time_prev_ = gen_time_;
 
   // Initializing linalg items
   const auto& J = num_precursors_;
@@ -144,6 +157,15 @@ PRKSolver::Execute()
   while (timestepper_->IsActive())
   {
     physics_ev_pub.SolverStep(*this);
+
+    // Retake the step if the timestepper rejects its error
+    if (not timestepper_->AcceptTimeStep(error_estimate_))
+    {
+      log.Log() << "Solver \"" + Name() + "\" rejected the step with error estimate "
+                << error_estimate_;
+      continue;
+    }
+
     physics_ev_pub.SolverAdvance(*this);
   }
 }
@@ -155,32 +177,55 @@ PRKSolver::Step()
 
   const double dt = timestepper_->TimeStepSize();
 
-  A_(0, 0) = beta_ * (rho_ - 1.0) / gen_time_;
-
-  if (time_integration_ == "implicit_euler" or time_integration_ == "crank_nicolson")
+  // The kinetics parameters are interpolated from their values at the start of the step to their
+  // current values. Each scheme evaluates them where it evaluates the kinetics matrix: at the
+  // theta-weighted point of a micro step for the theta schemes, and at its start and end for the
+  // explicit ones. The solution of an embedded scheme of another order gives an estimate of the
+  // local error.
+  const double micro_dt = dt / static_cast<double>(num_micro_steps_);
+  auto SetKineticsMatrixAt = [this](double micro_time)
+  {
+    const double w = micro_time / static_cast<double>(num_micro_steps_);
+    SetKineticsMatrix(rho_prev_ + w * (rho_ - rho_prev_),
+                      gen_time_prev_ + w * (gen_time_ - gen_time_prev_));
+  };
+
+  auto x = x_t_;
+  auto x_embedded = x_t_;
+  for (unsigned int k = 0; k < num_micro_steps_; ++k)
   {
-    double theta = 1.0;
-
     if (time_integration_ == "implicit_euler")
-      theta = 1.0;
+    {
+      SetKineticsMatrixAt(k + 1.0);
+      x = ThetaStep(x, 1.0, micro_dt);
+      SetKineticsMatrixAt(k + 0.5);
+      x_embedded = ThetaStep(x_embedded, 0.5, micro_dt);
+    }
     else if (time_integration_ == "crank_nicolson")
-      theta = 0.5;
-
-    const double inv_tau = theta * dt;
-
-    auto A_theta = Subtract(I_, Scaled(A_, inv_tau));
-    auto b_theta = Add(x_t_, Scaled(q_, inv_tau));
-
-    auto x_theta = Mult(Inverse(A_theta), b_theta);
-
-    x_tp1_ = Add(x_t_, Scaled(Subtract(x_theta, x_t_), 1.0 / theta));
-  }
-  else if (time_integration_ == "explicit_euler")
-  {
-    x_tp1_ = Add(x_t_, Add(Scaled(Mult(A_, x_t_), dt), Scaled(q_, dt)));
+    {
+      SetKineticsMatrixAt(k + 0.5);
+      x = ThetaStep(x, 0.5, micro_dt);
+      SetKineticsMatrixAt(k + 1.0);
+      x_embedded = ThetaStep(x_embedded, 1.0, micro_dt);
+    }
+    else if (time_integration_ == "explicit_euler")
+    {
+      SetKineticsMatrixAt(k);
+      x = Add(x, Scaled(Add(Mult(A_, x), q_), micro_dt));
+
+      // Heun's method
+      const auto f = Add(Mult(A_, x_embedded), q_);
+      const auto x_pred = Add(x_embedded, Scaled(f, micro_dt));
+      SetKineticsMatrixAt(k + 1.0);
+      const auto f_pred = Add(Mult(A_, x_pred), q_);
+      x_embedded = Add(x_embedded, Scaled(Add(f, f_pred), 0.5 * micro_dt));
+    }
+    else
+      OpenSnLogicalError("Unsupported time integration scheme.");
   }
-  else
-    OpenSnLogicalError("Unsupported time integration scheme.");
+  x_tp1_ = x;
+
+  error_estimate_ = std::abs(x_tp1_(0) - x_embedded(0)) / std::max(std::abs(x_tp1_(0)), 1.0e-12);
 
   if ((std::abs(x_t_(0)) > 1e-12) && std::abs((x_tp1_(0) / x_t_(0)) - 1.) > 1e-12)
     period_tph_ = dt / std::log(x_tp1_(0) / x_t_(0));
@@ -193,10 +238,33 @@ PRKSolver::Step()
     period_tph_ = -1.0e6;
 }
 
+void
+PRKSolver::SetKineticsMatrix(double rho, double gen_time)
+{
+  A_(0, 0) = beta_ * (rho - 1.0) / gen_time;
+  for (size_t j = 1; j <= num_precursors_; ++j)
+    A_(j, 0) = betas_[j - 1] / gen_time;
+}
+
+Vector<double>
+PRKSolver::ThetaStep(const Vector<double>& x, double theta, double dt) const
+{
+  const double inv_tau = theta * dt;
+
+  auto A_theta = Subtract(I_, Scaled(A_, inv_tau));
+  auto b_theta = Add(x, Scaled(q_, inv_tau));
+
+  auto x_theta = Mult(Inverse(A_theta), b_theta);
+
+  return Add(x, Scaled(Subtract(x_theta, x), 1.0 / theta));
+}
+
 void
 PRKSolver::Advance()
 {
   x_t_ = x_tp1_;
+  rho_prev_ = rho_;
+  gen_time_prev_ = gen_time_;
   timestepper_->Advance();
 }
 
@@ -211,8 +279,12 @@ PRKSolver::GetInfo(const ParameterBlock& params) const
     return ParameterBlock("", PopulationNew());
   else if (param_name == "period")
     return ParameterBlock("", period_tph_);
+  else if (param_name == "error_estimate")
+    return ParameterBlock("", error_estimate_);
   else if (param_name == "rho")
     return ParameterBlock("", rho_);
+  else if (param_name == "gen_time")
+    return ParameterBlock("", gen_time_);
   else if (param_name == "solution")
   {
     std::vector<double> sln = x_t_.ToStdVector();
@@ -255,6 +327,12 @@ PRKSolver::Period() const
   return period_tph_;
 }
 
+double
+PRKSolver::ErrorEstimate() const
+{
+  return error_estimate_;
+}
+
 double
 PRKSolver::TimePrev() const
 {
@@ -285,6 +363,13 @@ PRKSolver::SetRho(double value)
   rho_ = value;
 }
 
+void
+PRKSolver::SetGenerationTime(double value)
+{
+  OpenSnInvalidArgumentIf(value <= 0.0, "The generation time must be positive.");
+  gen_time_ = value;
+}
+
 void
 PRKSolver::SetProperties(const ParameterBlock& params)
 {
@@ -295,6 +380,8 @@ PRKSolver::SetProperties(const ParameterBlock& params)
     const std::string& param_name = param.Name();
     if (param_name == "rho")
       SetRho(param.GetValue<double>());
+    else if (param_name == "gen_time")
+      SetGenerationTime(param.GetValue<double>());
   }
 }
 
@@ -21,12 +21,25 @@ private:
   double rho_;
   double source_strength_;
   std::string time_integration_;
+  /// Reactivity and generation time at the start of the step.
+  double rho_prev_ = 0.0;
+  double gen_time_prev_ = 0.0;
+  /// Number of micro steps per step, across which rho and the generation time are interpolated.
+  unsigned int num_micro_steps_;
 
   size_t num_precursors_;
   DenseMatrix<double> A_, I_;
   Vector<double> x_t_, x_tp1_, q_;
   double beta_ = 1.0;
   double period_tph_ = 0.0;
+  /// Relative local error of the population in the last step, estimated with an embedded scheme.
+  double error_estimate_ = 0.0;
+
+  /// Sets the kinetics matrix for the given reactivity and generation time.
+  void SetKineticsMatrix(double rho, double gen_time);
+
+  /// Returns the solution after one theta-scheme step of size dt from x.
+  Vector<double> ThetaStep(const Vector<double>& x, double theta, double dt) const;
 
 public:
   /// Sets input parameters.
@@ -49,6 +62,8 @@ public:
   double PopulationNew() const;
   /// Returns the period computed for the last time step.
   double Period() const;
+  /// Returns the relative local error estimated for the last time step.
+  double ErrorEstimate() const;
   /// Returns the time computed for the last time step.
   double TimePrev() const;
   /// Returns the time computed for the next time step.
@@ -68,6 +83,7 @@ public:
    *
    * PRK Transient solver settable properties:
    * - `rho`, The current reactivity
+   * - `gen_time`, The current neutron generation time
    *
    * Parents:
    * \copydoc opensn::Solver::SetProperties
@@ -76,6 +92,9 @@ public:
 
   /// Sets the value of rho.
   void SetRho(double value);
+
+  /// Sets the neutron generation time.
+  void SetGenerationTime(double value);
 };
 
 } // namespace opensn
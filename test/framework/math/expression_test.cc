@@ -0,0 +1,76 @@
+#include "lua/framework/console/console.h"
+#include "framework/parameters/input_parameters.h"
+#include "framework/math/functions/expression.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+namespace
+{
+
+/// Returns `x + (x + (... + x))` with `n` terms, which needs `n` evaluation stack slots.
+std::string
+NestedSum(size_t n)
+{
+  std::string expression = "x";
+  for (size_t i = 1; i < n; ++i)
+    expression = "x + (" + expression + ")";
+  return expression;
+}
+
+} // namespace
+
+ParameterBlock
+ExpressionTest(const InputParameters&)
+{
+  OpenSnLogicalErrorIf(opensn::mpi_comm.size() != 1, "Requires 1 processor");
+
+  opensn::log.Log() << "GOLD_BEGIN";
+
+  const std::vector<std::string> names = {"x", "y"};
+  const double xy[] = {2.0, 3.0};
+
+  // Constant subexpressions fold into a single instruction
+  Expression folded("1 + 2 * 3 - y", names);
+  opensn::log.Log() << "folded = " << folded.Evaluate(xy);
+
+  // 16 slots fit the fixed-size evaluation stack, 17 need the heap-allocated one
+  for (const size_t n : {15, 16, 17})
+  {
+    Expression nested(NestedSum(n), names);
+
+    const std::vector<double> x = {1.0, 2.0, 3.0};
+    std::vector<double> batch(x.size());
+    nested.Evaluate(x.size(), {x.data(), nullptr}, batch.data());
+
+    opensn::log.Log() << "nested sum of " << n << " terms = " << nested.Evaluate(xy)
+                      << ", batch = " << batch[0] << " " << batch[1] << " " << batch[2];
+  }
+
+  // Evaluate reads its result from the bottom of the stack, so an expression that compiles to no
+  // instructions must be rejected
+  for (const std::string expression : {"", "   ", "()"})
+  {
+    try
+    {
+      Expression empty(expression, names);
+      opensn::log.Log() << "\"" << expression << "\" accepted";
+    }
+    catch (const std::invalid_argument&)
+    {
+      opensn::log.Log() << "\"" << expression << "\" rejected";
+    }
+  }
+
+  opensn::log.Log() << "GOLD_END";
+
+  return ParameterBlock();
+}
+
+RegisterWrapperFunctionInNamespace(unit_tests, ExpressionTest, nullptr, ExpressionTest);
+
+} // namespace unit_tests
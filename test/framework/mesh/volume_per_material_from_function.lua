@@ -0,0 +1,37 @@
+-- 2D test of setting material IDs from a function handle.
+num_procs = 3
+
+-- ############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+-- ############################################### Setup mesh
+nodes = {}
+N = 20
+L = 5.
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+-- ############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+mat_id_function = opensn.ExpressionScalarSpatialMaterialFunction.Create({
+  expression = "if(x <= 0.25, 1, mat_id)",
+})
+mesh.SetMaterialIDFromFunction(mat_id_function)
+
+mesh.ComputeVolumePerMaterialID()
@@ -0,0 +1,107 @@
+-- 2D CFEM diffusion with a linear solution, exported as an XDMF time series from 2 processes.
+-- Test: maxval=2.666667 and 2 steps in the XDMF index
+
+--############################################### Setup mesh
+nodes = {}
+N = 10
+L = 2
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+D = { 1.0 }
+Q = { 0.0 }
+XSa = { 0.0 }
+function D_coef(i, pt)
+  return D[i + 1]
+end
+function Q_ext(i, pt)
+  return Q[i + 1]
+end
+function Sigma_a(i, pt)
+  return XSa[i + 1]
+end
+
+-- Setboundary IDs
+-- xmin,xmax,ymin,ymax,zmin,zmax
+e_vol = logvol.RPPLogicalVolume.Create({ xmin = 0.99999, xmax = 1000.0, infy = true, infz = true })
+w_vol =
+  logvol.RPPLogicalVolume.Create({ xmin = -1000.0, xmax = -0.99999, infy = true, infz = true })
+n_vol = logvol.RPPLogicalVolume.Create({ ymin = 0.99999, ymax = 1000.0, infx = true, infz = true })
+s_vol =
+  logvol.RPPLogicalVolume.Create({ ymin = -1000.0, ymax = -0.99999, infx = true, infz = true })
+
+e_bndry = "0"
+w_bndry = "1"
+n_bndry = "2"
+s_bndry = "3"
+
+mesh.SetBoundaryIDFromLogicalVolume(e_vol, e_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(w_vol, w_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(n_vol, n_bndry)
+mesh.SetBoundaryIDFromLogicalVolume(s_vol, s_bndry)
+
+diff_options = {
+  boundary_conditions = {
+    {
+      boundary = e_bndry,
+      type = "robin",
+      coeffs = { 0.25, 0.5, 0.0 },
+    },
+    {
+      boundary = n_bndry,
+      type = "reflecting",
+    },
+    {
+      boundary = s_bndry,
+      type = "reflecting",
+    },
+    {
+      boundary = w_bndry,
+      type = "robin",
+      coeffs = { 0.25, 0.5, 1.0 },
+    },
+  },
+}
+
+-- CFEM solver
+phys1 = diffusion.CFEMDiffusionSolver.Create({
+  name = "CFEMDiffusionSolver",
+  residual_tolerance = 1e-8,
+})
+diffusion.SetOptions(phys1, diff_options)
+
+solver.Initialize(phys1)
+solver.Execute(phys1)
+
+--############################################### Get field functions
+fflist, count = solver.GetFieldFunctionList(phys1)
+
+--############################################### Export XDMF
+-- Two exports of the same base name make a time series with the mesh written once
+fieldfunc.ExportToXDMF({ fflist[1] }, "CFEMDiff2D_linear_xdmf", 0.0)
+fieldfunc.ExportToXDMF({ fflist[1] }, "CFEMDiff2D_linear_xdmf", 1.0, true)
+
+-- The index is written by the root before the export returns
+xdmf_file = io.open("CFEMDiff2D_linear_xdmf.xmf", "r")
+xdmf_index = xdmf_file:read("*all")
+xdmf_file:close()
+_, num_steps = string.gsub(xdmf_index, '<Grid Name="step_', "")
+log.Log(LOG_0, "XDMF steps " .. num_steps)
+
+--############################################### PostProcessors
+post.AggregateNodalValuePostProcessor.Create({
+  name = "maxval",
+  field_function = math.floor(fflist[1]),
+  operation = "max",
+})
+post.Execute({ "maxval" })
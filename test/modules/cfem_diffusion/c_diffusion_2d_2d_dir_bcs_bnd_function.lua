@@ -0,0 +1,97 @@
+-- 2D Diffusion with Dirichlet BCs on boundaries set from a function handle, on 2 processes.
+-- Test: avgval=0.295902, as with the boundaries set from logical volumes
+
+--############################################### Setup mesh
+nodes = {}
+N = 40
+L = 2
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+vol0 = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+mesh.SetMaterialIDFromLogicalVolume(vol0, 0)
+
+vol1 =
+  logvol.RPPLogicalVolume.Create({ xmin = -0.5, xmax = 0.5, ymin = -0.5, ymax = 0.5, infz = true })
+mesh.SetMaterialIDFromLogicalVolume(vol1, 1)
+
+D = { 1.0, 0.01 }
+Q = { 1.0, 10.0 }
+XSa = { 1.0, 10.0 }
+function D_coef(i, pt)
+  return D[i + 1]
+end
+function Q_ext(i, pt)
+  return Q[i + 1]
+end
+function Sigma_a(i, pt)
+  return XSa[i + 1]
+end
+
+-- Set boundary IDs from a function handle
+e_bndry = "0"
+w_bndry = "1"
+n_bndry = "2"
+s_bndry = "3"
+
+bndry_function = opensn.ExpressionScalarSpatialMaterialFunction.Create({
+  expression = "if(x > 0.99999, 0, if(x < -0.99999, 1, "
+    .. "if(y > 0.99999, 2, if(y < -0.99999, 3, -1))))",
+})
+mesh.SetBoundaryIDFromFunction(bndry_function, { e_bndry, w_bndry, n_bndry, s_bndry })
+
+diff_options = {
+  boundary_conditions = {
+    {
+      boundary = e_bndry,
+      type = "dirichlet",
+      coeffs = { 0.0 },
+    },
+    {
+      boundary = n_bndry,
+      type = "dirichlet",
+      coeffs = { 0.0 },
+    },
+    {
+      boundary = s_bndry,
+      type = "dirichlet",
+      coeffs = { 0.0 },
+    },
+    {
+      boundary = w_bndry,
+      type = "dirichlet",
+      coeffs = { 0.0 },
+    },
+  },
+}
+
+-- CFEM solver
+phys1 = diffusion.CFEMDiffusionSolver.Create({
+  name = "CFEMDiffusionSolver",
+  residual_tolerance = 1e-8,
+})
+diffusion.SetOptions(phys1, diff_options)
+
+solver.Initialize(phys1)
+solver.Execute(phys1)
+
+--############################################### Get field functions
+fflist, count = solver.GetFieldFunctionList(phys1)
+
+--############################################### Volume integrations
+
+--############################################### PostProcessors
+post.CellVolumeIntegralPostProcessor.Create({
+  name = "avgval",
+  field_function = math.floor(fflist[1]),
+  compute_volume_average = true,
+})
+post.Execute({ "avgval" })
@@ -0,0 +1,73 @@
+-- 1D 1G KEigenvalue::Solver test of the generation time of the flux shape
+-- In a homogeneous one-group medium the generation time does not depend on
+-- the shape: 1/(v nu Sigma_f) = 1.0e-6 / 0.7 = 1.428571e-06.
+num_procs = 2
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+L = 100.0
+n_cells = 50
+nodes = {}
+dx = L / n_cells
+for i = 0, n_cells do
+  nodes[i + 1] = i * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = mat.AddMaterial("Fissile Material")
+
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, OPENSN_XSFILE, "xs_1g_inv_velocity.xs")
+
+--############################################### Setup Physics
+num_groups = 1
+lbs_block = {
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, num_groups - 1 },
+      angular_quadrature_handle = aquad.CreateProductQuadrature(GAUSS_LEGENDRE, 16),
+      inner_linear_method = "petsc_gmres",
+      l_max_its = 500,
+      l_abs_tol = 1.0e-8,
+    },
+  },
+}
+
+lbs_options = {
+  scattering_order = 0,
+  verbose_inner_iterations = false,
+  verbose_outer_iterations = true,
+}
+
+phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys, lbs_options)
+
+k_solver0 = lbs.NonLinearKEigen.Create({
+  lbs_solver_handle = phys,
+  nl_max_its = 5000,
+  nl_abs_tol = 1.0e-8,
+})
+solver.Initialize(k_solver0)
+solver.Execute(k_solver0)
+
+--############################################### Generation time
+gen_time = lbs.ComputeGenerationTime(phys, "NEW")
+log.Log(LOG_0, string.format("Generation-time=%.6e", gen_time))
@@ -0,0 +1,162 @@
+-- 2D 2G KEigenvalue::Solver test with temperature-dependent cross sections and DSA
+-- The library tabulates the cross sections at 294K and 600K. The cell temperatures
+-- rise linearly in x, so that the ten columns of cells are at 294K, 328K, ..., 600K
+-- and all but the outer two use interpolated cross sections. The same problem is then
+-- solved with one material per column, read from a library that tabulates the
+-- linearly interpolated cross sections at each column temperature. Both solutions
+-- must agree, which holds only if every cell uses its own cross sections. The
+-- materials start out with the cross sections at 294K, which give a different
+-- solution.
+num_procs = 2
+
+--############################################### Check num_procs
+if check_num_procs == nil and number_of_processes ~= num_procs then
+  log.Log(
+    LOG_0ERROR,
+    "Incorrect amount of processors. "
+      .. "Expected "
+      .. tostring(num_procs)
+      .. ". Pass check_num_procs=false to override if possible."
+  )
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+N = 10
+L = 1.0
+nodes = {}
+dx = L / N
+for i = 0, N do
+  nodes[i + 1] = i * dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+-- One material per column of cells
+for i = 0, N - 1 do
+  column = logvol.RPPLogicalVolume.Create({
+    xmin = i * dx,
+    xmax = (i + 1) * dx,
+    infy = true,
+    infz = true,
+  })
+  mesh.SetMaterialIDFromLogicalVolume(column, i)
+end
+
+--############################################### Add materials
+materials = {}
+for i = 0, N - 1 do
+  materials[i + 1] = mat.AddMaterial("Fissile Material " .. tostring(i))
+  mat.SetProperty(
+    materials[i + 1],
+    TRANSPORT_XSECTIONS,
+    OPENMC_XSLIB,
+    "xs_2g_temperatures.h5",
+    294.0
+  )
+end
+
+txs = xs.CreateTemperatureDependent("xs_2g_temperatures.h5", "set1", "linear", 1.0)
+
+--############################################### Setup Physics
+num_groups = 2
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 4, 4)
+aquad.OptimizeForPolarSymmetry(pquad, 4.0 * math.pi)
+
+lbs_block = {
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, num_groups - 1 },
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "petsc_gmres",
+      l_max_its = 100,
+      gmres_restart_interval = 50,
+      l_abs_tol = 1.0e-10,
+      apply_wgdsa = true,
+      wgdsa_l_abs_tol = 1.0e-4,
+      apply_tgdsa = true,
+      tgdsa_l_abs_tol = 1.0e-4,
+    },
+  },
+  options = {
+    boundary_conditions = {
+      { name = "xmin", type = "reflecting" },
+      { name = "xmax", type = "reflecting" },
+      { name = "ymin", type = "reflecting" },
+      { name = "ymax", type = "reflecting" },
+    },
+    scattering_order = 0,
+    use_precursors = false,
+    verbose_inner_iterations = false,
+    verbose_outer_iterations = true,
+  },
+}
+
+--############################################### Flux shape
+-- Returns the peak-to-average ratios of both groups and the ratio of the average
+-- thermal to fast flux, which do not depend on the flux normalization.
+vol_all = logvol.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+
+function FluxShape(phys)
+  fflist, count = lbs.GetScalarFieldFunctionList(phys)
+  values = {}
+  for _, op in ipairs({ OP_MAX, OP_AVG }) do
+    for g = 1, num_groups do
+      ffi = fieldfunc.FFInterpolationCreate(VOLUME)
+      fieldfunc.SetProperty(ffi, OPERATION, op)
+      fieldfunc.SetProperty(ffi, LOGICAL_VOLUME, vol_all)
+      fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, fflist[g])
+      fieldfunc.Initialize(ffi)
+      fieldfunc.Execute(ffi)
+      values[#values + 1] = fieldfunc.GetValue(ffi)
+    end
+  end
+  return { values[1] / values[3], values[2] / values[4], values[4] / values[3] }
+end
+
+--############################################### Solve with cell temperatures
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+k_solver0 = lbs.PowerIterationKEigen.Create({ lbs_solver_handle = phys1 })
+solver.Initialize(k_solver0)
+
+temperature = opensn.ExpressionScalarSpatialMaterialFunction.Create({
+  expression = "277.0 + 340.0 * x",
+})
+txs_map = {}
+for i = 0, N - 1 do
+  txs_map[i] = txs
+end
+lbs.SetCellTemperatures(phys1, txs_map, temperature)
+
+solver.Execute(k_solver0)
+shape1 = FluxShape(phys1)
+
+--############################################### Solve with column materials
+for i = 0, N - 1 do
+  mat.SetProperty(
+    materials[i + 1],
+    TRANSPORT_XSECTIONS,
+    OPENMC_XSLIB,
+    "xs_2g_temperatures_reference.h5",
+    294.0 + 34.0 * i
+  )
+end
+
+phys2 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+k_solver1 = lbs.PowerIterationKEigen.Create({ lbs_solver_handle = phys2 })
+solver.Initialize(k_solver1)
+solver.Execute(k_solver1)
+shape2 = FluxShape(phys2)
+
+--############################################### Compare
+max_diff = 0.0
+for i = 1, 3 do
+  log.Log(LOG_0, string.format("Flux shape %d: %.7f %.7f", i, shape1[i], shape2[i]))
+  max_diff = math.max(max_diff, math.abs(shape1[i] - shape2[i]) / shape2[i])
+end
+log.Log(LOG_0, string.format("Flux shape difference=%.3e", max_diff))
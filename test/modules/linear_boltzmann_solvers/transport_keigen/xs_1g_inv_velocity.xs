@@ -0,0 +1,26 @@
+NUM_GROUPS		1
+NUM_MOMENTS	    1
+
+SIGMA_T_BEGIN
+0		1.0
+SIGMA_T_END
+
+SIGMA_F_BEGIN
+0		0.35
+SIGMA_F_END
+
+NU_BEGIN
+0		2.0
+NU_END
+
+CHI_BEGIN
+0		1.0
+CHI_END
+
+TRANSFER_MOMENTS_BEGIN
+M_GPRIME_G_VAL	0		0		0		0.3
+TRANSFER_MOMENTS_END
+
+INV_VELOCITY_BEGIN
+0		1.0e-6
+INV_VELOCITY_END
@@ -0,0 +1,79 @@
+-- Infinite, 1-group, pure absorber with a point probe of the scalar flux. The point lies in a cell
+-- owned by one process, and the other processes must still take part in the ghost exchange.
+-- Test: Point-value=1.0
+-- Create Mesh
+nodes = {}
+N = 2
+L = 10
+xmin = -L / 2
+dx = L / N
+for i = 1, (N + 1) do
+  k = i - 1
+  nodes[i] = xmin + k * dx
+end
+
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+
+-- Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+materials = {}
+materials[1] = mat.AddMaterial("TestMat")
+
+num_groups = 1
+
+-- Add cross sections to materials
+mat.SetProperty(materials[1], TRANSPORT_XSECTIONS, SIMPLE_ONE_GROUP, 1.0, 0.0)
+
+src = {}
+src[1] = 1.0
+mat.SetProperty(materials[1], ISOTROPIC_MG_SOURCE, FROM_ARRAY, src)
+
+-- Angular Quadrature
+pquad = aquad.CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV, 2, 2)
+
+-- LBS block option
+lbs_block = {
+  num_groups = num_groups,
+  groupsets = {
+    {
+      groups_from_to = { 0, num_groups - 1 },
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "petsc_richardson",
+      l_abs_tol = 1.0e-9,
+      l_max_its = 300,
+    },
+  },
+  options = {
+    boundary_conditions = {
+      { name = "xmin", type = "reflecting" },
+      { name = "xmax", type = "reflecting" },
+      { name = "ymin", type = "reflecting" },
+      { name = "ymax", type = "reflecting" },
+      { name = "zmin", type = "reflecting" },
+      { name = "zmax", type = "reflecting" },
+    },
+  },
+}
+
+phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+-- Initialize and execute solver
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+
+solver.Initialize(ss_solver)
+solver.Execute(ss_solver)
+
+-- Point probe
+fflist, count = lbs.GetScalarFieldFunctionList(phys)
+
+ffi = fieldfunc.FFInterpolationCreate(POINT)
+fieldfunc.SetProperty(ffi, PROBEPOINT, { x = 1.3, y = -2.1, z = 0.7 })
+fieldfunc.SetProperty(ffi, ADD_FIELDFUNCTION, fflist[1])
+
+fieldfunc.Initialize(ffi)
+fieldfunc.Execute(ffi)
+point_value = fieldfunc.GetValue(ffi)
+
+log.Log(LOG_0, string.format("Point-value=%.6f", point_value))
@@ -0,0 +1,23 @@
+-- Point-reactor kinetics test of the adaptive timestepper
+-- A step insertion of 0.5$ is followed for one second with Crank-Nicolson
+-- steps whose local error is estimated by comparison with Backward Euler. The
+-- reference population at t = 1 s is 2.69738.
+
+timestepper = physics.AdaptiveTimeStepper.Create({
+  dt = 1.0e-3,
+  tolerance = 1.0e-4,
+})
+
+phys0 = prk.PRKSolver.Create({
+  initial_source = 0.0,
+  initial_rho = 0.5,
+  time_integration = "crank_nicolson",
+  timestepper = timestepper,
+  dt = 1.0e-3,
+  end_time = 1.0,
+})
+
+solver.Initialize(phys0)
+solver.Execute(phys0)
+
+log.Log(LOG_0, string.format("population=%.5f", solver.GetInfo(phys0, "neutron_population")))
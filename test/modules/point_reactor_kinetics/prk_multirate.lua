@@ -0,0 +1,26 @@
+-- Point-reactor kinetics test of multirate stepping
+-- The reactivity is ramped at 0.5$/s and only updated at the end of every
+-- macro step of 0.1 s, as it would be by a transport solve of the flux shape.
+-- The amplitude is advanced with 20 Crank-Nicolson micro steps per macro step,
+-- across which the reactivity is interpolated and evaluated at the midpoint of
+-- each micro step. The reference population at t = 1 s is 2.2609, whereas
+-- single steps per macro step give 2.2537.
+
+phys0 = prk.PRKSolver.Create({
+  initial_source = 0.0,
+  initial_rho = 0.0,
+  time_integration = "crank_nicolson",
+  num_micro_steps = 20,
+  dt = 0.1,
+  end_time = 1.0,
+})
+
+solver.Initialize(phys0)
+
+for n = 1, 10 do
+  prk.SetParam(phys0, "rho", 0.05 * n)
+  solver.Step(phys0)
+  solver.Advance(phys0)
+end
+
+log.Log(LOG_0, string.format("population=%.5f", solver.GetInfo(phys0, "neutron_population")))
@@ -5,6 +5,8 @@ import warnings
 import re
 import pathlib
 import difflib
+import json
+import platform
 
 
 class Check:
@@ -575,3 +577,157 @@ class GoldFileCheck(Check):
             lines_b = ScopeFilterLines(lines_b, self.scope_keyword)
 
         return lines_a, lines_b
+
+
+# ===================================================================
+class PerformanceCheck(Check):
+    """Extracts a timing metric from the output of a test and compares it against a per-machine
+       baseline. The check fails if the metric regressed by more than the relative tolerance.
+
+       Baselines are stored in a JSON file in the gold directory of the test directory, with the
+       layout {machine: {test: {metric: value}}}, where the machine defaults to the host name and
+       the test is the output filename prefix of the test. The file is kept out of the test
+       directory itself, where every JSON file is read as a test configuration."""
+
+    # Set by the test harness from the command line
+    update_baselines: bool = False
+    machine: str = ""
+
+    reductions = {"first": lambda v: v[0],
+                  "last": lambda v: v[-1],
+                  "min": min,
+                  "max": max,
+                  "sum": sum,
+                  "mean": lambda v: sum(v) / len(v)}
+
+    def __init__(self, params: dict, message_prefix: str):
+        super().__init__()
+        self.key: str = ""
+        self.wordnum: int = -1
+        self.metric: str = ""
+        self.rel_tol: float = 0.
+        self.lower_is_better: bool = True
+        self.reduction: str = "last"
+        self.baseline_file: str = "gold/perf_baselines.json"
+
+        if "key" not in params:
+            warnings.warn(message_prefix + 'Missing "key" field')
+            raise ValueError
+        if "rel_tol" not in params:
+            warnings.warn(message_prefix + 'Missing "rel_tol" field')
+            raise ValueError
+
+        self.key = params["key"]
+        self.metric = params.get("metric", self.key)
+        self.rel_tol = params["rel_tol"]
+        if "wordnum" in params:
+            self.wordnum = params["wordnum"]
+        if "lower_is_better" in params:
+            self.lower_is_better = params["lower_is_better"]
+        if "baseline_file" in params:
+            self.baseline_file = params["baseline_file"]
+        if "reduction" in params:
+            self.reduction = params["reduction"]
+            if self.reduction not in self.reductions:
+                warnings.warn(message_prefix + f'"reduction" field, with value '
+                              + f'"{self.reduction}" must be in the list: '
+                              + str(list(self.reductions.keys())))
+                raise ValueError
+
+    def __str__(self):
+        return 'type="Performance", ' + f'key="{self.key}", ' + \
+            f'wordnum={self.wordnum}, ' + \
+            f'metric="{self.metric}", ' + \
+            f'rel_tol={self.rel_tol}, ' + f'lower_is_better={self.lower_is_better}'
+
+    @staticmethod
+    def GetMachineName():
+        """Returns the name under which baselines for this machine are stored"""
+        if PerformanceCheck.machine != "":
+            return PerformanceCheck.machine
+        return os.environ.get("OPENSN_PERF_MACHINE", platform.node())
+
+    def ReadValues(self, filename):
+        """Returns all values of the metric found in the output file"""
+        values = []
+        with open(filename, "r", encoding='utf-8') as file:
+            for line in file:
+                key_pos = line.find(self.key)
+                if key_pos < 0:
+                    continue
+                if self.wordnum >= 0:
+                    words = re.split(r'\s+|,+|=+', line.rstrip())
+                    if len(words) <= self.wordnum:
+                        raise ValueError(f"Required word {self.wordnum} does not exist in "
+                                         + "line: " + line.rstrip())
+                    values.append(float(words[self.wordnum]))
+                else:
+                    postkey = line[(key_pos + len(self.key)):].strip()
+                    values.append(float(postkey.split()[0]))
+        return values
+
+    def PerformCheck(self, filename, errorcode, verbose: bool):
+        try:
+            if errorcode != 0:
+                if verbose:
+                    warnings.warn(f'Check failed: {self.metric} not measured, error_code '
+                                  + f'{errorcode}')
+                return False
+
+            values = self.ReadValues(filename)
+            if len(values) == 0:
+                if verbose:
+                    warnings.warn('Check failed : key, "' + self.key + '", not found')
+                return False
+            value = self.reductions[self.reduction](values)
+
+            outfiledir = pathlib.Path(os.path.dirname(filename) + "/")
+            baseline_path = str(outfiledir.parent.absolute()) + "/" + self.baseline_file
+            test_name = os.path.splitext(os.path.basename(filename))[0]
+            machine = self.GetMachineName()
+
+            baselines = {}
+            if os.path.isfile(baseline_path):
+                with open(baseline_path, "r", encoding='utf-8') as file:
+                    baselines = json.load(file)
+
+            if self.update_baselines:
+                test_baselines = baselines.setdefault(machine, {}).setdefault(test_name, {})
+                test_baselines[self.metric] = value
+                os.makedirs(os.path.dirname(baseline_path), exist_ok=True)
+                with open(baseline_path, "w", encoding='utf-8') as file:
+                    json.dump(baselines, file, indent=2, sort_keys=True)
+                    file.write("\n")
+                self.annotations.append("Baseline updated")
+                return True
+
+            baseline = baselines.get(machine, {}).get(test_name, {}).get(self.metric)
+            if baseline is None:
+                if verbose:
+                    print(f'No baseline for "{self.metric}" of {test_name} on machine '
+                          + f'"{machine}" in {baseline_path}. Measured value {value}')
+                self.annotations.append("No baseline")
+                return True
+
+            if self.lower_is_better:
+                passed = value <= baseline * (1.0 + self.rel_tol)
+            else:
+                passed = value >= baseline * (1.0 - self.rel_tol)
+
+            if verbose:
+                change = (value - baseline) / baseline * 100.0 if baseline != 0.0 else 0.0
+                print(f'{test_name} "{self.metric}": {value} vs baseline {baseline} '
+                      + f'({change:+.1f}%)')
+
+            if not passed:
+                self.annotations.append("Regression")
+            return passed
+
+        except FileNotFoundError as e:
+            print(str(e))
+        except Exception as e:
+            self.annotations.append("Python error")
+            if verbose:
+                warnings.warn(str(e))
+
+        return False
@@ -90,6 +90,13 @@ class TestConfiguration:
                     self.checks.append(new_check)
                 except ValueError:
                     continue
+            elif check_params["type"] == "Performance":
+                try:
+                    prefix = message_prefix + f'Check number {check_num} '
+                    new_check = checks.PerformanceCheck(check_params, prefix)
+                    self.checks.append(new_check)
+                except ValueError:
+                    continue
             else:
                 warnings.warn("Unsupported check type: " + check_params["type"])
                 raise ValueError
@@ -98,6 +105,10 @@ class TestConfiguration:
             warnings.warn(message_prefix + " has no valid checks")
             raise ValueError
 
+        # Tests with timing checks are opt-in and are run exclusively
+        self.performance = any(isinstance(check, checks.PerformanceCheck)
+                               for check in self.checks)
+
     def GetTestPath(self):
         """Shorthand utility to get the relative path to a test"""
         return os.path.relpath(self.file_dir + self.filename)
@@ -135,8 +146,22 @@ class TestConfiguration:
 
 
 # Parse JSON configs
-def ParseTestConfiguration(file_path: str):
-    """Parses a JSON configuration at the path specified"""
+def ReadBuildFeatures(exe: str):
+    """Reads the optional features of the build, which CMake lists in features.json next to the
+       test executable. Returns an empty list if the file does not exist."""
+    features_file = os.path.join(os.path.dirname(exe), "features.json")
+    if not os.path.isfile(features_file):
+        print("No " + features_file + " found. Tests that require optional features are "
+              + "skipped.")
+        return []
+
+    with open(features_file, 'r', encoding='utf-8') as file:
+        return json.load(file)["features"]
+
+
+def ParseTestConfiguration(file_path: str, features: list):
+    """Parses a JSON configuration at the path specified. Tests that require a feature not in
+       `features` are skipped."""
     test_objects = {}
 
     with open(file_path, 'r', encoding='utf-8') as file:
@@ -146,7 +171,7 @@ def ParseTestConfiguration(file_path: str):
 
     if not isinstance(data, list):
         warnings.warn(err_read + "Main block is not a list")
-        return []
+        return {}
 
     test_num = 0
     for test_block in data:
@@ -220,6 +245,16 @@ def ParseTestConfiguration(file_path: str):
                 warnings.warn(message_prefix + '"skip" field must be a string')
                 continue
 
+        if "requires" in test_block:
+            requires = test_block["requires"]
+            if not isinstance(requires, list) or \
+                    not all(isinstance(feature, str) for feature in requires):
+                warnings.warn(message_prefix + '"requires" field must be a list of strings')
+                continue
+            missing = [feature for feature in requires if feature not in features]
+            if len(missing) > 0 and skip_reason == "":
+                skip_reason = "Build without " + ", ".join(missing)
+
         try:
             new_test = TestConfiguration(file_dir=os.path.dirname(file_path) + "/",
                                          filename=test_block["file"],
@@ -283,12 +318,20 @@ def ConfigureTests(test_hierarchy: dict, argv):
     if specific_test is not None:
         print("specific_test=" + specific_test)
 
+    checks.PerformanceCheck.update_baselines = argv.update_baselines
+    if argv.machine is not None:
+        checks.PerformanceCheck.machine = argv.machine
+
+    features = ReadBuildFeatures(argv.exe)
+
     test_objects = []
     for testdir in test_hierarchy:
         for config_file in ListFilesInDir(testdir, ".json"):
-            sub_test_objs = ParseTestConfiguration(testdir + config_file)
+            sub_test_objs = ParseTestConfiguration(testdir + config_file, features)
             specific_test_dependency = None
             for obj in sub_test_objs.values():
+                if specific_test is None and obj.performance != argv.perf:
+                    continue
                 if specific_test is None or obj.filename == specific_test:
                     test_objects.append(obj)
                     if specific_test is not None:
@@ -353,6 +396,10 @@ def RunTests(tests: list, argv):
         warnings.warn('Illegal value "' + str(argv.weights) + '" supplied '
                       + 'for argument -w, --weights')
 
+    # Performance tests are long by nature and are run whatever their weight class
+    if argv.perf:
+        weight_classes_allowed = weight_class_map.copy()
+
     print("Executing tests with weights in: " + str(weight_classes_allowed))
 
     while True:
@@ -364,6 +411,9 @@ def RunTests(tests: list, argv):
             done = False
 
             if not test.submitted and test.CheckDependencies(tests):
+                # Timings are only meaningful when nothing else is running
+                if test.performance and system_load > 0:
+                    continue
                 if test.num_procs <= (capacity - system_load):
                     system_load += test.num_procs
 
@@ -419,6 +469,9 @@ def RunTests(tests: list, argv):
 
     if num_tests_failed > 0:
         return 1
+    if argv.perf and len(test_slots) == 0:
+        print("\033[31mNo performance tests were run\033[0m")
+        return 1
     return 0
 
 